@@ -12,6 +12,8 @@
 #include <string.h>
 #include <iostream>
 #include <iomanip>
+#include <string>
+#include <stdexcept>
 
 #include "utilities4Speed.hpp"
 
@@ -83,3 +85,32 @@ void printSpeeds( char const *label, clock_t &time0, long samples ) {
     std::cerr << std::left << std::setw( 30 ) << label << ": time = " << std::setprecision( 3 ) << cpuTime << " s: samples = " << 
             std::right << std::setw( 10 ) << samples << " (" << std::setprecision( 3 ) << _samples << "): samples/s = " << speed << std::endl;
 }
+/*
+=========================================================
+*/
+int speedMain( int argc, char **argv, void (*main2)( int argc, char **argv ) ) {
+
+    try {
+        main2( argc, argv ); }
+    catch (std::exception &exception) {
+        std::cerr << exception.what( ) << std::endl;
+        return( EXIT_FAILURE ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        return( EXIT_FAILURE ); }
+    catch (std::string &str) {
+        std::cout << str << std::endl;
+        return( EXIT_FAILURE );
+    }
+
+    return( EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+void printCommandLine( char const *file, int argc, char **argv ) {
+
+    std::cout << file;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cout << " " << argv[i1];
+    std::cout << std::endl;
+}
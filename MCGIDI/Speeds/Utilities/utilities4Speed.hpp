@@ -15,3 +15,5 @@ void printTime_energy( char const *label, long index, double value, clock_t &tim
 void printTime_double( char const *label, double value, clock_t &time0 );
 void printTime( char const *label, clock_t &time0, bool printEndOfLine = true );
 void printSpeeds( char const *label, clock_t &time0, long sampled );
+int speedMain( int argc, char **argv, void (*main2)( int argc, char **argv ) );
+void printCommandLine( char const *file, int argc, char **argv );
@@ -0,0 +1,134 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <math.h>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    int bankSize = 100 * 1000;
+    long numberOfPasses = 20;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::atomicOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, "n", "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, "n", &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    int numberOfReactions = static_cast<int>( MCProtare->numberOfReactions( ) );
+    std::vector<int> hashIndices( bankSize );
+    std::vector<double> energies( bankSize ), bankTemperatures( bankSize );
+    std::vector<double> crossSections( bankSize ), crossSectionsBatch( bankSize );
+    std::vector<double> reactionCrossSections( static_cast<long>( numberOfReactions ) * bankSize );
+
+    for( int i1 = 0; i1 < bankSize; ++i1 ) {             // Log uniform energies in [1e-11, 20] MeV and uniform temperatures in [1e-8, 2e-3] MeV/k.
+        energies[i1] = 1e-11 * pow( 2e12, myRNG( nullptr ) );
+        bankTemperatures[i1] = 1e-8 + 2e-3 * myRNG( nullptr );
+        hashIndices[i1] = domainHash.index( energies[i1] );
+    }
+    printTime( "    setup bank: ", time1 );
+
+    long sampled = numberOfPasses * bankSize;
+
+    for( long pass = 0; pass < numberOfPasses; ++pass ) {
+        for( int i1 = 0; i1 < bankSize; ++i1 ) crossSections[i1] = MCProtare->crossSection( URR_protare_infos, hashIndices[i1], bankTemperatures[i1], energies[i1] );
+    }
+    clock_t time2 = clock( );
+    double scalarTime = ( time2 - time1 ) / ( (double) CLOCKS_PER_SEC );
+    printSpeeds( "scalar total", time1, sampled );
+    time1 = time2;
+
+    for( long pass = 0; pass < numberOfPasses; ++pass ) {
+        MCProtare->crossSectionBatch( URR_protare_infos, bankSize, hashIndices.data( ), bankTemperatures.data( ), energies.data( ), crossSectionsBatch.data( ) );
+    }
+    time2 = clock( );
+    double batchTime = ( time2 - time1 ) / ( (double) CLOCKS_PER_SEC );
+    printSpeeds( "batch total", time1, sampled );
+    time1 = time2;
+
+    double maximumRelativeDifference = 0.0;
+    for( int i1 = 0; i1 < bankSize; ++i1 ) {
+        double difference = fabs( crossSections[i1] - crossSectionsBatch[i1] );
+
+        if( crossSections[i1] != 0.0 ) difference /= crossSections[i1];
+        if( difference > maximumRelativeDifference ) maximumRelativeDifference = difference;
+    }
+    std::cout << "    total: speedup = " << std::setprecision( 3 ) << scalarTime / batchTime << "  maximum relative difference = " << maximumRelativeDifference << std::endl;
+
+    long reactionSampled = sampled * numberOfReactions;
+
+    for( long pass = 0; pass < numberOfPasses; ++pass ) {
+        for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+            double *reactionCrossSection = &reactionCrossSections[static_cast<long>( reactionIndex ) * bankSize];
+
+            for( int i1 = 0; i1 < bankSize; ++i1 ) reactionCrossSection[i1] = 
+                    MCProtare->reactionCrossSection( reactionIndex, URR_protare_infos, hashIndices[i1], bankTemperatures[i1], energies[i1] );
+        }
+    }
+    time2 = clock( );
+    scalarTime = ( time2 - time1 ) / ( (double) CLOCKS_PER_SEC );
+    printSpeeds( "scalar reactions", time1, reactionSampled );
+    time1 = time2;
+
+    for( long pass = 0; pass < numberOfPasses; ++pass ) {
+        MCProtare->crossSectionBatch( URR_protare_infos, bankSize, hashIndices.data( ), bankTemperatures.data( ), energies.data( ), crossSectionsBatch.data( ), 
+                reactionCrossSections.data( ) );
+    }
+    time2 = clock( );
+    batchTime = ( time2 - time1 ) / ( (double) CLOCKS_PER_SEC );
+    printSpeeds( "batch total and reactions", time1, reactionSampled );
+    std::cout << "    reactions: speedup = " << std::setprecision( 3 ) << scalarTime / batchTime << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    std::cout << "total sampled = " << sampled << "  (" << std::setprecision( 3 ) << (double) sampled << ")" << std::endl;
+
+    delete protare;
+
+    delete MCProtare;
+}
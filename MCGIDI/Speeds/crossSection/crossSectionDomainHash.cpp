@@ -0,0 +1,119 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static void lookups( char const *a_label, GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Styles::TemperatureInfos const &a_temperatures, MCGIDI::DomainHash const &a_domainHash, std::vector<double> const &a_energies );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 10 * 1000 * 1000;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    int binsList[] = { 500, 1000, 4000, 16000, 64000 };
+    double domainMin = 1e-8, domainMax = 100.0;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, domainMin, domainMax );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    std::vector<double> grid;                       // Union of the energy grids of all temperatures.
+    MCGIDI::HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = MCProtare->protare( 0 )->heatedCrossSections( );
+    for( int i1 = 0; i1 < static_cast<int>( heatedCrossSections.temperatures( ).size( ) ); ++i1 ) {
+        MCGIDI::Vector<double> const &energies = heatedCrossSections.energies( i1 );
+
+        grid.insert( grid.end( ), energies.begin( ), energies.end( ) );
+    }
+    delete MCProtare;
+
+    std::vector<double> energies( numberOfSamples );
+    double logEnergyMin = log( 1e-11 ), logEnergyRange = log( 20.0 ) - logEnergyMin;
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) energies[i1] = exp( logEnergyMin + logEnergyRange * myRNG( nullptr ) );
+
+    for( std::size_t i1 = 0; i1 < sizeof( binsList ) / sizeof( binsList[0] ); ++i1 ) {
+        int bins = binsList[i1];
+
+        std::cout << std::endl << "bins = " << bins << std::endl;
+        lookups( "logarithmic", *protare, pops, MC, temperatures, MCGIDI::DomainHash( bins, domainMin, domainMax ), energies );
+        lookups( "exponent bits", *protare, pops, MC, temperatures, MCGIDI::DomainHash( MCGIDI::DomainHashMode::exponentBits, bins, domainMin, domainMax ), energies );
+        lookups( "equal points", *protare, pops, MC, temperatures, MCGIDI::DomainHash( bins, domainMin, domainMax, grid ), energies );
+    }
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+}
+/*
+=========================================================
+*/
+static void lookups( char const *a_label, GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Styles::TemperatureInfos const &a_temperatures, MCGIDI::DomainHash const &a_domainHash, std::vector<double> const &a_energies ) {
+
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    long numberOfSamples = static_cast<long>( a_energies.size( ) ), hashIndexSum = 0;
+    double temperature = a_temperatures[0].temperature( ).value( ), sum = 0.0;
+
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( a_protare, a_pops, a_MC, particles, a_domainHash, a_temperatures, reactionsToExclude );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::cout << "    " << a_label << " (bins = " << a_domainHash.bins( ) << ", memory = " << MCProtare->memorySize( ) << ")" << std::endl;
+
+    clock_t time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) hashIndexSum += a_domainHash.index( a_energies[i1] );
+    printSpeeds( "        hash index", time1, numberOfSamples );
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        sum += MCProtare->crossSection( URR_protare_infos, a_domainHash.index( a_energies[i1] ), temperature, a_energies[i1] );
+    }
+    printSpeeds( "        hash index and cross section", time1, numberOfSamples );
+
+    std::cout << "        hash index sum = " << hashIndexSum << "  cross section sum = " << std::setprecision( 12 ) << sum << std::endl;
+
+    delete MCProtare;
+}
@@ -0,0 +1,153 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static long lookups( char const *a_label, MCGIDI::Protare *a_protare, MCGIDI::DomainHash const &a_domainHash,
+                GIDI::Styles::TemperatureInfos const &a_temperatures, long a_numberOfSamples );
+static void compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareBroadened, MCGIDI::DomainHash const &a_domainHash,
+                GIDI::Styles::TemperatureInfos const &a_temperatures );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 100 * 1000;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MC.wantOnTheFlyDopplerBroadening( true );
+    MCGIDI::Protare *MCProtareBroadened = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI (on-the-fly Doppler broadening): ", time1 );
+
+    std::cout << "    memory = " << MCProtare->memorySize( ) << "  memory (on-the-fly Doppler broadening) = " << MCProtareBroadened->memorySize( ) << std::endl;
+
+    compare( MCProtare, MCProtareBroadened, domainHash, temperatures );
+
+    long sampled = lookups( "tabulated temperatures", MCProtare, domainHash, temperatures, numberOfSamples );
+    long sampledBroadened = lookups( "on-the-fly Doppler broadening", MCProtareBroadened, domainHash, temperatures, numberOfSamples );
+
+    printTime( "    total: ", time0 );
+
+    std::cout << "total sampled = " << sampled + sampledBroadened << "  (" << std::setprecision( 3 ) << (double) ( sampled + sampledBroadened ) << ")" << std::endl;
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareBroadened;
+}
+/*
+=========================================================
+*/
+static void compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareBroadened, MCGIDI::DomainHash const &a_domainHash,
+                GIDI::Styles::TemperatureInfos const &a_temperatures ) {
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 2 );
+    protares[0] = a_protare;
+    protares[1] = a_protareBroadened;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::cout << std::endl << "    relative difference of on-the-fly Doppler broadened total cross section to tabulated data" << std::endl;
+    for( std::size_t i1 = 0; i1 < a_temperatures.size( ); ++i1 ) {
+        double temperature = a_temperatures[i1].temperature( ).value( ), maximum = 0.0, sum = 0.0, maximumEnergy = 0.0;
+        long count = 0;
+
+        for( double energy = 1e-11; energy < 20.0; energy *= 1.05, ++count ) {
+            int hashIndex = a_domainHash.index( energy );
+            double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+            double crossSectionBroadened = a_protareBroadened->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+            double difference = 0.0;
+
+            if( crossSection > 0.0 ) difference = fabs( crossSectionBroadened - crossSection ) / crossSection;
+            sum += difference;
+            if( difference > maximum ) {
+                maximum = difference;
+                maximumEnergy = energy;
+            }
+        }
+        std::cout << "        temperature = " << std::setprecision( 6 ) << temperature << "  maximum = " << maximum << " (at " << maximumEnergy
+                << ")  mean = " << sum / count << std::endl;
+    }
+}
+/*
+=========================================================
+*/
+static long lookups( char const *a_label, MCGIDI::Protare *a_protare, MCGIDI::DomainHash const &a_domainHash,
+                GIDI::Styles::TemperatureInfos const &a_temperatures, long a_numberOfSamples ) {
+
+    long sampleEnergies = 0;
+    double sum = 0.0;
+    clock_t time1 = clock( );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::cout << std::endl << "    " << a_label << std::endl;
+    for( std::size_t i1 = 0; i1 < a_temperatures.size( ); ++i1 ) {
+        double temperature = a_temperatures[i1].temperature( ).value( );
+        clock_t time1_1 = clock( );
+        clock_t time2_1 = time1_1;
+
+        long energyIndex = 0;
+        for( double energy = 1e-12; energy < 200.0; energy *= 3.1, ++energyIndex ) {
+            int hashIndex = a_domainHash.index( energy );
+
+            for( long i2 = 0; i2 <= a_numberOfSamples; ++i2 ) sum += a_protare->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+            printTime_energy( "            energies: ", energyIndex, energy, time2_1 );
+        }
+        sampleEnergies = energyIndex;
+        std::cout << std::endl;
+        printTime_double( "        temperature: ", temperature, time1_1 );
+    }
+
+    long sampled = static_cast<long>( a_temperatures.size( ) ) * sampleEnergies * a_numberOfSamples;
+
+    printSpeeds( a_label, time1, sampled );
+    printTime( "    lookup: ", time1 );
+    std::cout << "    cross section sum = " << std::setprecision( 12 ) << sum << std::endl;
+
+    return( sampled );
+}
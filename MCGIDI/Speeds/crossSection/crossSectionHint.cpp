@@ -0,0 +1,143 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static void printHintStatistics( char const *a_label, MCGIDI::EnergyIndexHint const &a_energyIndexHint );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 10 * 1000 * 1000;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MCGIDI::ProtareSingle const *protareSingle = MCProtare->protare( 0 );
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    double temperature = temperatures[0].temperature( ).value( );       // Between the first two temperatures so that both hint slots are used.
+    if( temperatures.size( ) > 1 ) temperature = 0.5 * ( temperature + temperatures[1].temperature( ).value( ) );
+    MCGIDI::TemperatureContext temperatureContext = protareSingle->temperatureContext( temperature );
+
+// Energies of neutrons slowing down by elastic scattering off O16, each history starting at 2 MeV and ending below 1e-8 MeV.
+    std::vector<double> energies( numberOfSamples );
+    std::vector<bool> newHistories( numberOfSamples );
+    double alpha = ( protareSingle->targetMass( ) - protareSingle->projectileMass( ) ) / ( protareSingle->targetMass( ) + protareSingle->projectileMass( ) );
+    alpha *= alpha;
+    double energy = 2.0;
+    long numberOfHistories = 1;
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        newHistories[i1] = energy == 2.0;
+        energies[i1] = energy;
+        energy *= alpha + ( 1.0 - alpha ) * myRNG( nullptr );
+        if( energy < 1e-8 ) {
+            energy = 2.0;
+            ++numberOfHistories;
+        }
+    }
+    std::cout << "    number of histories = " << numberOfHistories << "  collisions per history = " << numberOfSamples / numberOfHistories << std::endl;
+
+    double sum = 0.0, sumContext = 0.0, sumHint = 0.0;
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) sum += MCProtare->crossSection( URR_protare_infos, domainHash.index( energies[i1] ), temperature, energies[i1] );
+    printSpeeds( "    hash", time1, numberOfSamples );
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        sumContext += protareSingle->crossSection( URR_protare_infos, domainHash.index( energies[i1] ), temperatureContext, energies[i1] );
+    }
+    printSpeeds( "    hash and context", time1, numberOfSamples );
+
+    MCGIDI::EnergyIndexHint energyIndexHint;
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        if( newHistories[i1] ) energyIndexHint.reset( );
+        sumHint += protareSingle->crossSection( URR_protare_infos, domainHash.index( energies[i1] ), temperatureContext, energyIndexHint, energies[i1] );
+    }
+    printSpeeds( "    hash, context and hint", time1, numberOfSamples );
+
+    std::cout << "    cross section sums = " << std::setprecision( 12 ) << sum << "  " << sumContext << "  " << sumHint << std::endl;
+    printHintStatistics( "continuous energy", energyIndexHint );
+
+    MCGIDI::MultiGroupHash multiGroupHash( *protare, temperatures[0] );
+    MCGIDI::EnergyIndexHint groupIndexHint;
+    long groupSum = 0, groupSumHint = 0;
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) groupSum += multiGroupHash.index( energies[i1] );
+    printSpeeds( "    multi-group hash", time1, numberOfSamples );
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        if( newHistories[i1] ) groupIndexHint.reset( );
+        groupSumHint += multiGroupHash.index( energies[i1], groupIndexHint );
+    }
+    printSpeeds( "    multi-group hash and hint", time1, numberOfSamples );
+
+    std::cout << "    group index sums = " << groupSum << "  " << groupSumHint << std::endl;
+    printHintStatistics( "multi-group", groupIndexHint );
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
+/*
+=========================================================
+*/
+static void printHintStatistics( char const *a_label, MCGIDI::EnergyIndexHint const &a_energyIndexHint ) {
+
+    double lookups = static_cast<double>( a_energyIndexHint.lookups( ) );
+
+    if( lookups == 0.0 ) lookups = 1.0;
+    std::cout << "    " << a_label << " hint: lookups = " << a_energyIndexHint.lookups( ) << std::setprecision( 4 )
+            << "  hits = " << a_energyIndexHint.hits( ) << " (" << 100.0 * a_energyIndexHint.hits( ) / lookups << "%)"
+            << "  walks = " << a_energyIndexHint.walks( ) << " (" << 100.0 * a_energyIndexHint.walks( ) / lookups << "%)"
+            << "  misses = " << a_energyIndexHint.misses( ) << " (" << 100.0 * a_energyIndexHint.misses( ) / lookups << "%)" << std::endl;
+}
@@ -0,0 +1,115 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Builds majorants of the O16 total cross section over its temperature range for several numbers of bins and reports their
+    memory, lookup speed, the number of samples where the majorant is less than the cross section (should be 0) and the mean ratio
+    of cross section to majorant (i.e., the fraction of real collisions when delta-tracking).
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    int binsList[] = { 500, 4000, 64000 };
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+    MCGIDI::Vector<double> atomDensities( 1, 0.05 );
+
+    double temperatureMin = temperatures[0].temperature( ).value( ), temperatureMax = temperatures.back( ).temperature( ).value( );
+    std::vector<double> energies( numberOfSamples ), sampleTemperatures( numberOfSamples ), crossSections( numberOfSamples );
+    double logEnergyMin = log( 1e-11 ), logEnergyRange = log( 20.0 ) - logEnergyMin, sum = 0.0;
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        energies[i1] = exp( logEnergyMin + logEnergyRange * myRNG( nullptr ) );
+        sampleTemperatures[i1] = temperatureMin + ( temperatureMax - temperatureMin ) * myRNG( nullptr );
+    }
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        crossSections[i1] = atomDensities[0] * MCProtare->crossSection( URR_protare_infos, domainHash.index( energies[i1] ), sampleTemperatures[i1], energies[i1] );
+        sum += crossSections[i1];
+    }
+    printSpeeds( "    cross section", time1, numberOfSamples );
+
+    for( std::size_t i1 = 0; i1 < sizeof( binsList ) / sizeof( binsList[0] ); ++i1 ) {
+        MCGIDI::DomainHash majorantHash( binsList[i1], 1e-11, 20.0 );
+        MCGIDI::Majorant majorant( majorantHash );
+        double majorantSum = 0.0, ratioSum = 0.0;
+        long violations = 0;
+
+        time1 = clock( );
+        majorant.addMaterial( domainHash, protares, atomDensities, temperatureMin, temperatureMax );
+        printTime( "    build majorant: ", time1 );
+
+        time1 = clock( );
+        for( long i2 = 0; i2 < numberOfSamples; ++i2 ) majorantSum += majorant.crossSection( majorantHash.index( energies[i2] ) );
+        printSpeeds( "    majorant", time1, numberOfSamples );
+
+        for( long i2 = 0; i2 < numberOfSamples; ++i2 ) {
+            double majorantCrossSection = majorant.crossSection( energies[i2] );
+
+            if( majorantCrossSection < crossSections[i2] ) ++violations;
+            if( majorantCrossSection > 0.0 ) ratioSum += crossSections[i2] / majorantCrossSection;
+        }
+
+        std::cout << "    bins = " << binsList[i1] << "  memory = " << majorant.memorySize( ) << "  violations = " << violations
+                << "  mean cross section / majorant = " << std::setprecision( 6 ) << ratioSum / numberOfSamples
+                << "  majorant sum = " << std::setprecision( 12 ) << majorantSum << "  cross section sum = " << sum << std::endl;
+    }
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
@@ -0,0 +1,156 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Compares the macroscopic total cross section lookup and nuclide sampling of a 50 nuclide material done by looping over the nuclides
+    with the same done by an MCGIDI::Material. As O16 is the only target assured to be in all3T.map, every nuclide uses the O16 protare
+    with a different atom density. The per nuclide loop timings scale with the number of nuclides and not with their data.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static double storedRandom( void *a_random );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+    int numberOfNuclides = 50;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( numberOfNuclides );
+    MCGIDI::Vector<double> atomDensities( numberOfNuclides );
+    for( int i1 = 0; i1 < numberOfNuclides; ++i1 ) {
+        protares[i1] = MCProtare;
+        atomDensities[i1] = 1e-3 * ( 1.0 + i1 % 7 );
+    }
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    MCGIDI::Vector<double> materialTemperatures( temperatures.size( ) );
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) materialTemperatures[i1] = temperatures[i1].temperature( ).value( );
+
+    MCGIDI::Material material( domainHash, protares, atomDensities, materialTemperatures );
+    printTime( "    load material: ", time1 );
+    std::cout << "    material: number of energies = " << material.energies( ).size( ) << "  memory = " << material.memorySize( ) << std::endl;
+
+    double temperature = materialTemperatures[0];
+    if( materialTemperatures.size( ) > 1 ) temperature = 0.5 * ( temperature + materialTemperatures[1] );
+
+    std::vector<double> energies( numberOfSamples ), randoms( numberOfSamples );
+    double logEnergyMin = log( 1e-11 ), logEnergyRange = log( 20.0 ) - logEnergyMin;
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        energies[i1] = exp( logEnergyMin + logEnergyRange * myRNG( nullptr ) );
+        randoms[i1] = myRNG( nullptr );
+    }
+
+    std::vector<double> microscopic( numberOfNuclides );
+    double sum = 0.0, sumMaterial = 0.0, maximum = 0.0;
+    long nuclideSum = 0, nuclideSumMaterial = 0;
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        int hashIndex = domainHash.index( energies[i1] );
+        double crossSection = 0.0;
+
+        for( int i2 = 0; i2 < numberOfNuclides; ++i2 ) {
+            microscopic[i2] = atomDensities[i2] * protares[i2]->crossSection( URR_protare_infos, hashIndex, temperature, energies[i1] );
+            crossSection += microscopic[i2];
+        }
+        sum += crossSection;
+
+        double sampleCrossSection = randoms[i1] * crossSection, cumulative = 0.0;
+        int nuclide = numberOfNuclides - 1;
+        for( int i2 = 0; i2 < numberOfNuclides; ++i2 ) {
+            cumulative += microscopic[i2];
+            if( cumulative >= sampleCrossSection ) {
+                nuclide = i2;
+                break;
+            }
+        }
+        nuclideSum += nuclide;
+    }
+    printSpeeds( "    per nuclide loop", time1, numberOfSamples );
+
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        int hashIndex = domainHash.index( energies[i1] );
+        double crossSection = material.crossSection( hashIndex, temperature, energies[i1] );
+
+        sumMaterial += crossSection;
+        nuclideSumMaterial += material.sampleNuclide( hashIndex, temperature, energies[i1], crossSection, storedRandom, &randoms[i1] );
+    }
+    printSpeeds( "    material", time1, numberOfSamples );
+
+    for( long i1 = 0; i1 < numberOfSamples; i1 += 1000 ) {
+        int hashIndex = domainHash.index( energies[i1] );
+        double crossSection = 0.0;
+
+        for( int i2 = 0; i2 < numberOfNuclides; ++i2 ) {
+            crossSection += atomDensities[i2] * protares[i2]->crossSection( URR_protare_infos, hashIndex, temperature, energies[i1] );
+        }
+        double difference = fabs( material.crossSection( hashIndex, temperature, energies[i1] ) - crossSection );
+        if( crossSection > 0.0 ) difference /= crossSection;
+        if( difference > maximum ) maximum = difference;
+    }
+
+    std::cout << "    cross section sums = " << std::setprecision( 12 ) << sum << "  " << sumMaterial << std::endl;
+    std::cout << "    nuclide index sums = " << nuclideSum << "  " << nuclideSumMaterial << std::endl;
+    std::cout << "    maximum relative difference of cross sections = " << std::setprecision( 6 ) << maximum << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
+/*
+=========================================================
+*/
+static double storedRandom( void *a_random ) {
+
+    return( *static_cast<double *>( a_random ) );
+}
@@ -0,0 +1,103 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Reports the memory used by a multi-temperature protare and the memory saved by sharing energy grids and reaction cross sections
+    that are identical across temperatures, and times total cross section lookups at temperatures between the tabulated ones.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 10 * 1000 * 1000;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    std::string target( "O16" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    long memorySize = MCProtare->memorySize( ), sharedMemorySize = MCProtare->sharedMemorySize( );
+    std::cout << "    number of temperatures = " << temperatures.size( ) << "  memory = " << memorySize << "  shared memory = " << sharedMemorySize
+            << "  saved = " << std::setprecision( 3 ) << 100.0 * sharedMemorySize / ( memorySize + sharedMemorySize ) << "%" << std::endl;
+
+    MCGIDI::ProtareSingle const *protareSingle = MCProtare->protare( 0 );
+    MCGIDI::Vector<MCGIDI::HeatedCrossSectionContinuousEnergy *> const &heatedCrossSections = protareSingle->heatedCrossSections( ).heatedCrossSections( );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < heatedCrossSections.size( ); ++i1 ) {
+        MCGIDI::HeatedCrossSectionContinuousEnergy const *heatedCrossSection = heatedCrossSections[i1];
+        int numberOfSharedReactions = 0;
+
+        for( int i2 = 0; i2 < heatedCrossSection->numberOfReactions( ); ++i2 ) {
+            if( heatedCrossSection->reactionCrossSection( i2 )->crossSectionSource( ) >= 0 ) ++numberOfSharedReactions;
+        }
+        std::cout << "    temperature index " << i1 << ": energy grid source = " << heatedCrossSection->energyGridSource( )
+                << "  shared reactions = " << numberOfSharedReactions << " of " << heatedCrossSection->numberOfReactions( ) << std::endl;
+    }
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    double temperatureMin = temperatures[0].temperature( ).value( ), temperatureMax = temperatures.back( ).temperature( ).value( );
+    double sum = 0.0;
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        double energy = 1e-11 * pow( 2e12, myRNG( nullptr ) );
+        double temperature = temperatureMin + ( temperatureMax - temperatureMin ) * myRNG( nullptr );
+
+        sum += MCProtare->crossSection( URR_protare_infos, domainHash.index( energy ), temperature, energy );
+    }
+    printSpeeds( "crossSection", time1, numberOfSamples );
+    std::cout << "    mean cross section = " << std::setprecision( 6 ) << sum / numberOfSamples << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
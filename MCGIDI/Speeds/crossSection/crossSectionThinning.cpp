@@ -0,0 +1,118 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static void lookups( char const *a_label, GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Styles::TemperatureInfos const &a_temperatures, MCGIDI::DomainHash const &a_domainHash, std::vector<double> const &a_energies,
+                std::vector<double> &a_crossSections );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    long numberOfSamples = 10 * 1000 * 1000;
+    double tolerances[] = { 1e-4, 1e-3, 1e-2 };
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+
+    std::vector<double> energies( numberOfSamples );
+    double logEnergyMin = log( 1e-11 ), logEnergyRange = log( 20.0 ) - logEnergyMin;
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) energies[i1] = exp( logEnergyMin + logEnergyRange * myRNG( nullptr ) );
+
+    std::vector<double> crossSections( numberOfSamples ), crossSectionsThinned( numberOfSamples );
+    lookups( "not thinned", *protare, pops, MC, temperatures, domainHash, energies, crossSections );
+
+    for( std::size_t i1 = 0; i1 < sizeof( tolerances ) / sizeof( tolerances[0] ); ++i1 ) {
+        double maximum = 0.0;
+
+        MC.gridThinningTolerance( tolerances[i1] );
+        std::cout << std::endl << "tolerance = " << tolerances[i1] << std::endl;
+        lookups( "thinned", *protare, pops, MC, temperatures, domainHash, energies, crossSectionsThinned );
+
+        for( long i2 = 0; i2 < numberOfSamples; ++i2 ) {
+            double difference = fabs( crossSectionsThinned[i2] - crossSections[i2] );
+
+            if( difference > 0.0 ) difference /= 0.5 * ( fabs( crossSectionsThinned[i2] ) + fabs( crossSections[i2] ) );
+            if( difference > maximum ) maximum = difference;
+        }
+        std::cout << "        maximum relative difference of total cross section = " << maximum << std::endl;
+    }
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+}
+/*
+=========================================================
+*/
+static void lookups( char const *a_label, GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Styles::TemperatureInfos const &a_temperatures, MCGIDI::DomainHash const &a_domainHash, std::vector<double> const &a_energies,
+                std::vector<double> &a_crossSections ) {
+
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    long numberOfSamples = static_cast<long>( a_energies.size( ) );
+    double temperature = a_temperatures[0].temperature( ).value( ), sum = 0.0;
+
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( a_protare, a_pops, a_MC, particles, a_domainHash, a_temperatures, reactionsToExclude );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::cout << "    " << a_label << " (memory = " << MCProtare->memorySize( ) << ")" << std::endl;
+    MCGIDI::HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = MCProtare->protare( 0 )->heatedCrossSections( );
+    for( int i1 = 0; i1 < static_cast<int>( heatedCrossSections.temperatures( ).size( ) ); ++i1 ) {
+        std::cout << "        temperature = " << heatedCrossSections.temperatures( )[i1] << "  number of energy points = "
+                << heatedCrossSections.energies( i1 ).size( ) << std::endl;
+    }
+
+    clock_t time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        a_crossSections[i1] = MCProtare->crossSection( URR_protare_infos, a_domainHash.index( a_energies[i1] ), temperature, a_energies[i1] );
+        sum += a_crossSections[i1];
+    }
+    printSpeeds( "        cross section", time1, numberOfSamples );
+
+    std::cout << "        cross section sum = " << std::setprecision( 12 ) << sum << std::setprecision( 6 ) << std::endl;
+
+    delete MCProtare;
+}
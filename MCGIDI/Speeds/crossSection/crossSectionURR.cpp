@@ -0,0 +1,139 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times the URR probability table sampling of a bank of particles with energies in the URR region, as done by the
+    sampleURR_probabilityTables tool. The URR information is updated with updateProtare (one particle per call) and with
+    updateProtareBatch (whole bank per call), and the total and reaction cross sections are evaluated. The target can be
+    given as the first argument (default U235). If the protare has no URR probability tables, nothing is timed.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    clock_t time0, time1;
+    int bankSize = 100 * 1000;
+    long numberOfPasses = 20;
+    double temperature = 2.58522e-8;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    std::string target( "U235" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.want_URR_probabilityTables( true );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    std::cout << "    has URR probability tables = " << MCProtare->hasURR_probabilityTables( ) << std::endl;
+    if( MCProtare->hasURR_probabilityTables( ) ) {
+        MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+        protares[0] = MCProtare;
+
+        int numberOfReactions = static_cast<int>( MCProtare->numberOfReactions( ) );
+        double domainMin = MCProtare->URR_domainMin( ), domainMax = MCProtare->URR_domainMax( );
+        std::vector<MCGIDI::URR_protareInfos> URR_protare_infos( bankSize, MCGIDI::URR_protareInfos( protares ) );
+        std::vector<int> hashIndices( bankSize );
+        std::vector<double> energies( bankSize );
+
+        std::cout << "    URR domain = [" << domainMin << ", " << domainMax << "]  number of reactions = " << numberOfReactions << std::endl;
+        for( int i1 = 0; i1 < bankSize; ++i1 ) {
+            energies[i1] = domainMin + ( domainMax - domainMin ) * myRNG( nullptr );
+            hashIndices[i1] = domainHash.index( energies[i1] );
+        }
+        printTime( "    setup bank: ", time1 );
+
+        long sampled = numberOfPasses * bankSize;
+
+        for( long pass = 0; pass < numberOfPasses; ++pass ) {
+            for( int i1 = 0; i1 < bankSize; ++i1 ) URR_protare_infos[i1].updateProtare( MCProtare, energies[i1], myRNG, nullptr );
+        }
+        printSpeeds( "updateProtare", time1, sampled );
+
+        for( long pass = 0; pass < numberOfPasses; ++pass ) {
+            MCGIDI::URR_protareInfos::updateProtareBatch( MCProtare, bankSize, energies.data( ), URR_protare_infos.data( ), myRNG, nullptr );
+        }
+        printSpeeds( "updateProtareBatch", time1, sampled );
+
+        double meanCrossSection = 0.0;
+        for( long pass = 0; pass < numberOfPasses; ++pass ) {
+            MCGIDI::URR_protareInfos::updateProtareBatch( MCProtare, bankSize, energies.data( ), URR_protare_infos.data( ), myRNG, nullptr );
+            for( int i1 = 0; i1 < bankSize; ++i1 )
+                meanCrossSection += MCProtare->crossSection( URR_protare_infos[i1], hashIndices[i1], temperature, energies[i1] );
+        }
+        printSpeeds( "update and total", time1, sampled );
+
+        double meanReactionSum = 0.0;
+        for( long pass = 0; pass < numberOfPasses; ++pass ) {
+            MCGIDI::URR_protareInfos::updateProtareBatch( MCProtare, bankSize, energies.data( ), URR_protare_infos.data( ), myRNG, nullptr );
+            for( int i1 = 0; i1 < bankSize; ++i1 ) {
+                for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex )
+                    meanReactionSum += MCProtare->reactionCrossSection( reactionIndex, URR_protare_infos[i1], hashIndices[i1], temperature, energies[i1] );
+            }
+        }
+        printSpeeds( "update and reactions", time1, sampled * numberOfReactions );
+
+        double maximumRelativeDifference = 0.0;
+        for( int i1 = 0; i1 < bankSize; ++i1 ) {
+            double crossSection = MCProtare->crossSection( URR_protare_infos[i1], hashIndices[i1], temperature, energies[i1] );
+            double reactionSum = 0.0;
+
+            for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex )
+                reactionSum += MCProtare->reactionCrossSection( reactionIndex, URR_protare_infos[i1], hashIndices[i1], temperature, energies[i1] );
+
+            double difference = fabs( crossSection - reactionSum );
+            if( crossSection != 0.0 ) difference /= crossSection;
+            if( difference > maximumRelativeDifference ) maximumRelativeDifference = difference;
+        }
+        std::cout << "    mean total = " << std::setprecision( 6 ) << meanCrossSection / sampled << "  mean sum of reactions = " << meanReactionSum / sampled
+                << "  maximum relative difference (same bands) = " << std::setprecision( 3 ) << maximumRelativeDifference << std::endl;
+    }
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
@@ -0,0 +1,138 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times filling total cross section vectors at several temperatures with crossSectionVector (one temperature per call) and with
+    crossSectionVectors (all temperatures in one pass) using 1 and several threads, and times reactionCrossSectionVectors. The data are
+    stored on an equal-lethargy fixed grid. Elapsed (wall clock) times are printed as the threaded methods use more than one CPU.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <thread>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static double elapsedSeconds( std::chrono::steady_clock::time_point const &a_start );
+static double maximumRelativeDifference( std::vector<double> const &a_vector1, std::vector<double> const &a_vector2 );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    int numberOfPoints = 1000 * 1000, numberOfTemperatures = 8;
+    int numberOfThreads = static_cast<int>( std::thread::hardware_concurrency( ) );
+
+    if( numberOfThreads < 2 ) numberOfThreads = 2;
+    if( argc > 1 ) numberOfThreads = atoi( argv[1] );
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearAndAtomic );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.equalLethargyFixedGrid( 1e-11, 20.0, numberOfPoints );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    std::vector<double> userTemperatures( numberOfTemperatures );
+    double temperatureMin = temperatures[0].temperature( ).value( ), temperatureMax = temperatures.back( ).temperature( ).value( );
+    for( int i1 = 0; i1 < numberOfTemperatures; ++i1 ) userTemperatures[i1] = temperatureMin + ( temperatureMax - temperatureMin ) * i1 / ( numberOfTemperatures - 1 );
+
+    int numberOfReactions = static_cast<int>( MCProtare->numberOfReactions( ) );
+    std::cout << "    number of points = " << numberOfPoints << "  number of temperatures = " << numberOfTemperatures
+            << "  number of reactions = " << numberOfReactions << "  number of threads = " << numberOfThreads << std::endl;
+
+    std::vector<double> crossSections( numberOfTemperatures * numberOfPoints, 0.0 );
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+    for( int i1 = 0; i1 < numberOfTemperatures; ++i1 ) MCProtare->crossSectionVector( userTemperatures[i1], 1.0, numberOfPoints, &crossSections[i1 * numberOfPoints] );
+    std::cout << "    crossSectionVector per temperature:     " << std::setprecision( 4 ) << elapsedSeconds( start ) << " s" << std::endl;
+
+    std::vector<double> crossSections1( numberOfTemperatures * numberOfPoints, 0.0 );
+    start = std::chrono::steady_clock::now( );
+    MCProtare->crossSectionVectors( numberOfTemperatures, &userTemperatures[0], 1.0, numberOfPoints, &crossSections1[0], 1 );
+    std::cout << "    crossSectionVectors (1 thread):         " << std::setprecision( 4 ) << elapsedSeconds( start ) << " s" 
+            << "  maximum relative difference = " << maximumRelativeDifference( crossSections, crossSections1 ) << std::endl;
+
+    std::vector<double> crossSectionsN( numberOfTemperatures * numberOfPoints, 0.0 );
+    start = std::chrono::steady_clock::now( );
+    MCProtare->crossSectionVectors( numberOfTemperatures, &userTemperatures[0], 1.0, numberOfPoints, &crossSectionsN[0], numberOfThreads );
+    std::cout << "    crossSectionVectors (" << std::setw( 3 ) << numberOfThreads << " threads):     " << std::setprecision( 4 ) << elapsedSeconds( start ) << " s" 
+            << "  maximum relative difference = " << maximumRelativeDifference( crossSections, crossSectionsN ) << std::endl;
+
+    double temperature = 0.5 * ( userTemperatures[0] + userTemperatures[1] );
+    std::vector<double> reactionCrossSections( numberOfReactions * numberOfPoints, 0.0 );
+    start = std::chrono::steady_clock::now( );
+    MCProtare->reactionCrossSectionVectors( temperature, 1.0, numberOfPoints, &reactionCrossSections[0], numberOfThreads );
+    std::cout << "    reactionCrossSectionVectors (" << std::setw( 3 ) << numberOfThreads << " threads): " << std::setprecision( 4 ) << elapsedSeconds( start ) << " s" << std::endl;
+
+    std::vector<double> total( numberOfPoints, 0.0 ), reactionSum( numberOfPoints, 0.0 );
+    MCProtare->crossSectionVector( temperature, 1.0, numberOfPoints, &total[0] );
+    for( int i1 = 0; i1 < numberOfReactions; ++i1 ) {
+        for( int i2 = 0; i2 < numberOfPoints; ++i2 ) reactionSum[i2] += reactionCrossSections[i1 * numberOfPoints + i2];
+    }
+    std::cout << "    sum of reactions versus total: maximum relative difference = " << maximumRelativeDifference( total, reactionSum ) << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
+/*
+=========================================================
+*/
+static double elapsedSeconds( std::chrono::steady_clock::time_point const &a_start ) {
+
+    return( std::chrono::duration<double>( std::chrono::steady_clock::now( ) - a_start ).count( ) );
+}
+/*
+=========================================================
+*/
+static double maximumRelativeDifference( std::vector<double> const &a_vector1, std::vector<double> const &a_vector2 ) {
+
+    double maximum = 0.0;
+
+    for( std::size_t i1 = 0; i1 < a_vector1.size( ); ++i1 ) {
+        double difference = fabs( a_vector1[i1] - a_vector2[i1] );
+
+        if( difference > 0.0 ) difference /= 0.5 * ( fabs( a_vector1[i1] ) + fabs( a_vector2[i1] ) );
+        if( difference > maximum ) maximum = difference;
+    }
+
+    return( maximum );
+}
@@ -0,0 +1,121 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Measures multi-group cross section look ups and reaction sampling at a list of cell temperatures with the data interpolated in temperature
+    on each call and with the data stored at the cell temperatures by setMultiGroupUserTemperatures.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::atomicOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, "n", "O16" );
+    printTime( "    load GIDI", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    GIDI::Styles::TemperatureInfo temperature = temperatures[0];
+
+    std::string label( temperature.heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, "n", &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.crossSectionLookupMode( MCGIDI::Transporting::LookupMode::Data1d::multiGroup );
+
+    GIDI::Transporting::Groups_from_bdfls groups_from_bdfls( "../../../GIDI/Test/bdfls" );
+    GIDI::Transporting::Fluxes_from_bdfls fluxes_from_bdfls( "../../../GIDI/Test/bdfls", 0.0 );
+
+    GIDI::Transporting::Particle projectile( "n", groups_from_bdfls.viaLabel( "LLNL_gid_4" ) );
+    projectile.appendFlux( fluxes_from_bdfls.getViaFID( 1 ) );
+
+    GIDI::Transporting::Particles particles;
+    particles.add( projectile );
+    particles.process( *protare, label );
+
+    MCGIDI::MultiGroupHash multiGroupHash( *protare, temperature );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI", time1 );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::vector<double> userTemperatures;          // Cell temperatures between each pair of temperatures of the data.
+    for( std::size_t i1 = 1; i1 < temperatures.size( ); ++i1 ) {
+        double temperature1 = temperatures[i1-1].temperature( ).value( ), temperature2 = temperatures[i1].temperature( ).value( );
+
+        for( int i2 = 1; i2 < 4; ++i2 ) userTemperatures.push_back( temperature1 + 0.25 * i2 * ( temperature2 - temperature1 ) );
+    }
+    std::cout << "    number of user temperatures = " << userTemperatures.size( ) << std::endl;
+
+    std::vector<double> energies( numberOfSamples );
+    std::vector<int> hashIndices( numberOfSamples );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        energies[i1] = 1e-10 * pow( 2e11, myRNG( nullptr ) );
+        hashIndices[i1] = multiGroupHash.index( energies[i1] );
+    }
+
+    double sums[2] = { 0.0, 0.0 };
+    for( int pass = 0; pass < 2; ++pass ) {
+        if( pass == 1 ) {
+            std::cout << "    memory = " << MCProtare->memorySize( );
+            MCProtare->setMultiGroupUserTemperatures( userTemperatures );
+            std::cout << "  memory with user temperatures = " << MCProtare->memorySize( ) << std::endl;
+        }
+
+        srand48( 1 );
+        time1 = clock( );
+        for( std::size_t i1 = 0; i1 < userTemperatures.size( ); ++i1 ) {
+            for( long i2 = 0; i2 < numberOfSamples; ++i2 ) {
+                double crossSection = MCProtare->crossSection( URR_protare_infos, hashIndices[i2], userTemperatures[i1], energies[i2], true );
+
+                sums[pass] += crossSection;
+                sums[pass] += MCProtare->sampleReaction( URR_protare_infos, hashIndices[i2], userTemperatures[i1], energies[i2], crossSection, myRNG, nullptr );
+            }
+        }
+        printSpeeds( pass == 0 ? "    interpolated" : "    user temperatures", time1, numberOfSamples * (long) userTemperatures.size( ) );
+    }
+
+    std::cout << "    sums = " << std::setprecision( 12 ) << sums[0] << "  " << sums[1] << std::endl;
+    printTime( "    total", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
@@ -21,20 +21,7 @@ void main2( int argc, char **argv );
 */
 int main( int argc, char **argv ) {
 
-    try {
-        main2( argc, argv ); }
-    catch (std::exception &exception) {
-        std::cerr << exception.what( ) << std::endl;
-        exit( EXIT_FAILURE ); }
-    catch (char const *str) {
-        std::cout << str << std::endl;
-        exit( EXIT_FAILURE ); }
-    catch (std::string &str) {
-        std::cout << str << std::endl;
-        exit( EXIT_FAILURE );
-    }
-
-    exit( EXIT_SUCCESS );
+    exit( speedMain( argc, argv, main2 ) );
 }
 /*
 =========================================================
@@ -49,9 +36,7 @@ void main2( int argc, char **argv ) {
     long numberOfSamples = 10 * 1000 * 1000, sampleTemperatures = 0, sampleEnergies;
     std::vector<std::string> libraries;
 
-    std::cout << __FILE__;
-    for( int i1 = 1; i1 < argc; i1++ ) std::cout << " " << argv[i1];
-    std::cout << std::endl;
+    printCommandLine( __FILE__, argc, argv );
 
     std::string protareFilename( map.protareFilename( "n", "O16" ) );
 
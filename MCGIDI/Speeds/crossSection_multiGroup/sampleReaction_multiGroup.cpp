@@ -0,0 +1,134 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Measures the multi-group reaction sampling throughput of sampleReaction, which binary searches the cumulative reaction cross section
+    tables, and of a reference loop that sums the reaction cross sections linearly. Both tally the sampled reactions with the same random
+    number seed so that the tallies can be compared.
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000, sampled = 0;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::atomicOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, "n", "O16" );
+    printTime( "    load GIDI", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    GIDI::Styles::TemperatureInfo temperature = temperatures[0];
+
+    std::string label( temperature.heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, "n", &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.crossSectionLookupMode( MCGIDI::Transporting::LookupMode::Data1d::multiGroup );
+
+    GIDI::Transporting::Groups_from_bdfls groups_from_bdfls( "../../../GIDI/Test/bdfls" );
+    GIDI::Transporting::Fluxes_from_bdfls fluxes_from_bdfls( "../../../GIDI/Test/bdfls", 0.0 );
+
+    GIDI::Transporting::Particle projectile( "n", groups_from_bdfls.viaLabel( "LLNL_gid_4" ) );
+    projectile.appendFlux( fluxes_from_bdfls.getViaFID( 1 ) );
+
+    GIDI::Transporting::Particles particles;
+    particles.add( projectile );
+    particles.process( *protare, label );
+
+    MCGIDI::MultiGroupHash multiGroupHash( *protare, temperature );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI", time1 );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    int numberOfReactions = static_cast<int>( MCProtare->numberOfReactions( ) );
+    std::cout << "    number of reactions = " << numberOfReactions << std::endl;
+
+    double temperature2 = temperatures[0].temperature( ).value( );     // Between the first two temperatures so that both tables are used.
+    if( temperatures.size( ) > 1 ) temperature2 = 0.5 * ( temperature2 + temperatures[1].temperature( ).value( ) );
+
+    clock_t timeCumulative = 0, timeLinear = 0;
+    long tallySumCumulative = 0, tallySumLinear = 0, differences = 0;
+    for( double energy = 1e-10; energy < 20.0; energy *= 3.1 ) {
+        int hashIndex = multiGroupHash.index( energy );
+        double crossSection = MCProtare->crossSection( URR_protare_infos, hashIndex, temperature2, energy, true );
+        long tallyCumulative = 0, tallyLinear = 0;
+
+        srand48( 1 );
+        clock_t time2 = clock( );
+        for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+            tallyCumulative += MCProtare->sampleReaction( URR_protare_infos, hashIndex, temperature2, energy, crossSection, myRNG, nullptr );
+        }
+        timeCumulative += clock( ) - time2;
+
+        srand48( 1 );
+        time2 = clock( );
+        for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+            double sampleCrossSection = crossSection * myRNG( nullptr ), crossSectionSum = 0.0;
+            int reactionIndex = 0;
+
+            for( ; reactionIndex < numberOfReactions; ++reactionIndex ) {
+                crossSectionSum += MCProtare->reactionCrossSection( reactionIndex, URR_protare_infos, hashIndex, temperature2, energy, true );
+                if( crossSectionSum >= sampleCrossSection ) break;
+            }
+            if( reactionIndex == numberOfReactions ) reactionIndex = MCGIDI_nullReaction;
+            tallyLinear += reactionIndex;
+        }
+        timeLinear += clock( ) - time2;
+
+        sampled += numberOfSamples;
+        tallySumCumulative += tallyCumulative;
+        tallySumLinear += tallyLinear;
+        if( tallyCumulative != tallyLinear ) ++differences;
+        std::cout << "        energy = " << std::setw( 12 ) << std::setprecision( 6 ) << energy << "  group = " << std::setw( 4 ) << hashIndex
+                << "  reaction index sums = " << tallyCumulative << "  " << tallyLinear << std::endl;
+    }
+
+    std::cout << "    energies with differing reaction index sums (threshold groups only) = " << differences << std::endl;
+    std::cout << "    reaction index sums = " << tallySumCumulative << "  " << tallySumLinear << std::endl;
+    std::cout << "    cumulative (binary search): " << std::setprecision( 4 ) << (double) timeCumulative / CLOCKS_PER_SEC << " s" << std::endl;
+    std::cout << "    linear reference:           " << std::setprecision( 4 ) << (double) timeLinear / CLOCKS_PER_SEC << " s" << std::endl;
+    if( timeCumulative > 0 ) std::cout << "    speedup = " << std::setprecision( 4 ) << (double) timeLinear / timeCumulative << std::endl;
+    printTime( "    total", time0 );
+
+    std::cout << "total sampled = " << sampled << std::endl;
+
+    delete protare;
+
+    delete MCProtare;
+}
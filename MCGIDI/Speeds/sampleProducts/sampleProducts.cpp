@@ -21,20 +21,7 @@ void main2( int argc, char **argv );
 */
 int main( int argc, char **argv ) {
 
-    try {
-        main2( argc, argv ); }
-    catch (std::exception &exception) {
-        std::cerr << exception.what( ) << std::endl;
-        exit( EXIT_FAILURE ); }
-    catch (char const *str) {
-        std::cout << str << std::endl;
-        exit( EXIT_FAILURE ); }
-    catch (std::string &str) {
-        std::cout << str << std::endl;
-        exit( EXIT_FAILURE );
-    }
-
-    exit( EXIT_SUCCESS );
+    exit( speedMain( argc, argv, main2 ) );
 }
 /*
 =========================================================
@@ -52,9 +39,7 @@ void main2( int argc, char **argv ) {
     char label1[1024];
     void *rngState = nullptr;
 
-    std::cout << __FILE__;
-    for( int i1 = 1; i1 < argc; i1++ ) std::cout << " " << argv[i1];
-    std::cout << std::endl;
+    printCommandLine( __FILE__, argc, argv );
 
     GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::atomicOnly );
     time0 = clock( );
@@ -0,0 +1,150 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times product sampling of tabulated (pdf/cdf) distributions with the cdf binary search and with alias tables. Both protares
+    use stochastic interpolation as alias tables are only built for probabilities that are sampled independently of other
+    probabilities. For each reaction and incident energy, the mean outgoing neutron energy and mu of the two protares are printed
+    and should agree within statistics. The target can be given as the first argument (default O16).
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+long sampleMeans( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                double &a_meanEnergy, double &a_meanMu, clock_t &a_sampleTime );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1, sampleTimeSearch = 0, sampleTimeAlias = 0;
+    long numberOfSamples = 100 * 1000, sampled = 0;
+    int neutronIndex = pops[PoPI::IDs::neutron];
+    std::string target( "O16" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.wantStochasticInterpolation( true );
+    MCGIDI::Protare *MCProtareSearch = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+
+    MC.wantAliasTables( true );
+    MCGIDI::Protare *MCProtareAlias = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    std::cout << "    memory without alias tables = " << MCProtareSearch->memorySize( ) << "  with alias tables = " << MCProtareAlias->memorySize( )
+            << std::endl;
+
+    int numberOfReactions = (int) MCProtareSearch->numberOfReactions( );
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = MCProtareSearch->reaction( reactionIndex );
+        double threshold = MCProtareSearch->threshold( reactionIndex );
+
+        std::cout << "    reaction " << reactionIndex << "  " << reaction->label( ).c_str( ) << std::endl;
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            double meanEnergySearch, meanMuSearch, meanEnergyAlias, meanMuAlias;
+
+            long numberOfNeutrons = sampleMeans( MCProtareSearch, reactionIndex, energy, numberOfSamples, neutronIndex, meanEnergySearch, meanMuSearch,
+                    sampleTimeSearch );
+            sampleMeans( MCProtareAlias, reactionIndex, energy, numberOfSamples, neutronIndex, meanEnergyAlias, meanMuAlias, sampleTimeAlias );
+            sampled += numberOfSamples;
+            if( numberOfNeutrons == 0 ) continue;
+
+            std::cout << "        energy = " << std::setw( 12 ) << std::setprecision( 5 ) << energy
+                    << "  mean energy = " << std::setw( 12 ) << meanEnergySearch << std::setw( 12 ) << meanEnergyAlias
+                    << "  mean mu = " << std::setw( 12 ) << meanMuSearch << std::setw( 12 ) << meanMuAlias << std::endl;
+        }
+    }
+    printTime( "    sample: ", time1 );
+
+    double secondsSearch = (double) sampleTimeSearch / CLOCKS_PER_SEC, secondsAlias = (double) sampleTimeAlias / CLOCKS_PER_SEC;
+    std::cout << std::endl;
+    std::cout << "    binary search sampling: " << std::setprecision( 4 ) << secondsSearch << " s  "
+            << ( secondsSearch > 0.0 ? sampled / secondsSearch : 0.0 ) << " samples/s" << std::endl;
+    std::cout << "    alias table sampling:   " << secondsAlias << " s  "
+            << ( secondsAlias > 0.0 ? sampled / secondsAlias : 0.0 ) << " samples/s" << std::endl;
+    if( secondsAlias > 0.0 ) std::cout << "    speedup = " << std::setprecision( 3 ) << secondsSearch / secondsAlias << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtareSearch;
+    delete MCProtareAlias;
+}
+/*
+=========================================================
+*/
+long sampleMeans( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                double &a_meanEnergy, double &a_meanMu, clock_t &a_sampleTime ) {
+
+    MCGIDI::Reaction const *reaction = a_protare->reaction( a_reactionIndex );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products;
+    std::vector<MCGIDI::Sampling::Product> neutrons;
+    clock_t time1 = clock( );
+
+    for( long sampleIndex = 0; sampleIndex < a_numberOfSamples; ++sampleIndex ) {
+        products.clear( );
+        reaction->sampleProducts( a_protare, a_energy, input, myRNG, nullptr, products );
+        for( std::size_t i1 = 0; i1 < products.size( ); ++i1 ) {
+            if( products[i1].m_productIndex == a_neutronIndex ) neutrons.push_back( products[i1] );
+        }
+    }
+    a_sampleTime += clock( ) - time1;
+
+    a_meanEnergy = 0.0;
+    a_meanMu = 0.0;
+    for( std::size_t i1 = 0; i1 < neutrons.size( ); ++i1 ) {
+        MCGIDI::Sampling::Product const &neutron = neutrons[i1];
+        double speed = sqrt( neutron.m_px_vx * neutron.m_px_vx + neutron.m_py_vy * neutron.m_py_vy + neutron.m_pz_vz * neutron.m_pz_vz );
+
+        a_meanEnergy += neutron.m_kineticEnergy;
+        if( speed > 0.0 ) a_meanMu += neutron.m_pz_vz / speed;
+    }
+    if( neutrons.size( ) > 0 ) {
+        a_meanEnergy /= neutrons.size( );
+        a_meanMu /= neutrons.size( );
+    }
+
+    return( (long) neutrons.size( ) );
+}
@@ -0,0 +1,145 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times sampling of the distributions of the products of each reaction via the virtual Distribution::sample method and via
+    Distributions::sampleDistribution, which dispatches on the distribution's type. Below the distribution level, both paths use
+    the type dispatch unless MCGIDI was compiled with MCGIDI_VirtualDispatch defined, in which case all calls are virtual. The
+    full gain is the ratio of the sampleProducts speeds of this program built with and without MCGIDI_VirtualDispatch. The target
+    can be given as the first argument (default O16).
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+    std::string target( "O16" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+#ifdef MCGIDI_VirtualDispatch
+    std::cout << "    compiled with MCGIDI_VirtualDispatch" << std::endl;
+#endif
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    std::vector<MCGIDI::Distributions::Distribution const *> distributions;
+    std::vector<double> thresholds;
+    int numberOfReactions = (int) MCProtare->numberOfReactions( );
+
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Vector<MCGIDI::Product *> const &products = MCProtare->reaction( reactionIndex )->outputChannel( ).products( );
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        if( threshold < 1e-11 ) threshold = 1e-11;
+        for( MCGIDI_VectorSizeType i1 = 0; i1 < products.size( ); ++i1 ) {
+            MCGIDI::Distributions::Distribution const *distribution = products[i1]->distribution( );
+            MCGIDI::Distributions::Type type = MCGIDI::Distributions::DistributionType( distribution );
+
+            if( ( type == MCGIDI::Distributions::Type::none ) || ( type == MCGIDI::Distributions::Type::unspecified ) ) continue;
+            distributions.push_back( distribution );
+            thresholds.push_back( threshold );
+        }
+    }
+    std::cout << "    number of distributions = " << distributions.size( ) << std::endl;
+
+    double sum = 0.0;
+    time1 = clock( );
+    for( std::size_t i1 = 0; i1 < distributions.size( ); ++i1 ) {
+        double logEnergyRange = log( 20.0 / thresholds[i1] );
+
+        for( long sampleIndex = 0; sampleIndex < numberOfSamples; ++sampleIndex ) {
+            double energy = thresholds[i1] * exp( logEnergyRange * myRNG( nullptr ) );
+
+            distributions[i1]->sample( energy, input, myRNG, nullptr );
+            sum += input.m_energyOut1;
+        }
+    }
+    printSpeeds( "Distribution::sample", time1, numberOfSamples * (long) distributions.size( ) );
+    std::cout << "    mean energy out = " << std::setprecision( 6 ) << sum / ( numberOfSamples * (double) distributions.size( ) ) << std::endl;
+
+    sum = 0.0;
+    time1 = clock( );
+    for( std::size_t i1 = 0; i1 < distributions.size( ); ++i1 ) {
+        double logEnergyRange = log( 20.0 / thresholds[i1] );
+
+        for( long sampleIndex = 0; sampleIndex < numberOfSamples; ++sampleIndex ) {
+            double energy = thresholds[i1] * exp( logEnergyRange * myRNG( nullptr ) );
+
+            MCGIDI::Distributions::sampleDistribution( distributions[i1], energy, input, myRNG, nullptr );
+            sum += input.m_energyOut1;
+        }
+    }
+    printSpeeds( "sampleDistribution", time1, numberOfSamples * (long) distributions.size( ) );
+    std::cout << "    mean energy out = " << std::setprecision( 6 ) << sum / ( numberOfSamples * (double) distributions.size( ) ) << std::endl;
+
+    MCGIDI::Sampling::StdVectorProductHandler products;
+    long sampled = 0;
+    time1 = clock( );
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = MCProtare->reaction( reactionIndex );
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        if( threshold < 1e-11 ) threshold = 1e-11;
+        double logEnergyRange = log( 20.0 / threshold );
+        for( long sampleIndex = 0; sampleIndex < numberOfSamples / 10; ++sampleIndex ) {
+            double energy = threshold * exp( logEnergyRange * myRNG( nullptr ) );
+
+            products.clear( );
+            reaction->sampleProducts( MCProtare, energy, input, myRNG, nullptr, products );
+        }
+        sampled += numberOfSamples / 10;
+    }
+    printSpeeds( "sampleProducts", time1, sampled );
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
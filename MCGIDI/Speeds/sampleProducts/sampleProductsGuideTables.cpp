@@ -0,0 +1,106 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times product sampling of tabulated (pdf/cdf) distributions for several guide table factors (number of guide table intervals
+    per cdf bin, 0 means no guide tables and a full binary search of the cdf). For each factor, the memory size of the protare and
+    the mean outgoing neutron energy, which should not depend on the factor beyond round off, are printed. The target can be given
+    as the first argument (default O16).
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 100 * 1000;
+    int neutronIndex = pops[PoPI::IDs::neutron];
+    double guideTableFactors[] = { 0.0, 0.5, 1.0, 4.0 };
+    std::string target( "O16" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products;
+
+    for( std::size_t factorIndex = 0; factorIndex < sizeof( guideTableFactors ) / sizeof( guideTableFactors[0] ); ++factorIndex ) {
+        MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+        MC.guideTableFactor( guideTableFactors[factorIndex] );
+
+        MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        std::cout << "    guide table factor = " << guideTableFactors[factorIndex] << "  memory = " << MCProtare->memorySize( ) << std::endl;
+        time1 = clock( );
+
+        int numberOfReactions = (int) MCProtare->numberOfReactions( );
+        long sampled = 0, numberOfNeutrons = 0;
+        double meanEnergy = 0.0;
+
+        for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+            MCGIDI::Reaction const *reaction = MCProtare->reaction( reactionIndex );
+            double threshold = MCProtare->threshold( reactionIndex );
+
+            if( threshold < 1e-12 ) threshold = 1e-12;
+            for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+                for( long sampleIndex = 0; sampleIndex < numberOfSamples; ++sampleIndex ) {
+                    products.clear( );
+                    reaction->sampleProducts( MCProtare, energy, input, myRNG, nullptr, products );
+                    for( std::size_t i1 = 0; i1 < products.size( ); ++i1 ) {
+                        if( products[i1].m_productIndex != neutronIndex ) continue;
+                        meanEnergy += products[i1].m_kineticEnergy;
+                        ++numberOfNeutrons;
+                    }
+                }
+                sampled += numberOfSamples;
+            }
+        }
+        printSpeeds( "        sampleProducts", time1, sampled );
+        if( numberOfNeutrons > 0 ) meanEnergy /= numberOfNeutrons;
+        std::cout << "        mean neutron energy = " << std::setprecision( 6 ) << meanEnergy << std::endl;
+
+        delete MCProtare;
+    }
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+}
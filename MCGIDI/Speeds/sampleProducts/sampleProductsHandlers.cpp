@@ -0,0 +1,150 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Compares the product sampling throughput of the product handlers: StdVectorProductHandler, MCGIDIVectorProductHandler and
+    ProductBankHandler. The handlers are cleared before each collision except for the bank of ProductBankHandler which is also
+    timed accumulating the products of many collisions (as an event based code would) and cleared when full. For each handler the mean
+    product energy is printed and should agree within statistics. The target can be given as the first argument (default O16).
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+#define bankCapacity 100000
+
+void main2( int argc, char **argv );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+    std::string target( "O16" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    int numberOfReactions = (int) MCProtare->numberOfReactions( );
+    std::vector<int> reactionIndices( numberOfSamples );
+    std::vector<double> energies( numberOfSamples );
+
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {           // Same collisions for all handlers.
+        int reactionIndex = (int) ( numberOfReactions * myRNG( nullptr ) );
+        if( reactionIndex == numberOfReactions ) --reactionIndex;
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        if( threshold < 1e-11 ) threshold = 1e-11;
+        reactionIndices[i1] = reactionIndex;
+        energies[i1] = threshold * pow( 20.0 / threshold, myRNG( nullptr ) );
+    }
+
+    MCGIDI::Sampling::StdVectorProductHandler stdVectorProducts;
+    double sum = 0.0;
+    long numberOfProducts = 0;
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        stdVectorProducts.clear( );
+        MCProtare->reaction( reactionIndices[i1] )->sampleProducts( MCProtare, energies[i1], input, myRNG, nullptr, stdVectorProducts );
+        for( std::size_t i2 = 0; i2 < stdVectorProducts.size( ); ++i2 ) sum += stdVectorProducts[i2].m_kineticEnergy;
+        numberOfProducts += stdVectorProducts.size( );
+    }
+    printSpeeds( "StdVectorProductHandler", time1, numberOfSamples );
+    std::cout << "    mean product energy = " << std::setprecision( 6 ) << sum / numberOfProducts << std::endl;
+
+    MCGIDI::Sampling::MCGIDIVectorProductHandler MCGIDIVectorProducts;
+    sum = 0.0;
+    numberOfProducts = 0;
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        MCGIDIVectorProducts.clear( );
+        MCProtare->reaction( reactionIndices[i1] )->sampleProducts( MCProtare, energies[i1], input, myRNG, nullptr, MCGIDIVectorProducts );
+        for( std::size_t i2 = 0; i2 < MCGIDIVectorProducts.size( ); ++i2 ) sum += MCGIDIVectorProducts[i2].m_kineticEnergy;
+        numberOfProducts += MCGIDIVectorProducts.size( );
+    }
+    printSpeeds( "MCGIDIVectorProductHandler", time1, numberOfSamples );
+    std::cout << "    mean product energy = " << std::setprecision( 6 ) << sum / numberOfProducts << std::endl;
+
+    std::vector<int> productIndices( bankCapacity ), userProductIndices( bankCapacity );
+    std::vector<double> kineticEnergies( bankCapacity ), px_vx( bankCapacity ), py_vy( bankCapacity ), pz_vz( bankCapacity );
+    MCGIDI::Sampling::ProductBankHandler bankProducts( bankCapacity, productIndices.data( ), userProductIndices.data( ), kineticEnergies.data( ),
+            px_vx.data( ), py_vy.data( ), pz_vz.data( ) );
+    sum = 0.0;
+    numberOfProducts = 0;
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        bankProducts.clear( );
+        MCProtare->reaction( reactionIndices[i1] )->sampleProducts( MCProtare, energies[i1], input, myRNG, nullptr, bankProducts );
+        for( std::size_t i2 = 0; i2 < bankProducts.size( ); ++i2 ) sum += kineticEnergies[i2];
+        numberOfProducts += bankProducts.size( );
+    }
+    printSpeeds( "ProductBankHandler", time1, numberOfSamples );
+    std::cout << "    mean product energy = " << std::setprecision( 6 ) << sum / numberOfProducts << std::endl;
+
+    std::size_t numberOfOverflows = 0;
+    sum = 0.0;
+    numberOfProducts = 0;
+    bankProducts.clear( );
+    time1 = clock( );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        MCProtare->reaction( reactionIndices[i1] )->sampleProducts( MCProtare, energies[i1], input, myRNG, nullptr, bankProducts );
+        if( bankProducts.size( ) + 100 > bankProducts.capacity( ) ) {          // Consume the bank as an event based code would.
+            for( std::size_t i2 = 0; i2 < bankProducts.size( ); ++i2 ) sum += kineticEnergies[i2];
+            numberOfProducts += bankProducts.size( );
+            numberOfOverflows += bankProducts.numberOfOverflows( );
+            bankProducts.clear( );
+        }
+    }
+    for( std::size_t i2 = 0; i2 < bankProducts.size( ); ++i2 ) sum += kineticEnergies[i2];
+    numberOfProducts += bankProducts.size( );
+    numberOfOverflows += bankProducts.numberOfOverflows( );
+    printSpeeds( "ProductBankHandler (bank)", time1, numberOfSamples );
+    std::cout << "    mean product energy = " << std::setprecision( 6 ) << sum / numberOfProducts << "  overflows = " << numberOfOverflows << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+}
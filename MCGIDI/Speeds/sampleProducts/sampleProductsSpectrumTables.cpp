@@ -0,0 +1,152 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times product sampling of the Watt, simple Maxwellian fission and evaporation spectra with their analytic sampling and with
+    inverse cdf tables. For each reaction and incident energy, the mean outgoing neutron energy and mu of the two protares are printed
+    and should agree within statistics and the tolerance. The target can be given as the first argument (default U233) and the
+    spectrum table tolerance as the second argument (default 1e-3).
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+long sampleMeans( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                double &a_meanEnergy, double &a_meanMu, clock_t &a_sampleTime );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1, sampleTimeAnalytic = 0, sampleTimeTable = 0;
+    long numberOfSamples = 100 * 1000, sampled = 0;
+    int neutronIndex = pops[PoPI::IDs::neutron];
+    std::string target( "U233" );
+    double tolerance = 1e-3;
+
+    if( argc > 1 ) target = argv[1];
+    if( argc > 2 ) tolerance = atof( argv[2] );
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::Protare *MCProtareAnalytic = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MC.spectrumTableTolerance( tolerance );
+    MCGIDI::Protare *MCProtareTable = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI with spectrum tables: ", time1 );
+
+    std::cout << "    tolerance = " << tolerance << "  memory without spectrum tables = " << MCProtareAnalytic->memorySize( )
+            << "  with spectrum tables = " << MCProtareTable->memorySize( ) << std::endl;
+
+    int numberOfReactions = (int) MCProtareAnalytic->numberOfReactions( );
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = MCProtareAnalytic->reaction( reactionIndex );
+        double threshold = MCProtareAnalytic->threshold( reactionIndex );
+
+        std::cout << "    reaction " << reactionIndex << "  " << reaction->label( ).c_str( ) << std::endl;
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            double meanEnergyAnalytic, meanMuAnalytic, meanEnergyTable, meanMuTable;
+
+            long numberOfNeutrons = sampleMeans( MCProtareAnalytic, reactionIndex, energy, numberOfSamples, neutronIndex, meanEnergyAnalytic, 
+                    meanMuAnalytic, sampleTimeAnalytic );
+            sampleMeans( MCProtareTable, reactionIndex, energy, numberOfSamples, neutronIndex, meanEnergyTable, meanMuTable, sampleTimeTable );
+            sampled += numberOfSamples;
+            if( numberOfNeutrons == 0 ) continue;
+
+            std::cout << "        energy = " << std::setw( 12 ) << std::setprecision( 5 ) << energy
+                    << "  mean energy = " << std::setw( 12 ) << meanEnergyAnalytic << std::setw( 12 ) << meanEnergyTable
+                    << "  mean mu = " << std::setw( 12 ) << meanMuAnalytic << std::setw( 12 ) << meanMuTable << std::endl;
+        }
+    }
+    printTime( "    sample: ", time1 );
+
+    double secondsAnalytic = (double) sampleTimeAnalytic / CLOCKS_PER_SEC, secondsTable = (double) sampleTimeTable / CLOCKS_PER_SEC;
+    std::cout << std::endl;
+    std::cout << "    analytic sampling:       " << std::setprecision( 4 ) << secondsAnalytic << " s  "
+            << ( secondsAnalytic > 0.0 ? sampled / secondsAnalytic : 0.0 ) << " samples/s" << std::endl;
+    std::cout << "    spectrum table sampling: " << secondsTable << " s  "
+            << ( secondsTable > 0.0 ? sampled / secondsTable : 0.0 ) << " samples/s" << std::endl;
+    if( secondsTable > 0.0 ) std::cout << "    speedup = " << std::setprecision( 3 ) << secondsAnalytic / secondsTable << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtareAnalytic;
+    delete MCProtareTable;
+}
+/*
+=========================================================
+*/
+long sampleMeans( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                double &a_meanEnergy, double &a_meanMu, clock_t &a_sampleTime ) {
+
+    MCGIDI::Reaction const *reaction = a_protare->reaction( a_reactionIndex );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products;
+    std::vector<MCGIDI::Sampling::Product> neutrons;
+    clock_t time1 = clock( );
+
+    for( long sampleIndex = 0; sampleIndex < a_numberOfSamples; ++sampleIndex ) {
+        products.clear( );
+        reaction->sampleProducts( a_protare, a_energy, input, myRNG, nullptr, products );
+        for( std::size_t i1 = 0; i1 < products.size( ); ++i1 ) {
+            if( products[i1].m_productIndex == a_neutronIndex ) neutrons.push_back( products[i1] );
+        }
+    }
+    a_sampleTime += clock( ) - time1;
+
+    a_meanEnergy = 0.0;
+    a_meanMu = 0.0;
+    for( std::size_t i1 = 0; i1 < neutrons.size( ); ++i1 ) {
+        MCGIDI::Sampling::Product const &neutron = neutrons[i1];
+        double speed = sqrt( neutron.m_px_vx * neutron.m_px_vx + neutron.m_py_vy * neutron.m_py_vy + neutron.m_pz_vz * neutron.m_pz_vz );
+
+        a_meanEnergy += neutron.m_kineticEnergy;
+        if( speed > 0.0 ) a_meanMu += neutron.m_pz_vz / speed;
+    }
+    if( neutrons.size( ) > 0 ) {
+        a_meanEnergy /= neutrons.size( );
+        a_meanMu /= neutrons.size( );
+    }
+
+    return( (long) neutrons.size( ) );
+}
@@ -0,0 +1,112 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Times product sampling with the default interpolation of tabulated distributions (both bracketing incident energy
+    distributions are sampled and the results interpolated) and with stochastic interpolation (one bracketing distribution is
+    sampled, chosen by the interpolation fraction). The statistical comparison of the two modes is done by
+    MCGIDI/Test/sampleProducts/sampleProductsStochasticInterpolation.cpp. The target can be given as the first argument (default O16).
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+void sampleReaction( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, clock_t &a_sampleTime );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1, sampleTimeDefault = 0, sampleTimeStochastic = 0;
+    long numberOfSamples = 100 * 1000, sampled = 0;
+    std::string target( "O16" );
+
+    if( argc > 1 ) target = argv[1];
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, target );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+
+    MC.wantStochasticInterpolation( true );
+    MCGIDI::Protare *MCProtareStochastic = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    int numberOfReactions = (int) MCProtare->numberOfReactions( );
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            sampleReaction( MCProtare, reactionIndex, energy, numberOfSamples, sampleTimeDefault );
+            sampleReaction( MCProtareStochastic, reactionIndex, energy, numberOfSamples, sampleTimeStochastic );
+            sampled += numberOfSamples;
+        }
+    }
+    printTime( "    sample: ", time1 );
+
+    double secondsDefault = (double) sampleTimeDefault / CLOCKS_PER_SEC, secondsStochastic = (double) sampleTimeStochastic / CLOCKS_PER_SEC;
+    std::cout << std::endl;
+    std::cout << "    default sampling:    " << std::setprecision( 4 ) << secondsDefault << " s  "
+            << ( secondsDefault > 0.0 ? sampled / secondsDefault : 0.0 ) << " samples/s" << std::endl;
+    std::cout << "    stochastic sampling: " << secondsStochastic << " s  "
+            << ( secondsStochastic > 0.0 ? sampled / secondsStochastic : 0.0 ) << " samples/s" << std::endl;
+    if( secondsStochastic > 0.0 ) std::cout << "    speedup = " << std::setprecision( 3 ) << secondsDefault / secondsStochastic << std::endl;
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareStochastic;
+}
+/*
+=========================================================
+*/
+void sampleReaction( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, clock_t &a_sampleTime ) {
+
+    MCGIDI::Reaction const *reaction = a_protare->reaction( a_reactionIndex );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products;
+    clock_t time1 = clock( );
+
+    for( long sampleIndex = 0; sampleIndex < a_numberOfSamples; ++sampleIndex ) {
+        products.clear( );
+        reaction->sampleProducts( a_protare, a_energy, input, myRNG, nullptr, products );
+    }
+    a_sampleTime += clock( ) - time1;
+}
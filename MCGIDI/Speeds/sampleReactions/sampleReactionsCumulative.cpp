@@ -0,0 +1,117 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static long samples( char const *a_label, MCGIDI::Protare *a_protare, MCGIDI::DomainHash const &a_domainHash, long a_numberOfSamples );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+    std::string targetID( "O16" );
+
+    printCommandLine( __FILE__, argc, argv );
+
+    if( argc > 1 ) targetID = argv[1];                  // Cumulative tables help most for targets with many reactions (e.g., U238).
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::atomicOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, "n", targetID );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, "n", &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MC.wantCumulativeReactionCrossSections( true );
+    MCGIDI::Protare *MCProtareCumulative = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI (cumulative reaction cross sections): ", time1 );
+
+    std::cout << "    number of reactions = " << MCProtare->numberOfReactions( ) << std::endl;
+    std::cout << "    memory = " << MCProtare->memorySize( ) << "  memory (cumulative) = " << MCProtareCumulative->memorySize( ) << std::endl;
+
+    long sampled = samples( "linear search", MCProtare, domainHash, numberOfSamples );
+    long sampledCumulative = samples( "cumulative binary search", MCProtareCumulative, domainHash, numberOfSamples );
+
+    printTime( "    total: ", time0 );
+
+    std::cout << "total sampled = " << sampled + sampledCumulative << "  (" << std::setprecision( 3 ) << (double) ( sampled + sampledCumulative ) << ")" << std::endl;
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareCumulative;
+}
+/*
+=========================================================
+*/
+static long samples( char const *a_label, MCGIDI::Protare *a_protare, MCGIDI::DomainHash const &a_domainHash, long a_numberOfSamples ) {
+
+    long sampleTemperatures = 0, sampleEnergies = 0, reactionIndexSum = 0;
+    clock_t time1 = clock( );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::cout << std::endl << "    " << a_label << std::endl;
+    for( double temperature = 1e-8; temperature < 2e-3; temperature *= 10.1, ++sampleTemperatures ) {
+        clock_t time1_1 = clock( );
+        clock_t time2_1 = time1_1;
+
+        long energyIndex = 0;
+        for( double energy = 1e-12; energy < 100.1; energy *= 10.0, ++energyIndex ) {
+            int hashIndex = a_domainHash.index( energy );
+            double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+
+            for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) 
+                reactionIndexSum += a_protare->sampleReaction( URR_protare_infos, hashIndex, temperature, energy, crossSection, myRNG, nullptr );
+            printTime_energy( "            energies: ", energyIndex, energy, time2_1 );
+        }
+        sampleEnergies = energyIndex;
+        std::cout << std::endl;
+        printTime_double( "        temperature: ", temperature, time1_1 );
+    }
+
+    long sampled = sampleTemperatures * sampleEnergies * a_numberOfSamples;
+
+    printSpeeds( a_label, time1, sampled );
+    printTime( "    sample: ", time1 );
+    std::cout << "    reaction index sum = " << reactionIndexSum << std::endl;
+
+    return( sampled );
+}
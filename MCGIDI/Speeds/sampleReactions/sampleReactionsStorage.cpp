@@ -0,0 +1,134 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+/*
+    Tallies sampled reactions at fixed energies with a fixed random number seed and compares the tallies to the reaction probabilities. The
+    output of a default build can be diffed with the output of a build with MCGIDI_FloatStorage defined to quantify the effect of storing the
+    continuous energy tables as float.
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+
+#include "MCGIDI.hpp"
+
+#include "utilities4Speed.hpp"
+
+void main2( int argc, char **argv );
+static void tallies( char const *a_label, MCGIDI::Protare *a_protare, MCGIDI::DomainHash const &a_domainHash, double a_temperature, long a_numberOfSamples );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    exit( speedMain( argc, argv, main2 ) );
+}
+/*
+=========================================================
+*/
+void main2( int argc, char **argv ) {
+
+    std::string mapFilename( "../../../GIDI/Test/all3T.map" );
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Map::Map map( mapFilename, pops );
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    clock_t time0, time1;
+    long numberOfSamples = 1000 * 1000;
+
+    printCommandLine( __FILE__, argc, argv );
+
+    GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::atomicOnly );
+    time0 = clock( );
+    time1 = time0;
+    GIDI::Protare *protare = map.protare( construction, pops, PoPI::IDs::neutron, "O16" );
+    printTime( "    load GIDI: ", time1 );
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 100.0 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI: ", time1 );
+
+    MC.wantCumulativeReactionCrossSections( true );
+    MCGIDI::Protare *MCProtareCumulative = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+    printTime( "    load MCGIDI (cumulative reaction cross sections): ", time1 );
+
+    std::cout << "    sizeof( MCGIDI_StorageType ) = " << sizeof( MCGIDI_StorageType ) << std::endl;
+    std::cout << "    memory = " << MCProtare->memorySize( ) << "  memory (cumulative) = " << MCProtareCumulative->memorySize( ) << std::endl;
+
+    double temperature = temperatures[0].temperature( ).value( );
+    if( temperatures.size( ) > 1 ) temperature = 0.5 * ( temperature + temperatures[1].temperature( ).value( ) );
+
+    tallies( "per reaction cross sections", MCProtare, domainHash, temperature, numberOfSamples );
+    tallies( "cumulative reaction cross sections", MCProtareCumulative, domainHash, temperature, numberOfSamples );
+
+    printTime( "    total: ", time0 );
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareCumulative;
+}
+/*
+=========================================================
+*/
+static void tallies( char const *a_label, MCGIDI::Protare *a_protare, MCGIDI::DomainHash const &a_domainHash, double a_temperature, long a_numberOfSamples ) {
+
+    int numberOfReactions = static_cast<int>( a_protare->numberOfReactions( ) );
+    std::vector<long> counts( numberOfReactions );
+    double maximumDeviation = 0.0, chiSquaredSum = 0.0;
+    long degreesOfFreedom = 0;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    srand48( 1 );
+    std::cout << std::endl << "    " << a_label << std::endl;
+    for( double energy = 1e-11; energy < 20.0; energy *= 4.3 ) {
+        int hashIndex = a_domainHash.index( energy );
+        double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy, true );
+        double chiSquared = 0.0, deviation = 0.0;
+        int reactions = 0;
+
+        for( int i1 = 0; i1 < numberOfReactions; ++i1 ) counts[i1] = 0;
+        for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+            ++counts[a_protare->sampleReaction( URR_protare_infos, hashIndex, a_temperature, energy, crossSection, myRNG, nullptr )];
+        }
+
+        for( int i1 = 0; i1 < numberOfReactions; ++i1 ) {           // Pearson's chi-squared of the tallies relative to the reaction probabilities.
+            double expected = a_numberOfSamples * a_protare->reactionCrossSection( i1, URR_protare_infos, hashIndex, a_temperature, energy, true ) / crossSection;
+
+            if( expected <= 0.0 ) continue;
+            double difference = counts[i1] - expected;
+            chiSquared += difference * difference / expected;
+            if( fabs( difference ) / sqrt( expected ) > deviation ) deviation = fabs( difference ) / sqrt( expected );
+            ++reactions;
+        }
+        if( reactions > 1 ) {
+            chiSquaredSum += chiSquared;
+            degreesOfFreedom += reactions - 1;
+        }
+        if( deviation > maximumDeviation ) maximumDeviation = deviation;
+
+        std::cout << "        energy = " << std::setw( 12 ) << std::setprecision( 6 ) << energy << "  cross section = " << std::setw( 20 ) << std::setprecision( 14 )
+                << crossSection << "  reactions = " << std::setw( 3 ) << reactions << "  chi-squared = " << std::setw( 10 ) << std::setprecision( 5 ) << chiSquared
+                << "  maximum deviation (sigma) = " << std::setprecision( 4 ) << deviation << std::endl;
+    }
+
+    if( degreesOfFreedom == 0 ) degreesOfFreedom = 1;
+    std::cout << "    chi-squared per degree of freedom = " << std::setprecision( 5 ) << chiSquaredSum / degreesOfFreedom
+            << "  maximum deviation (sigma) = " << std::setprecision( 4 ) << maximumDeviation << std::endl;
+}
@@ -19,6 +19,8 @@ namespace MCGIDI {
 
 class Protare;
 class ProtareSingle;
+class HeatedReactionCrossSectionContinuousEnergy;
+class HeatedCrossSectionContinuousEnergy;
 class Reaction;
 class OutputChannel;
 
@@ -87,6 +89,16 @@ class MC : public GIDI::Transporting::Settings {
         bool m_want_URR_probabilityTables;
         bool m_wantTerrellPromptNeutronDistribution;
         std::vector<double> m_fixedGridPoints;
+        bool m_fixedGridEqualLethargy;                                                     /**< If true, *m_fixedGridPoints* is an equal-lethargy grid set by **equalLethargyFixedGrid**. */
+        bool m_wantUnionizedGrid;                                                          /**< If true, a ProtareComposite builds a unionized energy grid over its protares (faster lookups, more memory). */
+        bool m_wantPackedReactionCrossSections;                                            /**< If true, continuous energy reaction cross sections are stored in one energy major table. */
+        bool m_wantCumulativeReactionCrossSections;                                        /**< If true, a table of cumulative continuous energy reaction cross sections is stored for faster reaction sampling. */
+        bool m_wantOnTheFlyDopplerBroadening;                                              /**< If true, only the lowest temperature continuous energy data are stored and are Doppler broadened at lookup time. */
+        double m_gridThinningTolerance;                                                    /**< If positive, the continuous energy grid of each temperature is thinned to this relative tolerance. */
+        bool m_wantStochasticInterpolation;                                                /**< If true, tabulated distributions are sampled from one bracketing incident energy chosen by the interpolation fraction. */
+        bool m_wantAliasTables;                                                            /**< If true, alias tables are built for the pdf/cdf probabilities that are sampled independently of other probabilities. */
+        double m_guideTableFactor;                                                         /**< If positive, guide tables with this many entries per cdf bin are built for the pdf/cdf probabilities. */
+        double m_spectrumTableTolerance;                                                   /**< If positive, Watt, simple Maxwellian fission and evaporation spectra are sampled from inverse cdf tables built to this tolerance. */
 
     public:
         MC( PoPI::Database const &a_pops, std::string const &a_projectileID, GIDI::Styles::Suite const *a_styles, std::string const &a_label, GIDI::Transporting::DelayedNeutrons a_delayedNeutrons, double energyDomainMax );
@@ -124,7 +136,36 @@ class MC : public GIDI::Transporting::Settings {
         void wantTerrellPromptNeutronDistribution( bool a_wantTerrellPromptNeutronDistribution ) { m_wantTerrellPromptNeutronDistribution = a_wantTerrellPromptNeutronDistribution; }
 
         std::vector<double> fixedGridPoints( ) const { return( m_fixedGridPoints ); }
-        void fixedGridPoints( std::vector<double> a_fixedGridPoints ) { m_fixedGridPoints = a_fixedGridPoints; }
+        void fixedGridPoints( std::vector<double> a_fixedGridPoints ) { m_fixedGridPoints = a_fixedGridPoints; m_fixedGridEqualLethargy = false; }
+        bool fixedGridEqualLethargy( ) const { return( m_fixedGridEqualLethargy ); }       /**< Returns the value of the **m_fixedGridEqualLethargy**. */
+        void equalLethargyFixedGrid( double a_energyMin, double a_energyMax, int a_numberOfPoints );
+
+        bool wantUnionizedGrid( ) const { return( m_wantUnionizedGrid ); }                 /**< Returns the value of the **m_wantUnionizedGrid**. */
+        void wantUnionizedGrid( bool a_wantUnionizedGrid ) { m_wantUnionizedGrid = a_wantUnionizedGrid; }
+
+        bool wantPackedReactionCrossSections( ) const { return( m_wantPackedReactionCrossSections ); }     /**< Returns the value of the **m_wantPackedReactionCrossSections**. */
+        void wantPackedReactionCrossSections( bool a_wantPackedReactionCrossSections ) { m_wantPackedReactionCrossSections = a_wantPackedReactionCrossSections; }
+
+        bool wantCumulativeReactionCrossSections( ) const { return( m_wantCumulativeReactionCrossSections ); }     /**< Returns the value of the **m_wantCumulativeReactionCrossSections**. */
+        void wantCumulativeReactionCrossSections( bool a_wantCumulativeReactionCrossSections ) { m_wantCumulativeReactionCrossSections = a_wantCumulativeReactionCrossSections; }
+
+        bool wantOnTheFlyDopplerBroadening( ) const { return( m_wantOnTheFlyDopplerBroadening ); }     /**< Returns the value of the **m_wantOnTheFlyDopplerBroadening**. */
+        void wantOnTheFlyDopplerBroadening( bool a_wantOnTheFlyDopplerBroadening ) { m_wantOnTheFlyDopplerBroadening = a_wantOnTheFlyDopplerBroadening; }
+
+        double gridThinningTolerance( ) const { return( m_gridThinningTolerance ); }       /**< Returns the value of the **m_gridThinningTolerance**. */
+        void gridThinningTolerance( double a_gridThinningTolerance );
+
+        bool wantStochasticInterpolation( ) const { return( m_wantStochasticInterpolation ); }     /**< Returns the value of the **m_wantStochasticInterpolation**. */
+        void wantStochasticInterpolation( bool a_wantStochasticInterpolation ) { m_wantStochasticInterpolation = a_wantStochasticInterpolation; }
+
+        bool wantAliasTables( ) const { return( m_wantAliasTables ); }                     /**< Returns the value of the **m_wantAliasTables**. */
+        void wantAliasTables( bool a_wantAliasTables ) { m_wantAliasTables = a_wantAliasTables; }
+
+        double guideTableFactor( ) const { return( m_guideTableFactor ); }                 /**< Returns the value of the **m_guideTableFactor**. */
+        void guideTableFactor( double a_guideTableFactor );
+
+        double spectrumTableTolerance( ) const { return( m_spectrumTableTolerance ); }     /**< Returns the value of the **m_spectrumTableTolerance**. */
+        void spectrumTableTolerance( double a_spectrumTableTolerance );
 
         PoPI::Database const &pops( ) const { return( m_pops ); }                       /**< Returns a reference to **m_styles**. */
         int neutronIndex( ) const { return( m_neutronIndex ); }
@@ -257,6 +298,35 @@ HOST_DEVICE inline MCGIDI_VectorSizeType binarySearchVectorBounded( double a_x,
 namespace MCGIDI {
 
 enum class ChannelType { none, twoBody, uncorrelatedBodies };
+enum class DomainHashMode { logarithmic, exponentBits, equalPoints };
+
+/*
+============================================================
+===================== EnergyIndexHint ======================
+============================================================
+*/
+class EnergyIndexHint {
+
+    private:
+        int m_indices[2];                               /**< The last lower energy index found for the lower and upper temperature of a lookup, or -1 if not set. */
+        long m_lookups;                                 /**< The number of lookups that used *this*. */
+        long m_hits;                                    /**< The number of lookups where the last index was still correct. */
+        long m_walks;                                   /**< The number of lookups resolved by walking a few points from the last index. */
+
+    public:
+        HOST_DEVICE EnergyIndexHint( ) : m_lookups( 0 ), m_hits( 0 ), m_walks( 0 ) { reset( ); }
+
+        HOST_DEVICE void reset( ) { m_indices[0] = -1; m_indices[1] = -1; }                 /**< Clears the stored indices but not the statistics. */
+        HOST_DEVICE void resetStatistics( ) { m_lookups = 0; m_hits = 0; m_walks = 0; }     /**< Sets the statistics counters to 0. */
+        HOST_DEVICE int index( int a_slot ) const { return( m_indices[a_slot] ); }          /**< Returns the last index stored in slot *a_slot*. */
+        HOST_DEVICE void set( int a_slot, int a_index ) { m_indices[a_slot] = a_index; }    /**< Stores *a_index* in slot *a_slot*. */
+        HOST_DEVICE long lookups( ) const { return( m_lookups ); }                          /**< Returns the value of the **m_lookups**. */
+        HOST_DEVICE long hits( ) const { return( m_hits ); }                                /**< Returns the value of the **m_hits**. */
+        HOST_DEVICE long walks( ) const { return( m_walks ); }                              /**< Returns the value of the **m_walks**. */
+        HOST_DEVICE long misses( ) const { return( m_lookups - m_hits - m_walks ); }       /**< Returns the number of lookups that fell back to the hash. */
+
+        HOST_DEVICE int find( Vector<double> const &a_grid, double a_value, int a_slot );
+};
 
 /*
 ============================================================
@@ -266,24 +336,36 @@ enum class ChannelType { none, twoBody, uncorrelatedBodies };
 class DomainHash {
 
     private:
+        DomainHashMode m_mode;                                              /**< The hash strategy used by **index**. */
         int m_bins;                                                         /**< The number of bins for the hash. */
         double m_domainMin;                                                 /**< The minimum domain value for the hash. */
         double m_domainMax;                                                 /**< The maximum domain value for the hash. */
         double m_u_domainMin;                                               /**< The log of m_domainMin ). */
         double m_u_domainMax;                                               /**< The log of m_domainMax ). */
         double m_inverse_du;                                                /**< The value *m_bins* / ( *m_u_domainMax* - *m_u_domainMin* ). */
+        int m_mantissaBits;                                                 /**< For DomainHashMode::exponentBits, the number of leading mantissa bits used per bin. */
+        int m_bitsOffset;                                                   /**< For DomainHashMode::exponentBits, the shifted bits of *m_domainMin*. */
+        Vector<double> m_boundaries;                                        /**< For DomainHashMode::equalPoints, the *m_bins* + 1 bin boundaries. */
+
+        HOST_DEVICE void initializeExponentBits( int a_bins );
 
     public:
         HOST_DEVICE DomainHash( );
         HOST_DEVICE DomainHash( int a_bins, double a_domainMin, double a_domainMax );
+        HOST_DEVICE DomainHash( DomainHashMode a_mode, int a_bins, double a_domainMin, double a_domainMax );
+        HOST DomainHash( int a_bins, double a_domainMin, double a_domainMax, std::vector<double> const &a_grid );
         HOST_DEVICE DomainHash( DomainHash const &a_domainHash );
 
+        HOST_DEVICE DomainHashMode mode( ) const { return( m_mode ); }          /**< Returns the value of the **m_mode**. */
         HOST_DEVICE int bins( ) const { return( m_bins ); }                     /**< Returns the value of the **m_bins**. */
         HOST_DEVICE double domainMin( ) const { return( m_domainMin ); }        /**< Returns the value of the **m_domainMax**. */
         HOST_DEVICE double domainMax( ) const { return( m_domainMax ); }        /**< Returns the value of the **m_domainMax**. */
         HOST_DEVICE double u_domainMin( ) const { return( m_u_domainMin ); }    /**< Returns the value of the **m_u_domainMin**. */
         HOST_DEVICE double u_domainMax( ) const { return( m_u_domainMax ); }    /**< Returns the value of the **m_u_domainMax**. */
         HOST_DEVICE double inverse_du( ) const { return( m_inverse_du ); }      /**< Returns the value of the **m_inverse_du**. */
+        HOST_DEVICE int mantissaBits( ) const { return( m_mantissaBits ); }     /**< Returns the value of the **m_mantissaBits**. */
+        HOST_DEVICE int bitsOffset( ) const { return( m_bitsOffset ); }         /**< Returns the value of the **m_bitsOffset**. */
+        HOST_DEVICE Vector<double> const &boundaries( ) const { return( m_boundaries ); }   /**< Returns a reference to **m_boundaries**. */
 
         HOST_DEVICE int index( double a_domain ) const ;
         HOST_DEVICE Vector<int> map( Vector<double> &a_domainValues ) const ;
@@ -316,6 +398,7 @@ class MultiGroupHash {
             if( _index == -1 ) return( m_boundaries.size( ) - 2 );
             return( _index );
         }
+        HOST_DEVICE int index( double a_domain, EnergyIndexHint &a_energyIndexHint ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -352,15 +435,76 @@ class URR_protareInfos {
         HOST URR_protareInfos( Vector<Protare *> &a_protares );
 
         HOST void setup( Vector<Protare *> &a_protares );
+        HOST void setupSmooth( Vector<Protare *> const &a_protares );
 
         HOST_DEVICE MCGIDI_VectorSizeType size( ) const { return( m_URR_protareInfos.size( ) ); }
         HOST_DEVICE URR_protareInfo const &operator[]( MCGIDI_VectorSizeType a_index ) const { return( m_URR_protareInfos[a_index] ); }  /**< Returns the instance of *m_URR_protareInfos* at index *a_index*. */
         HOST_DEVICE void updateProtare( MCGIDI::Protare const *a_protare, double a_energy, double (*a_userrng)( void * ), void *a_rngState );
+        HOST_DEVICE static void updateProtareBatch( MCGIDI::Protare const *a_protare, int a_numberOfParticles, double const *a_energies, 
+                URR_protareInfos *a_URR_protareInfos, double (*a_userrng)( void * ), void *a_rngState );
 
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
         HOST_DEVICE long internalSize( ) const { return m_URR_protareInfos.internalSize( ); }
 };
 
+/*
+============================================================
+====================== URR_bandTables ======================
+============================================================
+*/
+class URR_bandTables {
+
+    private:
+        Interpolation m_energyInterpolation;            /**< The interpolation between the tables at two energies. */
+        Interpolation m_bandInterpolation;              /**< The interpolation of the factor within a band (i.e., between two cdf points). */
+        Vector<double> m_energies;                      /**< The energy grid shared by the URR probability tables of all reactions. Empty if *this* is not active. */
+        Vector<int> m_reactionSlots;                    /**< For each reaction, the index of its tables in *m_offsets* or -1 if the reaction has no URR probability tables. */
+        Vector<int> m_offsets;                          /**< For table slot * number of energies + energy index, the start of its data in *m_factors*, *m_pdfs* and *m_cdfs*. */
+        Vector<double> m_factors;                       /**< The cross section factors of all tables, flattened. */
+        Vector<double> m_pdfs;                          /**< The pdf of all tables, flattened. */
+        Vector<double> m_cdfs;                          /**< The cdf (i.e., band boundaries) of all tables, flattened. */
+
+        HOST_DEVICE double sampleTable( int a_table, double a_rngValue ) const ;
+
+    public:
+        HOST_DEVICE URR_bandTables( );
+        HOST void setup( Vector<HeatedReactionCrossSectionContinuousEnergy *> const &a_reactionCrossSections );
+
+        HOST_DEVICE bool active( ) const { return( m_energies.size( ) > 0 ); }    /**< Returns *true* if the flattened tables are present and *false* otherwise. */
+        HOST_DEVICE int energyIndex( double a_energy, double *a_energyFraction ) const ;
+        HOST_DEVICE double factor( int a_reactionIndex, int a_energyIndex, double a_energyFraction, double a_rngValue ) const ;
+        HOST_DEVICE double factor( int a_reactionIndex, double a_energy, double a_rngValue ) const ;
+
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+};
+
+/*
+============================================================
+==================== TemperatureContext ====================
+============================================================
+*/
+class TemperatureContext {
+
+    private:
+        int m_index1;                                   /**< The index of the lower bounding temperature. */
+        int m_index2;                                   /**< The index of the upper bounding temperature. Equal to *m_index1* if the temperature is outside the temperature range. */
+        double m_fraction;                              /**< The interpolation weight of the temperature at *m_index2*. */
+        double m_temperature;                           /**< The target temperature. */
+
+    public:
+        HOST_DEVICE TemperatureContext( ) : m_index1( 0 ), m_index2( 0 ), m_fraction( 0.0 ), m_temperature( 0.0 ) { }
+        HOST_DEVICE TemperatureContext( Vector<double> const &a_temperatures, double a_temperature );
+        HOST_DEVICE TemperatureContext( int a_index, double a_temperature ) : m_index1( a_index ), m_index2( a_index ), m_fraction( 0.0 ), m_temperature( a_temperature ) { }
+                /**< Constructor for data stored exactly at *a_temperature* at index *a_index* (i.e., no interpolation). */
+
+        HOST_DEVICE void set( Vector<double> const &a_temperatures, double a_temperature );
+        HOST_DEVICE int index1( ) const { return( m_index1 ); }                     /**< Returns the value of the **m_index1**. */
+        HOST_DEVICE int index2( ) const { return( m_index2 ); }                     /**< Returns the value of the **m_index2**. */
+        HOST_DEVICE double fraction( ) const { return( m_fraction ); }              /**< Returns the value of the **m_fraction**. */
+        HOST_DEVICE double temperature( ) const { return( m_temperature ); }        /**< Returns the value of the **m_temperature**. */
+        HOST_DEVICE bool interpolate( ) const { return( m_index1 != m_index2 ); }   /**< Returns *true* if data at two temperatures must be interpolated. */
+};
+
 /*
 ============================================================
 ======== HeatedReactionCrossSectionContinuousEnergy ========
@@ -371,12 +515,13 @@ class HeatedReactionCrossSectionContinuousEnergy {
     private:
         int m_offset;
         double m_threshold;
-        Vector<double> m_crossSection;                          // Reaction cross section
+        Vector<MCGIDI_StorageType> m_crossSection;              // Reaction cross section
+        int m_crossSectionSource;                               /**< If not negative, the index of the temperature whose identical cross section data are shared by *m_crossSection*. */
         Probabilities::ProbabilityBase2d *m_URR_probabilityTables;
 
     public:
         HOST_DEVICE HeatedReactionCrossSectionContinuousEnergy( );
-        HOST HeatedReactionCrossSectionContinuousEnergy( int a_offset, double a_threshold, Vector<double> &a_crossSection );
+        HOST HeatedReactionCrossSectionContinuousEnergy( int a_offset, double a_threshold, Vector<MCGIDI_StorageType> &a_crossSection );
         HOST HeatedReactionCrossSectionContinuousEnergy( double a_threshold, GIDI::Functions::Ys1d const &a_crossSection, Probabilities::ProbabilityBase2d *a_URR_probabilityTables );
 
         HOST_DEVICE double threshold( ) const { return( m_threshold ); }                            /**< Returns the value of the **m_threshold**. */
@@ -385,6 +530,7 @@ class HeatedReactionCrossSectionContinuousEnergy {
         HOST_DEVICE double URR_domainMin( ) const ;
         HOST_DEVICE double URR_domainMax( ) const ;
         HOST_DEVICE Probabilities::ProbabilityBase2d *URR_probabilityTables( ) const { return( m_URR_probabilityTables ); }             /**< Returns the value of the **m_URR_probabilityTables**. */
+        HOST double URR_maximumFactor( ) const ;
         HOST_DEVICE double crossSection( std::size_t a_index ) const {
             int index = static_cast<int>( a_index ) - m_offset;
             if( index < 0 ) return( 0.0 );
@@ -392,7 +538,13 @@ class HeatedReactionCrossSectionContinuousEnergy {
 
             return( m_crossSection[index] );
         }
-        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+        HOST_DEVICE Vector<MCGIDI_StorageType> const &crossSections( ) const { return( m_crossSection ); }   /**< Returns a reference to the **m_crossSection** member, which starts at energy index **m_offset**. */
+        HOST void releaseCrossSection( ) { Vector<MCGIDI_StorageType> empty; m_crossSection.swap( empty ); }  /**< Frees **m_crossSection**. Used when the data are stored in a packed table. */
+        HOST void thin( std::vector<int> const &a_newIndices );
+        HOST_DEVICE int crossSectionSource( ) const { return( m_crossSectionSource ); }            /**< Returns the value of the **m_crossSectionSource**. */
+        HOST bool shareCrossSection( HeatedReactionCrossSectionContinuousEnergy const &a_other, int a_source );
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode, HeatedCrossSectionContinuousEnergy * const *a_heatedCrossSections = nullptr, 
+                int a_reactionIndex = -1 );
 };
 
 /*
@@ -405,7 +557,7 @@ class ContinuousEnergyGain {
     private:
         int m_particleIndex;
         int m_userParticleIndex;
-        Vector<double> m_gain;
+        Vector<MCGIDI_StorageType> m_gain;
 
     public:
         ContinuousEnergyGain( );
@@ -416,8 +568,9 @@ class ContinuousEnergyGain {
         HOST_DEVICE int particleIndex( ) const { return( m_particleIndex ); }
         HOST_DEVICE int userParticleIndex( ) const { return( m_userParticleIndex ); }
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex ) { if( a_particleIndex == m_particleIndex ) m_userParticleIndex = a_userParticleIndex; }
-        HOST_DEVICE Vector<double> const &gain( ) const { return( m_gain ); }
+        HOST_DEVICE Vector<MCGIDI_StorageType> const &gain( ) const { return( m_gain ); }
         HOST void adjustGain( int a_energy_index, double a_gain ) { m_gain[a_energy_index] += a_gain; }
+        HOST void thin( std::vector<int> const &a_newIndices );
         HOST_DEVICE double gain( int a_energy_index, double a_energy_fraction ) const ;
 
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -431,15 +584,25 @@ class ContinuousEnergyGain {
 class HeatedCrossSectionContinuousEnergy {
 
     private:
+        int m_energyGridSource;                                 /**< If not negative, the index of the temperature whose identical *m_hashIndices* and *m_energies* are shared by *this*. */
         Vector<int> m_hashIndices;
         Vector<double> m_energies;                              /**< Energy grid for cross sections. */
-        Vector<double> m_totalCrossSection;                     /**< The total cross section. */
-        Vector<double> m_depositionEnergy;                      /**< The total continuous energy, deposition-energy cross section (related to the kinetic energy of the untracked outgoing particles). */
-        Vector<double> m_depositionMomentum;                    /**< The total continuous energy, deposition-momentum cross section. */
-        Vector<double> m_productionEnergy;                      /**< The total continuous energy, Q-value cross section. */
+        Vector<MCGIDI_StorageType> m_totalCrossSection;         /**< The total cross section. */
+        Vector<MCGIDI_StorageType> m_depositionEnergy;          /**< The total continuous energy, deposition-energy cross section (related to the kinetic energy of the untracked outgoing particles). */
+        Vector<MCGIDI_StorageType> m_depositionMomentum;        /**< The total continuous energy, deposition-momentum cross section. */
+        Vector<MCGIDI_StorageType> m_productionEnergy;          /**< The total continuous energy, Q-value cross section. */
         Vector<ContinuousEnergyGain> m_gains;                   /**< The total continuous energy, gain cross section for each tracked particle. */
         Vector<int> m_reactionsInURR_region;                    /**< A list of reactions with in or below the upper URR regions. Empty unless URR probability tables present and used. */
+        URR_bandTables m_URR_bandTables;                        /**< The URR probability tables of all reactions in a flattened layout. Not active if the tables cannot be flattened. */
         Vector<HeatedReactionCrossSectionContinuousEnergy *> m_reactionCrossSections;
+        Vector<MCGIDI_StorageType> m_packedReactionCrossSections;       /**< If not empty, all reaction cross sections stored energy major (i.e., at index energy index * number of reactions + reaction index). */
+        Vector<double> m_cumulativeReactionCrossSections;               /**< If not empty, the sum of the cross sections of reactions 0 to reaction index, stored with the same layout as *m_packedReactionCrossSections*. 
+                                                                             Always double as it is searched. */
+        double m_logEnergyMin;                                  /**< For an equal-lethargy fixed grid, the log of the first point of *m_energies*. */
+        double m_inverseLethargyStep;                           /**< For an equal-lethargy fixed grid, the inverse of the lethargy step between points of *m_energies*; otherwise, 0. */
+
+        HOST void thinEnergyGrid( DomainHash const &a_domainHash, double a_tolerance );
+        HOST_DEVICE double smoothReactionCrossSection( int a_reactionIndex, int a_energyIndex, double a_energyFraction ) const ;
 
     public:
         HOST_DEVICE HeatedCrossSectionContinuousEnergy( );
@@ -449,6 +612,8 @@ class HeatedCrossSectionContinuousEnergy {
         HOST_DEVICE ~HeatedCrossSectionContinuousEnergy( );
 
         HOST_DEVICE int evaluationInfo( int a_hashIndex, double a_energy, double *a_energyFraction ) const ;
+        HOST_DEVICE int evaluationInfoAtIndex( int a_energyIndex, double a_energy, double *a_energyFraction ) const ;
+        HOST_DEVICE int evaluationInfo( int a_hashIndex, double a_energy, double *a_energyFraction, EnergyIndexHint *a_energyIndexHint, int a_slot ) const ;
 
         HOST_DEVICE double minimumEnergy( ) const { return( m_energies[0] ); }          /**< Returns the minimum cross section domain. */
         HOST_DEVICE double maximumEnergy( ) const { return( m_energies.back( ) ); }     /**< Returns the maximum cross section domain. */
@@ -459,13 +624,32 @@ class HeatedCrossSectionContinuousEnergy {
                                                                 /**< Returns the offset for the cross section for the reaction with index *a_reactionIndex*. */
         HOST_DEVICE double threshold( int a_reactionIndex ) const { return( m_reactionCrossSections[a_reactionIndex]->threshold( ) ); }
                                                                 /**< Returns the threshold for the reaction with index *a_reactionIndex*. */
+        HOST_DEVICE HeatedReactionCrossSectionContinuousEnergy const *reactionCrossSection( int a_reactionIndex ) const { return( m_reactionCrossSections[a_reactionIndex] ); }
+                                                                /**< Returns the cross section data for the reaction with index *a_reactionIndex*. */
+        HOST_DEVICE int energyGridSource( ) const { return( m_energyGridSource ); }             /**< Returns the value of the **m_energyGridSource**. */
         HOST_DEVICE bool hasURR_probabilityTables( ) const ;
         HOST_DEVICE double URR_domainMin( ) const ;
         HOST_DEVICE double URR_domainMax( ) const ;
         HOST_DEVICE bool reactionHasURR_probabilityTables( int a_index ) const { return( m_reactionCrossSections[a_index]->hasURR_probabilityTables( ) ); }
-
-        HOST_DEVICE Vector<double> &totalCrossSection( ) { return( m_totalCrossSection ); }     /**< Returns a reference to member *m_totalCrossSection*. */
+        HOST double URR_maximumFactor( int a_index ) const { return( m_reactionCrossSections[a_index]->URR_maximumFactor( ) ); }
+                                                                /**< Returns the largest URR cross section factor for the reaction with index *a_index*. */
+        HOST_DEVICE bool hasPackedReactionCrossSections( ) const { return( m_packedReactionCrossSections.size( ) > 0 ); }
+                                                                /**< Returns *true* if the reaction cross sections are stored in the packed table. */
+        HOST_DEVICE MCGIDI_StorageType const *packedReactionCrossSectionsAt( int a_energyIndex ) const { return( &m_packedReactionCrossSections[a_energyIndex * numberOfReactions( )] ); }
+                                                                /**< Returns a pointer to the packed reaction cross sections at energy index *a_energyIndex*. */
+        HOST_DEVICE bool hasCumulativeReactionCrossSections( ) const { return( m_cumulativeReactionCrossSections.size( ) > 0 ); }
+                                                                /**< Returns *true* if the cumulative reaction cross sections table is present. */
+        HOST_DEVICE double const *cumulativeReactionCrossSectionsAt( int a_energyIndex ) const { return( &m_cumulativeReactionCrossSections[a_energyIndex * numberOfReactions( )] ); }
+                                                                /**< Returns a pointer to the cumulative reaction cross sections at energy index *a_energyIndex*. */
+        HOST_DEVICE Vector<int> const &reactionsInURR_region( ) const { return( m_reactionsInURR_region ); }     /**< Returns a reference to **m_reactionsInURR_region**. */
+        HOST_DEVICE double crossSectionAtIndex( int a_reactionIndex, int a_energyIndex ) const ;
+        HOST_DEVICE double dopplerBroadenedCrossSection( int a_reactionIndex, double a_energy, double a_alpha ) const ;
+        HOST_DEVICE void dopplerBroadenedCrossSections( int a_reactionIndex, int a_numberOfReactions, double a_energy, double a_alpha, double *a_crossSections ) const ;
+
+        HOST_DEVICE Vector<MCGIDI_StorageType> &totalCrossSection( ) { return( m_totalCrossSection ); }     /**< Returns a reference to member *m_totalCrossSection*. */
+        HOST void addReactionCrossSectionVectors( double a_factor, int a_energyBegin, int a_energyEnd, int a_numberAllocated, double *a_reactionCrossSectionVectors ) const ;
         HOST_DEVICE double crossSection(                               URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double crossSection2(                              URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_energy, int a_energyIndex, double a_energyFraction, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection(  int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection2( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_energy, int a_energyIndex, double a_energyFraction, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection(  int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_energy ) const ;
@@ -476,7 +660,8 @@ class HeatedCrossSectionContinuousEnergy {
         HOST_DEVICE double gain(               int a_hashIndex, double a_energy, int a_particleIndex ) const ;
 
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
-        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+        HOST void shareData( HeatedCrossSectionContinuousEnergy const &a_other, int a_otherIndex );
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode, HeatedCrossSectionContinuousEnergy * const *a_heatedCrossSections = nullptr );
 
         HOST_DEVICE Vector<double> const &energies( ) const { return( m_energies ); }       /**< Returns a reference to **m_styles**. */
 };
@@ -492,6 +677,13 @@ class HeatedCrossSectionsContinuousEnergy {
         Vector<double> m_temperatures;
         Vector<double> m_thresholds;
         Vector<HeatedCrossSectionContinuousEnergy *> m_heatedCrossSections;
+        double m_targetMassRatio;                                       /**< If positive, on-the-fly Doppler broadening is used and this is the target to projectile mass ratio. */
+
+        HOST_DEVICE int sampleReactionCumulative( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_energy, double a_sampleCrossSection,
+                HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection1, int a_energyIndex1, double a_energyFraction1, double a_temperatureFraction1,
+                HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection2, int a_energyIndex2, double a_energyFraction2 ) const ;
+        HOST_DEVICE int sampleReaction2( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, TemperatureContext const &a_temperatureContext,
+                EnergyIndexHint *a_energyIndexHint, double a_energy, double a_crossSection, double (*userrng)( void * ), void *rngState ) const ;
 
     public:
         HOST_DEVICE HeatedCrossSectionsContinuousEnergy( );
@@ -501,36 +693,101 @@ class HeatedCrossSectionsContinuousEnergy {
                 GIDI::Styles::TemperatureInfos const &a_temperatureInfos, std::vector<GIDI::Reaction const *> const &a_reactions, 
                 std::vector<GIDI::Reaction const *> const &a_orphanProducts, bool a_fixedGrid );
 
+        HOST_DEVICE Vector<HeatedCrossSectionContinuousEnergy *> const &heatedCrossSections( ) const { return( m_heatedCrossSections ); }
+                                                                /**< Returns a reference to the **m_heatedCrossSections** member. */
         HOST_DEVICE double minimumEnergy( ) const { return( m_heatedCrossSections[0]->minimumEnergy( ) ); }
                                                                     /**< Returns the minimum cross section domain. */
         HOST_DEVICE double maximumEnergy( ) const { return( m_heatedCrossSections[0]->maximumEnergy( ) ); }
                                                                     /**< Returns the maximum cross section domain. */
         HOST_DEVICE Vector<double> const &temperatures( ) const { return( m_temperatures ); }   /**< Returns the value of the **m_temperatures**. */
+        HOST_DEVICE Vector<double> const &energies( int a_temperatureIndex ) const { return( m_heatedCrossSections[a_temperatureIndex]->energies( ) ); }
+                                                                    /**< Returns the energy grid for the temperature at index *a_temperatureIndex*. */
 
         HOST_DEVICE double threshold( MCGIDI_VectorSizeType a_index ) const { return( m_thresholds[a_index] ); }     /**< Returns the threshold for the reaction at index *a_index*. */
         HOST_DEVICE bool hasURR_probabilityTables( ) const { return( m_heatedCrossSections[0]->hasURR_probabilityTables( ) ); }
         HOST_DEVICE double URR_domainMin( ) const { return( m_heatedCrossSections[0]->URR_domainMin( ) ); }
         HOST_DEVICE double URR_domainMax( ) const { return( m_heatedCrossSections[0]->URR_domainMax( ) ); }
         HOST_DEVICE bool reactionHasURR_probabilityTables( int a_index ) const { return( m_heatedCrossSections[0]->reactionHasURR_probabilityTables( a_index ) ); }
+        HOST double URR_maximumFactor( int a_index ) const ;
+
+        HOST_DEVICE double targetMassRatio( ) const { return( m_targetMassRatio ); }       /**< Returns the value of the **m_targetMassRatio**. */
+        HOST_DEVICE bool dopplerBroaden( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_temperature ) const ;
+        HOST_DEVICE double dopplerBroadeningAlpha( double a_temperature ) const { return( m_targetMassRatio / ( a_temperature - m_temperatures[0] ) ); }
+                                                                    /**< Returns the free gas kernel parameter for broadening the stored data to temperature *a_temperature*. */
 
         HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
                 double a_temperature, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, EnergyIndexHint &a_energyIndexHint, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double unionizedCrossSection(                     URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int const *a_energyIndices, 
+                double a_temperature, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double unionizedCrossSection(                     URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int const *a_energyIndices, 
+                TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE void crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_crossSectionVector ) const ;
+        HOST void crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const ;
+        HOST void reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
                 double a_temperature, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_temperature, double a_energy_in ) const ;
         HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
                 double a_temperature, double a_energy, double a_crossSection, double (*userrng)( void * ), void *rngState ) const ;
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, double a_energy, double a_crossSection, double (*userrng)( void * ), void *rngState ) const ;
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, EnergyIndexHint &a_energyIndexHint, double a_energy, double a_crossSection, 
+                double (*userrng)( void * ), void *rngState ) const ;
+        HOST void crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_number, int const *a_hashIndices, 
+                double const *a_temperatures, double const *a_energies, double *a_crossSections, double *a_reactionCrossSections = nullptr ) const ;
 
         HOST_DEVICE double depositionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double productionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double gain(               int a_hashIndex, double a_temperature, double a_energy, int a_particleIndex ) const ;
+        HOST_DEVICE double depositionEnergy(   int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const ;
+        HOST_DEVICE double depositionMomentum( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const ;
+        HOST_DEVICE double productionEnergy(   int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const ;
+        HOST_DEVICE double gain(               int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy, int a_particleIndex ) const ;
 
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
+/*
+============================================================
+====================== UnionizedGrid =======================
+============================================================
+*/
+class UnionizedGrid {
+
+    private:
+        Vector<int> m_hashIndices;                                      /**< The hash indices for *m_energies*. */
+        Vector<double> m_energies;                                      /**< The union of the energy grids of all protares for all their temperatures. */
+        int m_numberOfGrids;                                            /**< The number of protare/temperature energy grids mapped by *this*. */
+        Vector<int> m_gridOffsets;                                      /**< For each protare, the column in a row of *m_gridIndices* of its first temperature. */
+        Vector<int> m_gridIndices;                                      /**< For each point of *m_energies*, the lower index into each protare/temperature energy grid. */
+
+    public:
+        HOST_DEVICE UnionizedGrid( );
+        HOST UnionizedGrid( DomainHash const &a_domainHash, Vector<ProtareSingle *> const &a_protares );
+
+        HOST_DEVICE bool isActive( ) const { return( m_numberOfGrids > 0 ); }              /**< Returns *true* if *this* has been built and *false* otherwise. */
+        HOST_DEVICE Vector<double> const &energies( ) const { return( m_energies ); }       /**< Returns a reference to **m_energies**. */
+        HOST_DEVICE int numberOfGrids( ) const { return( m_numberOfGrids ); }               /**< Returns the value of the **m_numberOfGrids**. */
+
+        HOST_DEVICE int evaluationIndex( int a_hashIndex, double a_energy ) const ;
+        HOST_DEVICE int const *gridIndices( int a_unionIndex, int a_protareIndex ) const {
+            return( &m_gridIndices[a_unionIndex * m_numberOfGrids + m_gridOffsets[a_protareIndex]] ); }
+                                                                        /**< Returns the lower energy indices for the protare at index *a_protareIndex*, one per temperature. */
+
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+};
+
 /*
 ============================================================
 ====================== MultiGroupGain ======================
@@ -546,6 +803,7 @@ class MultiGroupGain {
     public:
         HOST_DEVICE MultiGroupGain( );
         HOST MultiGroupGain( int a_particleIndex, GIDI::Vector const &a_gain );
+        HOST MultiGroupGain( MultiGroupGain const &a_multiGroupGain1, MultiGroupGain const &a_multiGroupGain2, double a_fraction );
 
         HOST MultiGroupGain &operator=( MultiGroupGain const &a_multiGroupGain );
 
@@ -577,6 +835,8 @@ class HeatedReactionCrossSectionMultiGroup {
         HOST_DEVICE HeatedReactionCrossSectionMultiGroup( );
         HOST HeatedReactionCrossSectionMultiGroup( SetupInfo &a_setupInfo, Transporting::MC const &a_settings, int a_offset, 
                 std::vector<double> const &a_crossSection, double a_threshold );
+        HOST HeatedReactionCrossSectionMultiGroup( HeatedReactionCrossSectionMultiGroup const &a_reactionCrossSection1, 
+                HeatedReactionCrossSectionMultiGroup const &a_reactionCrossSection2, double a_fraction );
 
         HOST_DEVICE double operator[]( MCGIDI_VectorSizeType a_index ) const { return( m_crossSection[a_index] ); }  /**< Returns the value of the cross section at multi-group index *a_index*. */
         HOST_DEVICE double threshold( ) const { return( m_threshold ); }        /**< Returns the value of the **m_threshold**. */
@@ -593,6 +853,7 @@ class HeatedReactionCrossSectionMultiGroup {
             return( _crossSection );
         }
         HOST_DEVICE double augmentedThresholdCrossSection( ) const { return( m_augmentedThresholdCrossSection ); }  /**< Returns the value of the **m_augmentedThresholdCrossSection**. */
+        HOST_DEVICE Vector<double> const &crossSections( ) const { return( m_crossSection ); }  /**< Returns a reference to the **m_crossSection** member, which starts at group **m_offset**. */
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
         HOST void write( FILE *a_file, int a_reactionIndex ) const ;
 };
@@ -612,12 +873,18 @@ class HeatedCrossSectionMultiGroup {
         Vector<double> m_productionEnergy;                  /**< The total multi-group, Q-value cross section. */
         Vector<MultiGroupGain> m_gains;                     /**< The total multi-group, gain cross section for each tracked particle. */
         Vector<HeatedReactionCrossSectionMultiGroup *> m_reactionCrossSections;
+        Vector<double> m_cumulativeReactionCrossSections;   /**< The sum of the sampling cross sections (i.e., including the augmented threshold cross sections) of reactions 0 to
+                                                                 reaction index at index multi-group index * number of reactions + reaction index. */
+
+        HOST void setCumulativeReactionCrossSections( );
 
     public:
         HOST_DEVICE HeatedCrossSectionMultiGroup( );
         HOST HeatedCrossSectionMultiGroup( GIDI::ProtareSingle const &a_protare, SetupInfo &a_setupInfo, 
                 Transporting::MC const &a_settings, GIDI::Styles::TemperatureInfo const &a_temperatureInfo,
                 GIDI::Transporting::Particles const &a_particles, std::vector<GIDI::Reaction const *> const &a_reactions, std::string const &a_label );
+        HOST HeatedCrossSectionMultiGroup( HeatedCrossSectionMultiGroup const &a_heatedCrossSection1, HeatedCrossSectionMultiGroup const &a_heatedCrossSection2, 
+                double a_fraction );
         HOST_DEVICE ~HeatedCrossSectionMultiGroup( );
 
         HOST_DEVICE HeatedReactionCrossSectionMultiGroup *operator[]( MCGIDI_VectorSizeType a_index ) const { return( m_reactionCrossSections[a_index] ); }
@@ -636,6 +903,9 @@ class HeatedCrossSectionMultiGroup {
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, int a_hashIndex, bool a_sampling = false ) const {
                 return( m_reactionCrossSections[a_reactionIndex]->crossSection( a_hashIndex, a_sampling ) ); }
                 /**< Returns the reaction's cross section for the reaction at index *a_reactionIndex* and multi-group index *a_hashIndex*. */
+        HOST_DEVICE double const *cumulativeReactionCrossSectionsAt( int a_hashIndex ) const { return( &m_cumulativeReactionCrossSections[a_hashIndex * numberOfReactions( )] ); }
+                /**< Returns a pointer to the cumulative sampling cross sections of all reactions at multi-group index *a_hashIndex*. */
+        HOST void addReactionCrossSectionVectors( double a_factor, int a_groupBegin, int a_groupEnd, int a_numberAllocated, double *a_reactionCrossSectionVectors ) const ;
 
         HOST_DEVICE double depositionEnergy(   int a_hashIndex ) const { return( m_depositionEnergy[a_hashIndex] ); }
         HOST_DEVICE double depositionMomentum( int a_hashIndex ) const { return( m_depositionMomentum[a_hashIndex] ); }
@@ -660,7 +930,8 @@ class HeatedCrossSectionsMultiGroup {
         Vector<double> m_thresholds;
         Vector<int> m_multiGroupThresholdIndex;                         /**< This is the group where threshold starts, -1 otherwise. */
         Vector<double> m_projectileMultiGroupBoundariesCollapsed;
-        Vector<HeatedCrossSectionMultiGroup *> m_heatedCrossSections;
+        Vector<HeatedCrossSectionMultiGroup *> m_heatedCrossSections;   /**< The data at each temperature of *m_temperatures* followed by the data at each temperature of *m_userTemperatures*. */
+        Vector<double> m_userTemperatures;                              /**< The user temperatures, in ascending order, whose interpolated data are stored in *m_heatedCrossSections*. */
 
     public:
         HOST_DEVICE HeatedCrossSectionsMultiGroup( );
@@ -669,6 +940,9 @@ class HeatedCrossSectionsMultiGroup {
         HOST_DEVICE double minimumEnergy( ) const { return( m_projectileMultiGroupBoundariesCollapsed[0] ); }
         HOST_DEVICE double maximumEnergy( ) const { return( m_projectileMultiGroupBoundariesCollapsed.back( ) ); }
         HOST_DEVICE Vector<double> const &temperatures( ) const { return( m_temperatures ); }   /**< Returns the value of the **m_temperatures**. */
+        HOST_DEVICE Vector<double> const &userTemperatures( ) const { return( m_userTemperatures ); }   /**< Returns the value of the **m_userTemperatures**. */
+        HOST void setUserTemperatures( std::vector<double> const &a_temperatures );
+        HOST_DEVICE TemperatureContext temperatureContext( double a_temperature ) const ;
 
         HOST void update( GIDI::ProtareSingle const &a_protare, SetupInfo &a_setupInfo, Transporting::MC const &a_settings, GIDI::Transporting::Particles const &a_particles, 
                 GIDI::Styles::TemperatureInfos const &a_temperatureInfos, std::vector<GIDI::Reaction const *> const &a_reactions, 
@@ -683,16 +957,28 @@ class HeatedCrossSectionsMultiGroup {
         HOST_DEVICE double threshold( MCGIDI_VectorSizeType a_index ) const { return( m_thresholds[a_index] ); }     /**< Returns the threshold for the reaction at index *a_index*. */
 
         HOST_DEVICE double crossSection(                              int a_hashIndex, double a_temperature, bool a_sampling = false ) const ;
+        HOST_DEVICE double crossSection(                              int a_hashIndex, TemperatureContext const &a_temperatureContext, bool a_sampling = false ) const ;
         HOST_DEVICE void crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_crossSectionVector ) const ;
+        HOST void crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const ;
+        HOST void reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, int a_hashIndex, double a_temperature, bool a_sampling = false ) const ;
+        HOST_DEVICE double reactionCrossSection( int a_reactionIndex, int a_hashIndex, TemperatureContext const &a_temperatureContext, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, double a_temperature, double a_energy_in ) const ;
         HOST_DEVICE int sampleReaction(                               int a_hashIndex, double a_temperature, double a_energy_in, double a_crossSection, 
                         double (*userrng)( void * ), void *rngState ) const ;
+        HOST_DEVICE int sampleReaction(                               int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy_in, 
+                        double a_crossSection, double (*userrng)( void * ), void *rngState ) const ;
 
         HOST_DEVICE double depositionEnergy(   int a_hashIndex, double a_temperature ) const ;
         HOST_DEVICE double depositionMomentum( int a_hashIndex, double a_temperature ) const ;
         HOST_DEVICE double productionEnergy(   int a_hashIndex, double a_temperature ) const ;
         HOST_DEVICE double gain(               int a_hashIndex, double a_temperature, int a_particleIndex ) const ;
+        HOST_DEVICE double depositionEnergy(   int a_hashIndex, TemperatureContext const &a_temperatureContext ) const ;
+        HOST_DEVICE double depositionMomentum( int a_hashIndex, TemperatureContext const &a_temperatureContext ) const ;
+        HOST_DEVICE double productionEnergy(   int a_hashIndex, TemperatureContext const &a_temperatureContext ) const ;
+        HOST_DEVICE double gain(               int a_hashIndex, TemperatureContext const &a_temperatureContext, int a_particleIndex ) const ;
 
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
 
@@ -1024,6 +1310,7 @@ class Protare {
         HOST void productIndices( std::set<int> const &a_indices, std::set<int> const &a_transportableIndices );
         HOST Vector<int> const &userProductIndices( bool a_transportablesOnly ) const ;
         virtual HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
+        virtual HOST void setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures ) = 0;
 
         virtual ProtareType protareType( ) const { return( m_protareType ); }                               /**< Returns the value of the **m_protareType** member. */    
         HOST_DEVICE bool isTNSL_ProtareSingle( ) const { return( m_isTNSL_ProtareSingle ); }                /**< Returns the value of the **m_isTNSL_ProtareSingle** member. */
@@ -1056,9 +1343,23 @@ class Protare {
 
         virtual HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const = 0;
         virtual HOST_DEVICE void crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_crossSectionVector ) const = 0;
+        virtual HOST void crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads = 1 ) const = 0;
+        virtual HOST void reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads = 1 ) const = 0;
         virtual HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const = 0;
         virtual HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos,                  double a_temperature, double a_energy ) const = 0;
         virtual HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const = 0;
+// The following methods take the TemperatureContext's filled by temperatureContexts( ), one for each protare returned by protare( ).
+        virtual HOST_DEVICE void temperatureContexts( double a_temperature, TemperatureContext *a_temperatureContexts ) const = 0;
+        virtual HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const = 0;
+        virtual HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const = 0;
+        virtual HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const = 0;
+        virtual HOST void crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_number, int const *a_hashIndices, double const *a_temperatures, 
+                double const *a_energies, double *a_crossSections, double *a_reactionCrossSections = nullptr, bool a_sampling = false ) const ;
 
         virtual HOST_DEVICE double depositionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const = 0;
         virtual HOST_DEVICE double depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const = 0;
@@ -1070,6 +1371,7 @@ class Protare {
         virtual HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
         virtual HOST_DEVICE long sizeOf( ) const { return sizeof(*this); }
         HOST_DEVICE long memorySize( );
+        HOST_DEVICE long sharedMemorySize( );
 };
 
 /*
@@ -1124,6 +1426,7 @@ class ProtareSingle : public Protare {
 
 // The rest are virtual methods defined in the Protare class.
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
+        HOST void setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures );
 
         HOST_DEVICE MCGIDI_VectorSizeType numberOfProtares( ) const { return( 1 ); }                        /**< Returns the number of protares contained in *this*. */
         HOST_DEVICE ProtareSingle const *protare( MCGIDI_VectorSizeType a_index ) const ;
@@ -1165,15 +1468,60 @@ class ProtareSingle : public Protare {
 
         HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE void crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_crossSectionVector ) const ;
+        HOST void crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads = 1 ) const ;
+        HOST void reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads = 1 ) const ;
+        HOST_DEVICE double unionizedCrossSection( URR_protareInfos const &a_URR_protareInfos, int const *a_energyIndices, double a_temperature, double a_energy, bool a_sampling = false ) const {
+            return( m_heatedCrossSections.unionizedCrossSection( a_URR_protareInfos, m_URR_index, a_energyIndices, a_temperature, a_energy, a_sampling ) ); }
+                                                                                                            /**< Returns the total cross section using energy indices from a UnionizedGrid. */
+        HOST_DEVICE double unionizedCrossSection( URR_protareInfos const &a_URR_protareInfos, int const *a_energyIndices, TemperatureContext const &a_temperatureContext, 
+                double a_energy, bool a_sampling = false ) const {
+            return( m_heatedCrossSections.unionizedCrossSection( a_URR_protareInfos, m_URR_index, a_energyIndices, a_temperatureContext, a_energy, a_sampling ) ); }
+                                                                                                            /**< Same as above but uses the temperature data in *a_temperatureContext*. */
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos,                  double a_temperature, double a_energy ) const ;
         HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
+        HOST void crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_number, int const *a_hashIndices, double const *a_temperatures, 
+                double const *a_energies, double *a_crossSections, double *a_reactionCrossSections = nullptr, bool a_sampling = false ) const ;
 
         HOST_DEVICE double depositionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double productionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double gain(               int a_hashIndex, double a_temperature, double a_energy, int a_particleIndex ) const ;
 
+// The following methods take a TemperatureContext from temperatureContext( ) so that the temperature search is done once per temperature (e.g., per cell).
+        HOST_DEVICE TemperatureContext temperatureContext( double a_temperature ) const ;
+        HOST_DEVICE void temperatureContexts( double a_temperature, TemperatureContext *a_temperatureContexts ) const {
+            a_temperatureContexts[0] = temperatureContext( a_temperature ); }                                 /**< Sets *a_temperatureContexts*[0] to **temperatureContext**( *a_temperature* ). */
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const {
+            return( crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_sampling ) ); }
+                                                                                                            /**< Same as the TemperatureContext reference version using *a_temperatureContexts*[0]. */
+        HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const {
+            return( reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_sampling ) ); }
+                                                                                                            /**< Same as the TemperatureContext reference version using *a_temperatureContexts*[0]. */
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const {
+            return( sampleReaction( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_crossSection, a_userrng, a_rngState ) ); }
+                                                                                                            /**< Same as the TemperatureContext reference version using *a_temperatureContexts*[0]. */
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
+// The following methods also take an EnergyIndexHint that starts the energy search from the particle's last energy index.
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                EnergyIndexHint &a_energyIndexHint, double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                EnergyIndexHint &a_energyIndexHint, double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
+        HOST_DEVICE double depositionEnergy(   int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const ;
+        HOST_DEVICE double depositionMomentum( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const ;
+        HOST_DEVICE double productionEnergy(   int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const ;
+        HOST_DEVICE double gain(               int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy, int a_particleIndex ) const ;
+
         HOST_DEVICE Vector<double> const &upscatterModelAGroupVelocities( ) const { return( m_upscatterModelAGroupVelocities ); }   /**< Returns a reference to the **m_upscatterModelAGroupVelocities** member. */
 
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -1193,6 +1541,7 @@ class ProtareComposite : public Protare {
         std::size_t m_numberOfOrphanProducts;                               /**< The sum of the number of reaction for all stored protares. */
         double m_minimumEnergy;                                             /**< The maximum of the minimum cross section domains. */
         double m_maximumEnergy;                                             /**< The minimum of the maximum cross section domains. */
+        UnionizedGrid m_unionizedGrid;                                      /**< Optional energy grid shared by all protares. Only built if requested via Transporting::MC::wantUnionizedGrid. */
 
     public:
         HOST_DEVICE ProtareComposite( );
@@ -1202,9 +1551,11 @@ class ProtareComposite : public Protare {
         HOST_DEVICE ~ProtareComposite( );
 
         Vector<ProtareSingle *> protares( ) const { return( m_protares ); }       /**< Returns the value of the **m_protares** member. */
+        HOST_DEVICE UnionizedGrid const &unionizedGrid( ) const { return( m_unionizedGrid ); }    /**< Returns a reference to the **m_unionizedGrid** member. */
 
 // The rest are virtual methods defined in the Protare class.
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
+        HOST void setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures );
 
         HOST_DEVICE MCGIDI_VectorSizeType numberOfProtares( ) const { return( m_protares.size( ) ); }     /**< Returns the number of protares contained in *this*. */
         HOST_DEVICE ProtareSingle const *protare( MCGIDI_VectorSizeType a_index ) const ;
@@ -1240,9 +1591,22 @@ class ProtareComposite : public Protare {
 
         HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE void crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_crossSectionVector ) const ;
+        HOST void crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads = 1 ) const ;
+        HOST void reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads = 1 ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos,                  double a_temperature, double a_energy ) const ;
         HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
+        HOST void crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_number, int const *a_hashIndices, double const *a_temperatures, 
+                double const *a_energies, double *a_crossSections, double *a_reactionCrossSections = nullptr, bool a_sampling = false ) const ;
+        HOST_DEVICE void temperatureContexts( double a_temperature, TemperatureContext *a_temperatureContexts ) const ;
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
 
         HOST_DEVICE double depositionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const ;
@@ -1287,6 +1651,7 @@ class ProtareTNSL : public Protare {
 
 // The rest are virtual methods defined in the Protare class.
         HOST void setUserParticleIndex( int a_particleIndex, int a_userParticleIndex );
+        HOST void setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures );
 
         HOST_DEVICE MCGIDI_VectorSizeType numberOfProtares( ) const { return( 2 ); }  /**< Always Returns 2. */
         HOST_DEVICE ProtareSingle const *protare( MCGIDI_VectorSizeType a_index ) const ;
@@ -1322,9 +1687,20 @@ class ProtareTNSL : public Protare {
 
         HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE void crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_crossSectionVector ) const ;
+        HOST void crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads = 1 ) const ;
+        HOST void reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads = 1 ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling = false ) const ;
         HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos,                  double a_temperature, double a_energy ) const ;
         HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, double a_temperature, double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
+        HOST_DEVICE void temperatureContexts( double a_temperature, TemperatureContext *a_temperatureContexts ) const ;
+        HOST_DEVICE double crossSection(                              URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE double reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling = false ) const ;
+        HOST_DEVICE int sampleReaction(                               URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const ;
 
         HOST_DEVICE double depositionEnergy(   int a_hashIndex, double a_temperature, double a_energy ) const ;
         HOST_DEVICE double depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const ;
@@ -1338,6 +1714,120 @@ class ProtareTNSL : public Protare {
         HOST_DEVICE long sizeOf( ) const { return sizeof(*this); }
 };
 
+/*
+============================================================
+========================= Material =========================
+============================================================
+*/
+class Material {
+
+    private:
+        int m_numberOfNuclides;                                             /**< The number of nuclides in *this*. */
+        Vector<double> m_atomDensities;                                     /**< The atom density of each nuclide. */
+        Vector<double> m_temperatures;                                      /**< The temperatures the macroscopic data are tabulated at. */
+        Vector<int> m_hashIndices;                                          /**< The hash indices for *m_energies*. */
+        Vector<double> m_energies;                                          /**< The union of the continuous energy grids of all nuclides for all their temperatures. */
+        Vector<double> m_cumulativeCrossSections;                           /**< The sum of the macroscopic cross sections of nuclides 0 to nuclide index at index 
+                                                                                 ( temperature index * number of energies + energy index ) * number of nuclides + nuclide index. Always double as it is searched. */
+
+        HOST_DEVICE int evaluationInfo( int a_hashIndex, double a_energy, double *a_energyFraction ) const ;
+
+    public:
+        HOST_DEVICE Material( );
+        HOST Material( DomainHash const &a_domainHash, Vector<Protare *> const &a_protares, Vector<double> const &a_atomDensities, 
+                Vector<double> const &a_temperatures );
+
+        HOST_DEVICE int numberOfNuclides( ) const { return( m_numberOfNuclides ); }           /**< Returns the value of the **m_numberOfNuclides**. */
+        HOST_DEVICE double atomDensity( int a_index ) const { return( m_atomDensities[a_index] ); }
+                                                                            /**< Returns the atom density of the nuclide at index *a_index*. */
+        HOST_DEVICE Vector<double> const &temperatures( ) const { return( m_temperatures ); }  /**< Returns a reference to **m_temperatures**. */
+        HOST_DEVICE Vector<double> const &energies( ) const { return( m_energies ); }          /**< Returns a reference to **m_energies**. */
+        HOST_DEVICE double crossSectionAtIndex( int a_temperatureIndex, int a_energyIndex ) const {
+            return( m_cumulativeCrossSections[( a_temperatureIndex * static_cast<int>( m_energies.size( ) ) + a_energyIndex + 1 ) * m_numberOfNuclides - 1] ); }
+                                                                            /**< Returns the tabulated macroscopic total cross section at temperature index *a_temperatureIndex* and energy index *a_energyIndex*. */
+
+        HOST_DEVICE double crossSection( int a_hashIndex, double a_temperature, double a_energy ) const ;
+        HOST_DEVICE int sampleNuclide( int a_hashIndex, double a_temperature, double a_energy, double a_crossSection, 
+                double (*a_userrng)( void * ), void *a_rngState ) const ;
+
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+        HOST_DEVICE long sizeOf( ) const { return sizeof(*this); }
+        HOST_DEVICE long memorySize( );
+};
+
+/*
+============================================================
+========================= Majorant =========================
+============================================================
+*/
+class Majorant {
+
+    private:
+        DomainHash m_domainHash;                                            /**< The hash whose bins define the grid of *this*. */
+        Vector<double> m_crossSections;                                     /**< The majorant for each hash index. */
+
+        HOST void addCurve( Vector<double> const &a_energies, std::vector<double> const &a_crossSections );
+
+    public:
+        HOST_DEVICE Majorant( );
+        HOST Majorant( DomainHash const &a_domainHash );
+
+        HOST_DEVICE DomainHash const &domainHash( ) const { return( m_domainHash ); }               /**< Returns a reference to **m_domainHash**. */
+        HOST_DEVICE Vector<double> const &crossSections( ) const { return( m_crossSections ); }      /**< Returns a reference to **m_crossSections**. */
+        HOST_DEVICE double crossSection( int a_hashIndex ) const { return( m_crossSections[a_hashIndex] ); }
+                                                                            /**< Returns the majorant for the hash index *a_hashIndex*. */
+        HOST_DEVICE double crossSection( double a_energy ) const { return( m_crossSections[m_domainHash.index( a_energy )] ); }
+                                                                            /**< Returns the majorant for the projectile energy *a_energy*. */
+
+        HOST void addMaterial( DomainHash const &a_domainHash, Vector<Protare *> const &a_protares, Vector<double> const &a_atomDensities, 
+                double a_temperatureMin, double a_temperatureMax );
+        HOST void addMaterial( Material const &a_material );
+
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+        HOST_DEVICE long sizeOf( ) const { return sizeof(*this); }
+        HOST_DEVICE long memorySize( );
+};
+
+/*
+============================================================
+========================= Interner =========================
+============================================================
+*/
+class Interner {
+
+    private:
+        long m_numberOfProtares;                                            /**< The number of protares interned. */
+        long m_numberOfVectors;                                             /**< The number of non-empty vectors passed to *this*. */
+        long m_numberOfSharedVectors;                                       /**< The number of vectors whose data were freed as they are identical to data already in *this*. */
+        long m_memorySize;                                                  /**< The number of bytes of data owned by *this*. */
+        long m_savedMemorySize;                                             /**< The number of bytes of data freed by sharing. */
+        std::vector<Vector<double> *> m_doubleVectors;                      /**< The distinct double vectors owned by *this*. */
+        std::map<uint64_t, std::vector<std::size_t> > m_doubleHashes;       /**< For each content hash, the indices of the vectors in *m_doubleVectors* with that hash. */
+        std::vector<Vector<float> *> m_floatVectors;                        /**< The distinct float vectors owned by *this*. */
+        std::map<uint64_t, std::vector<std::size_t> > m_floatHashes;        /**< For each content hash, the indices of the vectors in *m_floatVectors* with that hash. */
+
+        template <typename T> HOST void internVector( Vector<T> &a_vector, std::vector<Vector<T> *> &a_vectors, 
+                std::map<uint64_t, std::vector<std::size_t> > &a_hashes );
+        Interner( Interner const &a_interner );                             // Disable copy constructor as *this* owns its vectors.
+        Interner &operator=( Interner const &a_interner );                  // Disable assignment operator.
+
+    public:
+        HOST Interner( );
+        HOST ~Interner( );
+
+        HOST long numberOfProtares( ) const { return( m_numberOfProtares ); }               /**< Returns the value of the **m_numberOfProtares**. */
+        HOST long numberOfVectors( ) const { return( m_numberOfVectors ); }                 /**< Returns the value of the **m_numberOfVectors**. */
+        HOST long numberOfSharedVectors( ) const { return( m_numberOfSharedVectors ); }     /**< Returns the value of the **m_numberOfSharedVectors**. */
+        HOST long numberOfDistinctVectors( ) const { return( static_cast<long>( m_doubleVectors.size( ) + m_floatVectors.size( ) ) ); }
+                                                                            /**< Returns the number of distinct vectors owned by *this*. */
+        HOST long memorySize( ) const { return( m_memorySize ); }                           /**< Returns the value of the **m_memorySize**. */
+        HOST long savedMemorySize( ) const { return( m_savedMemorySize ); }                 /**< Returns the value of the **m_savedMemorySize**. */
+
+        HOST void intern( Vector<double> &a_vector );
+        HOST void intern( Vector<float> &a_vector );
+        HOST void intern( Protare *a_protare );
+};
+
 /*
 ============================================================
 =========================== Others =========================
@@ -1347,6 +1837,7 @@ HOST Protare *protareFromGIDIProtare( GIDI::Protare const &a_protare, PoPI::Data
                 DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfos const &a_temperatureInfos, std::set<int> const &a_reactionsToExclude,
                 int a_reactionsToExcludeOffset = 0, bool a_allowFixedGrid = true );
 HOST Vector<double> GIDI_VectorDoublesToMCGIDI_VectorDoubles( GIDI::Vector a_vector );
+HOST Vector<MCGIDI_StorageType> vectorDoublesToStorageVector( std::vector<double> const &a_vector );
 HOST void addVectorItemsToSet( Vector<int> const &a_productIndicesFrom, std::set<int> &a_productIndicesTo );
 
 HOST_DEVICE double sampleBetaFromMaxwellian( double (*a_userrng)( void * ), void *a_rngState );
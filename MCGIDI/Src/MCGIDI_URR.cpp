@@ -64,6 +64,30 @@ HOST void URR_protareInfos::setup( Vector<Protare *> &a_protares ) {
     for( std::size_t i1 = 0; i1 < URR_protareInfo_1.size( ); ++i1 ) m_URR_protareInfos.push_back( URR_protareInfo_1[i1] );
 }
 
+/* *********************************************************************************************************//**
+ * Sets up *this* so that the smooth (i.e., not URR probability table) cross sections are returned for all protares in *a_protares*.
+ * Unlike **setup**, the URR index of each protare is not changed so *this* can be used with protares already indexed by another
+ * URR_protareInfos instance.
+ *
+ * @param a_protares            [in]    The list of protares.
+ ***********************************************************************************************************/
+
+HOST void URR_protareInfos::setupSmooth( Vector<Protare *> const &a_protares ) {
+
+    int maximumIndex = -1;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < a_protares.size( ); ++i1 ) {
+        Protare const *protare = a_protares[i1];
+
+        for( MCGIDI_VectorSizeType i2 = 0; i2 < protare->numberOfProtares( ); ++i2 ) {
+            if( protare->protare( i2 )->URR_index( ) > maximumIndex ) maximumIndex = protare->protare( i2 )->URR_index( );
+        }
+    }
+
+    m_URR_protareInfos.clear( );
+    for( int i1 = 0; i1 <= maximumIndex; ++i1 ) m_URR_protareInfos.push_back( URR_protareInfo( ) );
+}
+
 /* *********************************************************************************************************//**
  * Updates *this* if *a_protare* has a non-negative *URR_index*.
  *
@@ -87,6 +111,38 @@ HOST_DEVICE void URR_protareInfos::updateProtare( MCGIDI::Protare const *a_prota
     }
 }
 
+/* *********************************************************************************************************//**
+ * Updates the URR information of a bank of particles for *a_protare*. This is the same as calling **updateProtare** for each
+ * particle except that the loop over the protares in *a_protare* is done once for the whole bank and not once per particle.
+ * Because of this, random numbers are drawn in protare-major order and the sampled values for a particle differ from those
+ * obtained by calling **updateProtare** for each particle in turn.
+ *
+ * @param a_protare             [in]    The protare whose *URR_index* is used to see if *this* needs updating.
+ * @param a_numberOfParticles   [in]    The number of particles in the bank.
+ * @param a_energies            [in]    The energy of each particle.
+ * @param a_URR_protareInfos    [in]    The URR information for each particle.
+ * @param a_userrng             [in]    The random number generator function the uses *a_rngState* to generator a double in the range [0, 1.0).
+ * @param a_rngState            [in]    The random number generator state.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void URR_protareInfos::updateProtareBatch( MCGIDI::Protare const *a_protare, int a_numberOfParticles, double const *a_energies, 
+                URR_protareInfos *a_URR_protareInfos, double (*a_userrng)( void * ), void *a_rngState ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < a_protare->numberOfProtares( ); ++i1 ) {
+        ProtareSingle const *protareSingle = a_protare->protare( i1 );
+        int URR_index = protareSingle->URR_index( );
+
+        if( URR_index < 0 ) continue;
+
+        for( int particleIndex = 0; particleIndex < a_numberOfParticles; ++particleIndex ) {
+            URR_protareInfo &URR_protare_info = a_URR_protareInfos[particleIndex].m_URR_protareInfos[URR_index];
+
+            URR_protare_info.m_inURR = protareSingle->inURR( a_energies[particleIndex] );
+            if( URR_protare_info.inURR( ) ) URR_protare_info.m_rng_Value = a_userrng( a_rngState );
+        }
+    }
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
@@ -109,4 +165,249 @@ HOST_DEVICE void URR_protareInfos::serialize( DataBuffer &a_buffer, DataBuffer::
     }
 }
 
+/*
+============================================================
+====================== URR_bandTables ======================
+============================================================
+*/
+HOST_DEVICE URR_bandTables::URR_bandTables( ) :
+        m_energyInterpolation( Interpolation::LINLIN ),
+        m_bandInterpolation( Interpolation::LINLIN ),
+        m_energies( ),
+        m_reactionSlots( ),
+        m_offsets( ),
+        m_factors( ),
+        m_pdfs( ),
+        m_cdfs( ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * Flattens the URR probability tables of the reactions in *a_reactionCrossSections* into *this*. The tables are only flattened
+ * if all reactions with URR probability tables have **Probabilities::XYs2d** tables on the same energy grid, with the same interpolation
+ * and with only **Probabilities::Xs_pdf_cdf1d** tables at each energy. Otherwise, *this* is left inactive and the reaction's tables
+ * must be sampled directly.
+ *
+ * @param a_reactionCrossSections   [in]    The list of reaction cross sections whose URR probability tables are flattened.
+ ***********************************************************************************************************/
+
+HOST void URR_bandTables::setup( Vector<HeatedReactionCrossSectionContinuousEnergy *> const &a_reactionCrossSections ) {
+
+    std::vector<Probabilities::XYs2d const *> tables;
+    std::vector<int> reactionSlots( a_reactionCrossSections.size( ), -1 );
+
+    m_energies.clear( );
+    m_reactionSlots.clear( );
+    m_offsets.clear( );
+    m_factors.clear( );
+    m_pdfs.clear( );
+    m_cdfs.clear( );
+
+    for( MCGIDI_VectorSizeType reactionIndex = 0; reactionIndex < a_reactionCrossSections.size( ); ++reactionIndex ) {
+        Probabilities::ProbabilityBase2d *probabilityTables = a_reactionCrossSections[reactionIndex]->URR_probabilityTables( );
+
+        if( probabilityTables == nullptr ) continue;
+        if( probabilityTables->type( ) != ProbabilityBase2dType::XYs ) return;
+
+        Probabilities::XYs2d const *XYs2d = static_cast<Probabilities::XYs2d const *>( probabilityTables );
+        Vector<Probabilities::ProbabilityBase1d *> const &probabilities = XYs2d->probabilities( );
+
+        if( XYs2d->interpolation( ) == Interpolation::OTHER ) return;
+        if( tables.size( ) > 0 ) {
+            Vector<double> const &energies = tables[0]->Xs( );
+
+            if( XYs2d->interpolation( ) != tables[0]->interpolation( ) ) return;
+            if( XYs2d->Xs( ).size( ) != energies.size( ) ) return;
+            for( MCGIDI_VectorSizeType i1 = 0; i1 < energies.size( ); ++i1 ) {
+                if( XYs2d->Xs( )[i1] != energies[i1] ) return;
+            }
+        }
+
+        for( MCGIDI_VectorSizeType i1 = 0; i1 < probabilities.size( ); ++i1 ) {
+            if( probabilities[i1]->type( ) != ProbabilityBase1dType::xs_pdf_cdf ) return;
+
+            bool isFlat = probabilities[i1]->interpolation( ) == Interpolation::FLAT;
+            if( ( tables.size( ) > 0 ) || ( i1 > 0 ) ) {
+                if( isFlat != ( m_bandInterpolation == Interpolation::FLAT ) ) return; }
+            else {
+                m_bandInterpolation = isFlat ? Interpolation::FLAT : Interpolation::LINLIN;
+            }
+        }
+
+        reactionSlots[reactionIndex] = static_cast<int>( tables.size( ) );
+        tables.push_back( XYs2d );
+    }
+
+    if( tables.size( ) == 0 ) return;
+
+    std::vector<int> offsets;
+    std::vector<double> factors, pdfs, cdfs;
+
+    for( std::size_t slot = 0; slot < tables.size( ); ++slot ) {
+        Vector<Probabilities::ProbabilityBase1d *> const &probabilities = tables[slot]->probabilities( );
+
+        for( MCGIDI_VectorSizeType i1 = 0; i1 < probabilities.size( ); ++i1 ) {
+            Probabilities::Xs_pdf_cdf1d const *xs_pdf_cdf1d = static_cast<Probabilities::Xs_pdf_cdf1d const *>( probabilities[i1] );
+
+            offsets.push_back( static_cast<int>( factors.size( ) ) );
+            for( MCGIDI_VectorSizeType i2 = 0; i2 < xs_pdf_cdf1d->Xs( ).size( ); ++i2 ) {
+                factors.push_back( xs_pdf_cdf1d->Xs( )[i2] );
+                pdfs.push_back( xs_pdf_cdf1d->pdf( )[i2] );
+                cdfs.push_back( xs_pdf_cdf1d->cdf( )[i2] );
+            }
+        }
+    }
+    offsets.push_back( static_cast<int>( factors.size( ) ) );
+
+    m_energyInterpolation = tables[0]->interpolation( );
+    m_energies = tables[0]->Xs( );
+    m_reactionSlots = reactionSlots;
+    m_offsets = offsets;
+    m_factors = factors;
+    m_pdfs = pdfs;
+    m_cdfs = cdfs;
+}
+
+/* *********************************************************************************************************//**
+ * Returns the index of the lower energy of the tables bounding *a_energy*. The weight of the table at the returned index is
+ * returned in *a_energyFraction*. If the weight is 1, only the table at the returned index is used.
+ *
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_energyFraction      [out]   The weight of the table at the returned index.
+ *
+ * @return                              The index of the lower energy.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int URR_bandTables::energyIndex( double a_energy, double *a_energyFraction ) const {
+
+    MCGIDI_VectorSizeType lower = binarySearchVector( a_energy, m_energies );
+
+    *a_energyFraction = 1.0;
+    if( lower == -2 ) return( 0 );
+    if( lower == -1 ) return( static_cast<int>( m_energies.size( ) ) - 1 );
+
+    if( ( m_energyInterpolation == Interpolation::LINLIN ) || ( m_energyInterpolation == Interpolation::LOGLIN ) ) {
+        *a_energyFraction = ( m_energies[lower+1] - a_energy ) / ( m_energies[lower+1] - m_energies[lower] ); }
+    else if( ( m_energyInterpolation == Interpolation::LINLOG ) || ( m_energyInterpolation == Interpolation::LOGLOG ) ) {
+        *a_energyFraction = log( m_energies[lower+1] / a_energy ) / log( m_energies[lower+1] / m_energies[lower] );
+    }
+
+    return( static_cast<int>( lower ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the URR cross section factor for reaction *a_reactionIndex* at the energy specified by *a_energyIndex* and *a_energyFraction*
+ * as returned by **energyIndex**. As *a_rngValue* is the same for all reactions, the factors of all reactions are sampled from
+ * the same band quantile, giving the correlated sampling of the probability tables. Returns 1 if the reaction does not have URR 
+ * probability tables.
+ *
+ * @param a_reactionIndex       [in]    The index of the reaction.
+ * @param a_energyIndex         [in]    The energy index returned by **energyIndex**.
+ * @param a_energyFraction      [in]    The energy fraction returned by **energyIndex**.
+ * @param a_rngValue            [in]    The random number used to select the band.
+ *
+ * @return                              The URR cross section factor.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double URR_bandTables::factor( int a_reactionIndex, int a_energyIndex, double a_energyFraction, double a_rngValue ) const {
+
+    int slot = m_reactionSlots[a_reactionIndex];
+
+    if( slot < 0 ) return( 1.0 );
+
+    int table = slot * static_cast<int>( m_energies.size( ) ) + a_energyIndex;
+    double sampled1 = sampleTable( table, a_rngValue );
+
+    if( a_energyFraction == 1.0 ) return( sampled1 );
+
+    double sampled2 = sampleTable( table + 1, a_rngValue );
+
+    if( ( m_energyInterpolation == Interpolation::LINLIN ) || ( m_energyInterpolation == Interpolation::LINLOG ) )
+        return( a_energyFraction * sampled1 + ( 1 - a_energyFraction ) * sampled2 );
+
+    return( sampled2 * pow( sampled2 / sampled1, a_energyFraction ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the URR cross section factor for reaction *a_reactionIndex* at energy *a_energy*.
+ *
+ * @param a_reactionIndex       [in]    The index of the reaction.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_rngValue            [in]    The random number used to select the band.
+ *
+ * @return                              The URR cross section factor.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double URR_bandTables::factor( int a_reactionIndex, double a_energy, double a_rngValue ) const {
+
+    if( m_reactionSlots[a_reactionIndex] < 0 ) return( 1.0 );
+
+    double energyFraction;
+    int energyIndex1 = energyIndex( a_energy, &energyFraction );
+
+    return( factor( a_reactionIndex, energyIndex1, energyFraction, a_rngValue ) );
+}
+
+/* *********************************************************************************************************//**
+ * Samples the cross section factor from the table at index *a_table*. This is the same as **Probabilities::Xs_pdf_cdf1d::sample**
+ * but for the flattened data.
+ *
+ * @param a_table               [in]    The index of the table in *m_offsets*.
+ * @param a_rngValue            [in]    The random number used to select the band.
+ *
+ * @return                              The sampled cross section factor.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double URR_bandTables::sampleTable( int a_table, double a_rngValue ) const {
+
+    MCGIDI_VectorSizeType lower = binarySearchVectorBounded( a_rngValue, m_cdfs, m_offsets[a_table], m_offsets[a_table+1] - 1, false );
+
+    if( lower < 0 ) {                                   // This should never happen.
+        THROW( "URR_bandTables::sampleTable: lower < 0." );
+    }
+
+    double fraction = ( m_cdfs[lower+1] - a_rngValue ) / ( m_cdfs[lower+1] - m_cdfs[lower] );
+
+    if( m_bandInterpolation == Interpolation::FLAT ) return( fraction * m_factors[lower] + ( 1 - fraction ) * m_factors[lower+1] );
+
+    double pdf1 = m_pdfs[lower], pdf2 = m_pdfs[lower+1];
+    double slope = pdf2 - pdf1;
+
+    if( slope == 0.0 ) {
+        if( pdf1 == 0.0 ) {
+            if( lower == m_offsets[a_table] ) return( m_factors[lower+1] );
+            return( m_factors[lower] );
+        }
+        return( fraction * m_factors[lower] + ( 1 - fraction ) * m_factors[lower+1] );
+    }
+
+    slope = slope / ( m_factors[lower+1] - m_factors[lower] );
+
+    double d1 = a_rngValue - m_cdfs[lower];
+    double d2 = m_cdfs[lower+1] - a_rngValue;
+
+    if( d2 > d1 ) return( m_factors[lower] + ( sqrt( pdf1 * pdf1 + 2. * slope * d1 ) - pdf1 ) / slope );       // Closer to lower.
+    return( m_factors[lower+1] - ( pdf2 - sqrt( pdf2 * pdf2 - 2. * slope * d2 ) ) / slope );                    // Closer to lower + 1.
+}
+
+/* *********************************************************************************************************//**
+ * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
+ * bytes, pack *this* or unpack *this* depending on *a_mode*.
+ *
+ * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
+ * @param a_mode                [in]    Specifies the action of this method.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void URR_bandTables::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+
+    DATA_MEMBER_CAST( m_energyInterpolation, a_buffer, a_mode, Interpolation );
+    DATA_MEMBER_CAST( m_bandInterpolation, a_buffer, a_mode, Interpolation );
+    DATA_MEMBER_VECTOR_DOUBLE( m_energies, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_reactionSlots, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_offsets, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_factors, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_pdfs, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_cdfs, a_buffer, a_mode );
+}
+
 }       // End namespace MCGIDI.
@@ -14,6 +14,8 @@
 
 namespace MCGIDI {
 
+class Interner;
+
 /*
 ============================================================
 ========================= DataBuffer =======================
@@ -35,8 +37,10 @@ class DataBuffer {
         char *m_placementStart;
         char *m_placement;
         size_t m_maxPlacementSize;
+        size_t m_sharedPlacementSize;       // In Memory mode, the number of bytes not placed as the data are shared with other objects.
+        Interner *m_interner;               // In Intern mode, the interner that the floating point vectors are passed to.
 
-        enum class Mode { Count, Pack, Unpack, Reset, Memory };
+        enum class Mode { Count, Pack, Unpack, Reset, Memory, Intern };
 
         HOST_DEVICE DataBuffer( void ) :
                 m_intIndex( 0 ),
@@ -49,7 +53,9 @@ class DataBuffer {
                 m_longData( nullptr ),
                 m_placementStart( nullptr ),
                 m_placement( nullptr ),
-                m_maxPlacementSize( 0 ) {
+                m_maxPlacementSize( 0 ),
+                m_sharedPlacementSize( 0 ),
+                m_interner( nullptr ) {
         }
 
         HOST_DEVICE DataBuffer( DataBuffer const &rhs ) :
@@ -63,7 +69,9 @@ class DataBuffer {
                 m_longData( nullptr ),
                 m_placementStart( nullptr ),
                 m_placement( nullptr ),
-                m_maxPlacementSize( 0 ) {
+                m_maxPlacementSize( 0 ),
+                m_sharedPlacementSize( 0 ),
+                m_interner( nullptr ) {
 
         }
 
@@ -98,6 +106,8 @@ class DataBuffer {
             m_placementStart   = a_input.m_placementStart;
             m_maxPlacementSize = a_input.m_maxPlacementSize;
             m_placement        = a_input.m_placement;
+            m_sharedPlacementSize = a_input.m_sharedPlacementSize;
+            m_interner         = a_input.m_interner;
         }
 
         // Useful for temporary buffers that we don;t want destroying the data in the destructor
@@ -234,7 +244,8 @@ class DataBuffer {
         size_t vector_size = member.size(); \
         DATA_MEMBER_INT(vector_size, (buf), mode); \
         if ( mode == DataBuffer::Mode::Unpack ) member.resize(vector_size, &(buf).m_placement); \
-        if ( mode == DataBuffer::Mode::Memory ) { (buf).incrementPlacement(sizeof(double) * member.capacity()); } \
+        if ( mode == DataBuffer::Mode::Memory ) { (buf).incrementPlacement(sizeof(member[0]) * member.capacity()); } \
+        if ( mode == DataBuffer::Mode::Intern ) { (buf).m_interner->intern(member); vector_size = 0; } \
         for ( size_t member_index = 0; member_index < vector_size; member_index++ ) \
         { \
             DATA_MEMBER_FLOAT(member[member_index], (buf), mode); \
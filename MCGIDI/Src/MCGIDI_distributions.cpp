@@ -238,7 +238,7 @@ HOST_DEVICE void AngularTwoBody::sample( double a_X, Sampling::Input &a_input, d
     }
     if( Kp < 0 ) Kp = 0.;           // FIXME There needs to be a better test here.
 
-    a_input.m_mu = m_angular->sample( a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_input.m_mu = sampleProbability2d( m_angular, a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
     a_input.m_phi = 2. * M_PI * a_userrng( a_rngState );
     kinetics_COMKineticEnergy2LabEnergyAndMomentum( beta, Kp, productMass( ), m_residualMass, a_input );
 }
@@ -455,7 +455,7 @@ HOST_DEVICE bool AngularTwoBody::upscatterModelB( double a_kineticLab, Sampling:
 
     double betaNeutronOut = m2_12 * relativeBeta; 
     double kineticEnergyRelative = particleKineticEnergy( neutronMass, betaNeutronOut );
-    double muCOM = m_angular->sample( kineticEnergyRelative, a_userrng( a_rngState ), a_userrng, a_rngState );
+    double muCOM = sampleProbability2d( m_angular, kineticEnergyRelative, a_userrng( a_rngState ), a_userrng, a_rngState );
     double phiCOM = 2.0 * M_PI * a_userrng( a_rngState );
     double SCcom = sqrt( 1.0 - muCOM * muCOM );
     double SScom = SCcom * sin( phiCOM );
@@ -583,8 +583,8 @@ HOST_DEVICE Uncorrelated::~Uncorrelated( ) {
 HOST_DEVICE void Uncorrelated::sample( double a_X, Sampling::Input &a_input, double (*a_userrng)( void * ), void *a_rngState ) const {
 
     a_input.m_sampledType = Sampling::SampledType::uncorrelatedBody;
-    a_input.m_mu = m_angular->sample( a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
-    a_input.m_energyOut1 = m_energy->sample( a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_input.m_mu = sampleProbability2d( m_angular, a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_input.m_energyOut1 = sampleProbability2d( m_energy, a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
     a_input.m_phi = 2. * M_PI * a_userrng( a_rngState );
     a_input.m_frame = productFrame( );
 }
@@ -608,7 +608,7 @@ HOST_DEVICE double Uncorrelated::angleBiasing( Reaction const *a_reaction, doubl
 
     if( productFrame( ) != GIDI::Frame::lab ) THROW( "Uncorrelated::angleBiasing: center-of-mass not supported." );
 
-    a_energy_out = m_energy->sample( a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_energy_out = sampleProbability2d( m_energy, a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
     return( m_angular->evaluate( a_energy_in, a_mu_lab ) );
 }
 
@@ -677,11 +677,11 @@ HOST_DEVICE EnergyAngularMC::~EnergyAngularMC( ) {
 
 HOST_DEVICE void EnergyAngularMC::sample( double a_X, Sampling::Input &a_input, double (*a_userrng)( void * ), void *a_rngState ) const {
 
-    double energyOut_1, energyOut_2;
+    double energyOut_1, energyOut_2, bracketRngValue;
 
     a_input.m_sampledType = Sampling::SampledType::uncorrelatedBody;
-    a_input.m_energyOut1 = m_energy->sample2dOf3d( a_X, a_userrng( a_rngState ), a_userrng, a_rngState, &energyOut_1, &energyOut_2 );
-    a_input.m_mu = m_angularGivenEnergy->sample( a_X, energyOut_1, energyOut_2, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_input.m_energyOut1 = m_energy->sample2dOf3d( a_X, a_userrng( a_rngState ), a_userrng, a_rngState, &energyOut_1, &energyOut_2, &bracketRngValue );
+    a_input.m_mu = sampleProbability3d( m_angularGivenEnergy, a_X, energyOut_1, energyOut_2, bracketRngValue, a_userrng( a_rngState ), a_userrng, a_rngState );
     a_input.m_phi = 2. * M_PI * a_userrng( a_rngState );
     a_input.m_frame = productFrame( );
 }
@@ -706,10 +706,10 @@ HOST_DEVICE double EnergyAngularMC::angleBiasing( Reaction const *a_reaction, do
     double probability = 0.0;
 
     if( productFrame( ) == GIDI::Frame::centerOfMass ) {
-        a_energy_out = m_energy->sample( a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
+        a_energy_out = sampleProbability2d( m_energy, a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
 
         double initialMass = projectileMass( ) + targetMass( );
-        double energy_out_com = m_energy->sample( a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
+        double energy_out_com = sampleProbability2d( m_energy, a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
         double productBeta = MCGIDI_particleBeta( productMass( ), energy_out_com );
         double boostBeta = sqrt( a_energy_in * ( a_energy_in + 2. * projectileMass( ) ) ) / ( a_energy_in + initialMass );      // beta = v/c.
 
@@ -733,7 +733,7 @@ HOST_DEVICE double EnergyAngularMC::angleBiasing( Reaction const *a_reaction, do
         productBetaLab2 /= 1.0 - muPlus * productBeta * boostBeta;
         a_energy_out = particleKineticEnergyFromBeta2( productMass( ), productBetaLab2 ); }
     else {
-        a_energy_out = m_energy->sample( a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
+        a_energy_out = sampleProbability2d( m_energy, a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
         probability =  m_angularGivenEnergy->evaluate( a_energy_in, a_energy_out, a_mu_lab );
     }
 
@@ -805,11 +805,11 @@ HOST_DEVICE AngularEnergyMC::~AngularEnergyMC( ) {
 
 HOST_DEVICE void AngularEnergyMC::sample( double a_X, Sampling::Input &a_input, double (*a_userrng)( void * ), void *a_rngState ) const {
 
-    double mu_1, mu_2;
+    double mu_1, mu_2, bracketRngValue;
 
     a_input.m_sampledType = Sampling::SampledType::uncorrelatedBody;
-    a_input.m_mu = m_angular->sample2dOf3d( a_X, a_userrng( a_rngState ), a_userrng, a_rngState, &mu_1, &mu_2 );
-    a_input.m_energyOut1 = m_energyGivenAngular->sample( a_X, mu_1, mu_2, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_input.m_mu = m_angular->sample2dOf3d( a_X, a_userrng( a_rngState ), a_userrng, a_rngState, &mu_1, &mu_2, &bracketRngValue );
+    a_input.m_energyOut1 = sampleProbability3d( m_energyGivenAngular, a_X, mu_1, mu_2, bracketRngValue, a_userrng( a_rngState ), a_userrng, a_rngState );
     a_input.m_phi = 2. * M_PI * a_userrng( a_rngState );
     a_input.m_frame = productFrame( );
 }
@@ -833,7 +833,7 @@ HOST_DEVICE double AngularEnergyMC::angleBiasing( Reaction const *a_reaction, do
 
     if( productFrame( ) != GIDI::Frame::lab ) THROW( "AngularEnergyMC::angleBiasing: center-of-mass not supported." );
 
-    a_energy_out = m_energyGivenAngular->sample( a_energy_in, a_mu_lab, a_mu_lab, a_userrng( a_rngState), a_userrng, a_rngState );
+    a_energy_out = sampleProbability3d( m_energyGivenAngular, a_energy_in, a_mu_lab, a_mu_lab, -1.0, a_userrng( a_rngState ), a_userrng, a_rngState );
     return( m_angular->evaluate( a_energy_in, a_mu_lab ) );
 }
 
@@ -906,7 +906,7 @@ HOST_DEVICE KalbachMann::~KalbachMann( ) {
 HOST_DEVICE void KalbachMann::sample( double a_X, Sampling::Input &a_input, double (*a_userrng)( void * ), void *a_rngState ) const {
 
     a_input.m_sampledType = Sampling::SampledType::uncorrelatedBody;
-    a_input.m_energyOut1 = m_f->sample( a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
+    a_input.m_energyOut1 = sampleProbability2d( m_f, a_X, a_userrng( a_rngState ), a_userrng, a_rngState );
     double rValue = m_r->evaluate( a_X, a_input.m_energyOut1 );
     double aValue = m_a->evaluate( a_X, a_input.m_energyOut1 );
 
@@ -947,7 +947,7 @@ HOST_DEVICE double KalbachMann::angleBiasing( Reaction const *a_reaction, double
     a_energy_out = 0.0;
 
     double initialMass = projectileMass( ) + targetMass( );
-    double energy_out_com = m_f->sample( a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
+    double energy_out_com = sampleProbability2d( m_f, a_energy_in, a_userrng( a_rngState ), a_userrng, a_rngState );
     double productBeta = MCGIDI_particleBeta( productMass( ), energy_out_com );
     double boostBeta = sqrt( a_energy_in * ( a_energy_in + 2. * projectileMass( ) ) ) / ( a_energy_in + initialMass );      // beta = v/c.
 
@@ -1860,6 +1860,136 @@ HOST_DEVICE void Unspecified::serialize( DataBuffer &a_buffer, DataBuffer::Mode
 }
 
 
+/* *********************************************************************************************************//**
+ * Turns on stochastic interpolation for the tabulated probabilities of *a_distribution*.
+ *
+ * @param a_distribution        [in]    The distribution whose probabilities are modified.
+ ***********************************************************************************************************/
+
+HOST static void distributionSetStochasticInterpolation( Distribution *a_distribution ) {
+
+    switch( a_distribution->type( ) ) {
+    case Type::angularTwoBody :
+        Probabilities::setStochasticInterpolation2d( static_cast<AngularTwoBody *>( a_distribution )->angular( ), true );
+        break;
+    case Type::uncorrelated : {
+        Uncorrelated *uncorrelated = static_cast<Uncorrelated *>( a_distribution );
+
+        Probabilities::setStochasticInterpolation2d( uncorrelated->angular( ), true );
+        Probabilities::setStochasticInterpolation2d( uncorrelated->energy( ), true );
+        break; }
+    case Type::KalbachMann :
+        Probabilities::setStochasticInterpolation2d( static_cast<KalbachMann *>( a_distribution )->f( ), true );
+        break;
+    case Type::energyAngularMC : {
+        EnergyAngularMC *energyAngularMC = static_cast<EnergyAngularMC *>( a_distribution );
+
+        Probabilities::setStochasticInterpolation2d( energyAngularMC->energy( ), true );
+        Probabilities::setStochasticInterpolation3d( energyAngularMC->angularGivenEnergy( ), true );
+        break; }
+    case Type::angularEnergyMC : {
+        AngularEnergyMC *angularEnergyMC = static_cast<AngularEnergyMC *>( a_distribution );
+
+        Probabilities::setStochasticInterpolation2d( angularEnergyMC->angular( ), true );
+        Probabilities::setStochasticInterpolation3d( angularEnergyMC->energyGivenAngular( ), true );
+        break; }
+    default :
+        break;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds alias tables for the tabulated probabilities of *a_distribution* that are sampled independently of other probabilities.
+ * Must be called after **distributionSetStochasticInterpolation** when stochastic interpolation is wanted.
+ *
+ * @param a_distribution        [in]    The distribution whose probabilities are modified.
+ ***********************************************************************************************************/
+
+HOST static void distributionBuildAliasTables( Distribution *a_distribution ) {
+
+    switch( a_distribution->type( ) ) {
+    case Type::angularTwoBody :
+        Probabilities::buildAliasTables2d( static_cast<AngularTwoBody *>( a_distribution )->angular( ) );
+        break;
+    case Type::uncorrelated : {
+        Uncorrelated *uncorrelated = static_cast<Uncorrelated *>( a_distribution );
+
+        Probabilities::buildAliasTables2d( uncorrelated->angular( ) );
+        Probabilities::buildAliasTables2d( uncorrelated->energy( ) );
+        break; }
+    case Type::KalbachMann :
+        Probabilities::buildAliasTables2d( static_cast<KalbachMann *>( a_distribution )->f( ) );
+        break;
+    case Type::energyAngularMC : {
+        EnergyAngularMC *energyAngularMC = static_cast<EnergyAngularMC *>( a_distribution );
+
+        Probabilities::buildAliasTables2d( energyAngularMC->energy( ) );
+        Probabilities::buildAliasTables3d( energyAngularMC->angularGivenEnergy( ) );
+        break; }
+    case Type::angularEnergyMC : {
+        AngularEnergyMC *angularEnergyMC = static_cast<AngularEnergyMC *>( a_distribution );
+
+        Probabilities::buildAliasTables2d( angularEnergyMC->angular( ) );
+        Probabilities::buildAliasTables3d( angularEnergyMC->energyGivenAngular( ) );
+        break; }
+    default :
+        break;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for the tabulated probabilities of *a_distribution*. Must be called after **distributionBuildAliasTables**
+ * when alias tables are wanted.
+ *
+ * @param a_distribution        [in]    The distribution whose probabilities are modified.
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST static void distributionBuildGuideTables( Distribution *a_distribution, double a_guideTableFactor ) {
+
+    switch( a_distribution->type( ) ) {
+    case Type::angularTwoBody :
+        Probabilities::buildGuideTables2d( static_cast<AngularTwoBody *>( a_distribution )->angular( ), a_guideTableFactor );
+        break;
+    case Type::uncorrelated : {
+        Uncorrelated *uncorrelated = static_cast<Uncorrelated *>( a_distribution );
+
+        Probabilities::buildGuideTables2d( uncorrelated->angular( ), a_guideTableFactor );
+        Probabilities::buildGuideTables2d( uncorrelated->energy( ), a_guideTableFactor );
+        break; }
+    case Type::KalbachMann :
+        Probabilities::buildGuideTables2d( static_cast<KalbachMann *>( a_distribution )->f( ), a_guideTableFactor );
+        break;
+    case Type::energyAngularMC : {
+        EnergyAngularMC *energyAngularMC = static_cast<EnergyAngularMC *>( a_distribution );
+
+        Probabilities::buildGuideTables2d( energyAngularMC->energy( ), a_guideTableFactor );
+        Probabilities::buildGuideTables3d( energyAngularMC->angularGivenEnergy( ), a_guideTableFactor );
+        break; }
+    case Type::angularEnergyMC : {
+        AngularEnergyMC *angularEnergyMC = static_cast<AngularEnergyMC *>( a_distribution );
+
+        Probabilities::buildGuideTables2d( angularEnergyMC->angular( ), a_guideTableFactor );
+        Probabilities::buildGuideTables3d( angularEnergyMC->energyGivenAngular( ), a_guideTableFactor );
+        break; }
+    default :
+        break;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds inverse cdf tables for the analytic outgoing energy spectra (evaporation, simple Maxwellian fission and Watt) of *a_distribution*.
+ *
+ * @param a_distribution        [in]    The distribution whose probabilities are modified.
+ * @param a_tolerance           [in]    The tolerance of the tables relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST static void distributionBuildInverseCdfTables( Distribution *a_distribution, double a_tolerance ) {
+
+    if( a_distribution->type( ) == Type::uncorrelated )
+        Probabilities::buildInverseCdfTables2d( static_cast<Uncorrelated *>( a_distribution )->energy( ), a_tolerance );
+}
+
 /* *********************************************************************************************************//**
  * This function is used to call the proper distribution constructor for *a_distribution*.
  *
@@ -1909,6 +2039,11 @@ HOST Distribution *parseGIDI( GIDI::Suite const &a_distribution, SetupInfo &a_se
         THROW( "MCGIDI::Distributions::parseGIDI: unsupported distribution" );
     }
 
+    if( a_settings.wantStochasticInterpolation( ) ) distributionSetStochasticInterpolation( distribution );
+    if( a_settings.wantAliasTables( ) ) distributionBuildAliasTables( distribution );
+    if( a_settings.guideTableFactor( ) > 0.0 ) distributionBuildGuideTables( distribution, a_settings.guideTableFactor( ) );
+    if( a_settings.spectrumTableTolerance( ) > 0.0 ) distributionBuildInverseCdfTables( distribution, a_settings.spectrumTableTolerance( ) );
+
     return( distribution );
 }
 
@@ -1924,6 +2059,44 @@ HOST_DEVICE Type DistributionType( Distribution const *a_distribution ) {
     return( a_distribution->type( ) );
 }
 
+/* *********************************************************************************************************//**
+ * Samples *a_distribution* by dispatching on its type to the non-virtual **sample** method of its class so that the compiler can
+ * inline it. If MCGIDI_VirtualDispatch is defined, the virtual **sample** is called.
+ *
+ * @param a_distribution        [in]    The distribution to sample.
+ * @param a_X                   [in]    The energy of the projectile.
+ * @param a_input               [in]    Sample options requested by user.
+ * @param a_userrng             [in]    The random number generator function.
+ * @param a_rngState            [in]    The state for the random number generator.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void sampleDistribution( Distribution const *a_distribution, double a_X, Sampling::Input &a_input, double (*a_userrng)( void * ), void *a_rngState ) {
+
+#ifndef MCGIDI_VirtualDispatch
+    switch( a_distribution->type( ) ) {
+    case Type::angularTwoBody :
+        static_cast<AngularTwoBody const *>( a_distribution )->AngularTwoBody::sample( a_X, a_input, a_userrng, a_rngState );
+        return;
+    case Type::uncorrelated :
+        static_cast<Uncorrelated const *>( a_distribution )->Uncorrelated::sample( a_X, a_input, a_userrng, a_rngState );
+        return;
+    case Type::KalbachMann :
+        static_cast<KalbachMann const *>( a_distribution )->KalbachMann::sample( a_X, a_input, a_userrng, a_rngState );
+        return;
+    case Type::energyAngularMC :
+        static_cast<EnergyAngularMC const *>( a_distribution )->EnergyAngularMC::sample( a_X, a_input, a_userrng, a_rngState );
+        return;
+    case Type::angularEnergyMC :
+        static_cast<AngularEnergyMC const *>( a_distribution )->AngularEnergyMC::sample( a_X, a_input, a_userrng, a_rngState );
+        return;
+    default :
+        break;
+    }
+#endif
+
+    a_distribution->sample( a_X, a_input, a_userrng, a_rngState );
+}
+
 }
 
 }
@@ -198,7 +198,7 @@ class AngularEnergyMC : public Distribution {
         }
         HOST_DEVICE void sample_pdf( double E_in_lab, double mu, double &E_out, double random_num, Sampling::Input &a_input,
                 double (*a_userrng)( void * ), void *a_rngState ) const {
-            E_out = m_energyGivenAngular->sample( E_in_lab, mu, mu, random_num, a_userrng, a_rngState );
+            E_out = m_energyGivenAngular->sample( E_in_lab, mu, mu, -1.0, random_num, a_userrng, a_rngState );
         }
 };
 
@@ -360,6 +360,7 @@ class Unspecified : public Distribution {
 */
 HOST Distribution *parseGIDI( GIDI::Suite const &a_distribution, SetupInfo &a_setupInfo, Transporting::MC const &a_settings );
 HOST_DEVICE Type DistributionType( Distribution const *a_distribution );
+HOST_DEVICE void sampleDistribution( Distribution const *a_distribution, double a_X, Sampling::Input &a_input, double (*a_userrng)( void * ), void *a_rngState );
 
 }
 
@@ -8,13 +8,23 @@
 */
 
 #include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
 
 #include "MCGIDI.hpp"
 
 namespace MCGIDI {
 
 /*! \class DomainHash
- * This class stores the data needed for logarithmic hash look up of a domain. This is used to find a cross section given a projectile's energy.
+ * This class stores the data needed for a hash look up of a domain. This is used to find a cross section given a projectile's energy.
+ * Three strategies are supported:
+ *
+ *      - DomainHashMode::logarithmic:  *m_bins* bins of equal lethargy, indexed by calling log().
+ *      - DomainHashMode::exponentBits: bins formed from the IEEE-754 exponent and the *m_mantissaBits* leading mantissa bits of the domain value.
+ *                                      Each octave is divided into 2^*m_mantissaBits* bins of equal width and no transcendental function is called.
+ *      - DomainHashMode::equalPoints:  bins that each hold about the same number of points from a user supplied grid (e.g., the union of the grids
+ *                                      of all protares). The index is found by a binary search of the *m_bins* + 1 boundaries.
  */
 
 /* *********************************************************************************************************//**
@@ -22,12 +32,16 @@ namespace MCGIDI {
  ***********************************************************************************************************/
 
 HOST_DEVICE DomainHash::DomainHash( ) :
+        m_mode( DomainHashMode::logarithmic ),
         m_bins( 0 ),
         m_domainMin( 0.0 ),
         m_domainMax( 0.0 ),
         m_u_domainMin( 0.0 ),
         m_u_domainMax( 0.0 ),
-        m_inverse_du( 0.0 ) {
+        m_inverse_du( 0.0 ),
+        m_mantissaBits( 0 ),
+        m_bitsOffset( 0 ),
+        m_boundaries( ) {
 
 }
 
@@ -38,13 +52,90 @@ HOST_DEVICE DomainHash::DomainHash( ) :
  ***********************************************************************************************************/
 
 HOST_DEVICE DomainHash::DomainHash( int a_bins, double a_domainMin, double a_domainMax ) :
+        m_mode( DomainHashMode::logarithmic ),
         m_bins( a_bins ),
         m_domainMin( a_domainMin ),
         m_domainMax( a_domainMax ),
         m_u_domainMin( log( a_domainMin ) ),
         m_u_domainMax( log( a_domainMax ) ),
-        m_inverse_du( a_bins / ( m_u_domainMax - m_u_domainMin ) ) {
+        m_inverse_du( a_bins / ( m_u_domainMax - m_u_domainMin ) ),
+        m_mantissaBits( 0 ),
+        m_bitsOffset( 0 ),
+        m_boundaries( ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * For DomainHashMode::exponentBits, the number of mantissa bits is the smallest one giving at least *a_bins* bins over
+ * the domain and **bins** returns the actual number of bins. DomainHashMode::equalPoints requires a grid and is not
+ * supported by this constructor.
+ *
+ * @param a_mode                [in]    The hash strategy.
+ * @param a_bins                [in]    The (minimum) number of bins for the hash function.
+ * @param a_domainMin           [in]    The minimum value of the energy domain for the hash function.
+ * @param a_domainMax           [in]    The maximum value of the energy domain for the hash function.
+ ***********************************************************************************************************/
 
+HOST_DEVICE DomainHash::DomainHash( DomainHashMode a_mode, int a_bins, double a_domainMin, double a_domainMax ) :
+        m_mode( a_mode ),
+        m_bins( a_bins ),
+        m_domainMin( a_domainMin ),
+        m_domainMax( a_domainMax ),
+        m_u_domainMin( log( a_domainMin ) ),
+        m_u_domainMax( log( a_domainMax ) ),
+        m_inverse_du( a_bins / ( m_u_domainMax - m_u_domainMin ) ),
+        m_mantissaBits( 0 ),
+        m_bitsOffset( 0 ),
+        m_boundaries( ) {
+
+    if( m_mode == DomainHashMode::exponentBits ) {
+        initializeExponentBits( a_bins ); }
+    else if( m_mode == DomainHashMode::equalPoints ) {
+        THROW( "DomainHash::DomainHash: DomainHashMode::equalPoints requires a grid." );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Constructs a DomainHash of mode DomainHashMode::equalPoints whose bins each contain about the same number of points
+ * of *a_grid* that are inside the domain. If *a_grid* has fewer points than *a_bins*, the number of bins is reduced.
+ *
+ * @param a_bins                [in]    The number of bins for the hash function.
+ * @param a_domainMin           [in]    The minimum value of the energy domain for the hash function.
+ * @param a_domainMax           [in]    The maximum value of the energy domain for the hash function.
+ * @param a_grid                [in]    The grid (e.g., the union of the energy grids of all protares) used to place the bin boundaries.
+ ***********************************************************************************************************/
+
+HOST DomainHash::DomainHash( int a_bins, double a_domainMin, double a_domainMax, std::vector<double> const &a_grid ) :
+        m_mode( DomainHashMode::equalPoints ),
+        m_bins( a_bins ),
+        m_domainMin( a_domainMin ),
+        m_domainMax( a_domainMax ),
+        m_u_domainMin( log( a_domainMin ) ),
+        m_u_domainMax( log( a_domainMax ) ),
+        m_inverse_du( a_bins / ( m_u_domainMax - m_u_domainMin ) ),
+        m_mantissaBits( 0 ),
+        m_bitsOffset( 0 ),
+        m_boundaries( ) {
+
+    std::vector<double> grid;
+
+    grid.reserve( a_grid.size( ) );
+    for( std::vector<double>::const_iterator iter = a_grid.begin( ); iter != a_grid.end( ); ++iter ) {
+        if( ( *iter > m_domainMin ) && ( *iter < m_domainMax ) ) grid.push_back( *iter );
+    }
+    std::sort( grid.begin( ), grid.end( ) );
+    grid.erase( std::unique( grid.begin( ), grid.end( ) ), grid.end( ) );
+
+    std::size_t numberOfPoints = grid.size( );
+    if( static_cast<std::size_t>( m_bins ) > numberOfPoints + 1 ) m_bins = static_cast<int>( numberOfPoints + 1 );
+    if( m_bins < 1 ) THROW( "DomainHash::DomainHash: number of bins must be positive." );
+
+    m_boundaries.resize( m_bins + 1 );
+    m_boundaries[0] = m_domainMin;
+    for( int i1 = 1; i1 < m_bins; ++i1 ) m_boundaries[i1] = grid[( i1 * numberOfPoints ) / m_bins];
+    m_boundaries[m_bins] = m_domainMax;
+
+    m_inverse_du = m_bins / ( m_u_domainMax - m_u_domainMin );
 }
 
 /* *********************************************************************************************************//**
@@ -52,12 +143,44 @@ HOST_DEVICE DomainHash::DomainHash( int a_bins, double a_domainMin, double a_dom
  ***********************************************************************************************************/
 
 HOST_DEVICE DomainHash::DomainHash( DomainHash const &a_domainHash ) :
+        m_mode( a_domainHash.mode( ) ),
         m_bins( a_domainHash.bins( ) ),
         m_domainMin( a_domainHash.domainMin( ) ),
         m_domainMax( a_domainHash.domainMax( ) ), 
         m_u_domainMin( a_domainHash.u_domainMin( ) ),
         m_u_domainMax( a_domainHash.u_domainMax( ) ),
-        m_inverse_du( a_domainHash.inverse_du( ) ) {
+        m_inverse_du( a_domainHash.inverse_du( ) ),
+        m_mantissaBits( a_domainHash.mantissaBits( ) ),
+        m_bitsOffset( a_domainHash.bitsOffset( ) ),
+        m_boundaries( a_domainHash.boundaries( ) ) {
+}
+
+/* *********************************************************************************************************//**
+ * Sets *m_mantissaBits* to the smallest number of leading mantissa bits for which the domain spans at least *a_bins* bins
+ * and sets *m_bitsOffset* and *m_bins* accordingly. The number of mantissa bits is limited to 16 so that the shifted bits fit in an int.
+ *
+ * @param a_bins                [in]    The minimum number of bins desired.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void DomainHash::initializeExponentBits( int a_bins ) {
+
+    if( m_domainMin <= 0.0 ) THROW( "DomainHash::initializeExponentBits: domain minimum must be positive." );
+
+    uint64_t bitsMin, bitsMax;
+
+    memcpy( &bitsMin, &m_domainMin, sizeof( bitsMin ) );
+    memcpy( &bitsMax, &m_domainMax, sizeof( bitsMax ) );
+
+    for( m_mantissaBits = 0; m_mantissaBits < 16; ++m_mantissaBits ) {
+        int shift = 52 - m_mantissaBits;
+
+        if( static_cast<int>( ( bitsMax >> shift ) - ( bitsMin >> shift ) ) + 1 >= a_bins ) break;
+    }
+
+    int shift = 52 - m_mantissaBits;
+    m_bitsOffset = static_cast<int>( bitsMin >> shift );
+    m_bins = static_cast<int>( bitsMax >> shift ) - m_bitsOffset + 1;
+    m_inverse_du = m_bins / ( m_u_domainMax - m_u_domainMin );
 }
 
 /* *********************************************************************************************************//**
@@ -74,6 +197,19 @@ HOST_DEVICE int DomainHash::index( double a_domain ) const {
 
     if( a_domain < m_domainMin ) return( 0 );
     if( a_domain > m_domainMax ) return( m_bins + 1 );
+
+    switch( m_mode ) {
+    case DomainHashMode::exponentBits : {
+        uint64_t bits;
+
+        memcpy( &bits, &a_domain, sizeof( bits ) );
+        return( static_cast<int>( bits >> ( 52 - m_mantissaBits ) ) - m_bitsOffset + 1 ); }
+    case DomainHashMode::equalPoints :
+        return( static_cast<int>( binarySearchVector( a_domain, m_boundaries, true ) ) + 1 );
+    default :
+        break;
+    }
+
     double dIndex = m_inverse_du * ( log( a_domain ) - m_u_domainMin ) + 1;
     return( (int) dIndex );
 }
@@ -115,12 +251,41 @@ HOST_DEVICE Vector<int> DomainHash::map( Vector<double> &a_domainValues ) const
 
 HOST_DEVICE void DomainHash::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
 
+    int mode = 0;
+    switch( m_mode ) {
+    case DomainHashMode::logarithmic :
+        break;
+    case DomainHashMode::exponentBits :
+        mode = 1;
+        break;
+    case DomainHashMode::equalPoints :
+        mode = 2;
+        break;
+    }
+    DATA_MEMBER_INT( mode, a_buffer, a_mode );
+    if( a_mode == DataBuffer::Mode::Unpack ) {
+        switch( mode ) {
+        case 0 :
+            m_mode = DomainHashMode::logarithmic;
+            break;
+        case 1 :
+            m_mode = DomainHashMode::exponentBits;
+            break;
+        case 2 :
+            m_mode = DomainHashMode::equalPoints;
+            break;
+        }
+    }
+
     DATA_MEMBER_INT( m_bins, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_domainMin, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_domainMax, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_u_domainMin, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_u_domainMax, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_inverse_du, a_buffer, a_mode );
+    DATA_MEMBER_INT( m_mantissaBits, a_buffer, a_mode );
+    DATA_MEMBER_INT( m_bitsOffset, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_boundaries, a_buffer, a_mode );
 }
 
 /* *********************************************************************************************************//**
@@ -135,11 +300,20 @@ HOST_DEVICE void DomainHash::print( bool a_printValues ) const {
     std::cout << "    m_domainMin = " << m_domainMin << "  << m_domainMax = " << m_domainMax << std::endl;
     std::cout << "    m_u_domainMin = " << m_u_domainMin << "  << m_u_domainMax = " << m_u_domainMax << std::endl;
     std::cout << "    m_inverse_du = " << m_inverse_du << std::endl;
+    if( m_mode == DomainHashMode::exponentBits ) std::cout << "    m_mantissaBits = " << m_mantissaBits << "  m_bitsOffset = " << m_bitsOffset << std::endl;
     if( a_printValues ) {
         double domain = m_domainMin, factor = pow( m_domainMax / m_domainMin, 1. / m_bins );
         char Str[32];
 
         for( int i1 = 0; i1 < bins( ); ++i1, domain *= factor ) {
+            if( m_mode == DomainHashMode::exponentBits ) {
+                if( i1 > 0 ) {
+                    uint64_t bits = static_cast<uint64_t>( m_bitsOffset + i1 ) << ( 52 - m_mantissaBits );
+                    memcpy( &domain, &bits, sizeof( domain ) );
+                } }
+            else if( m_mode == DomainHashMode::equalPoints ) {
+                domain = m_boundaries[i1];
+            }
             sprintf( Str, " %14.7e", domain );
             std::cout << Str;
             if( ( ( i1 + 1 ) % 10 ) == 0 ) std::cout << std::endl;
@@ -196,6 +370,31 @@ void MultiGroupHash::initialize( GIDI::Protare const &a_protare, GIDI::Styles::T
     m_boundaries = heatedMultiGroupStyle1->groupBoundaries( a_particleID );
 }
 
+/* *********************************************************************************************************//**
+ * Same as **index** but first tries the group stored in slot 0 of *a_energyIndexHint* and its neighbors. The found group is stored
+ * in *a_energyIndexHint*.
+ *
+ * @param a_domain              [in]    The domain value that the group index is to be returned for.
+ * @param a_energyIndexHint     [in]    The particle's last group index for *this*. Updated on return.
+ *
+ * @return                              The group index.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int MultiGroupHash::index( double a_domain, EnergyIndexHint &a_energyIndexHint ) const {
+
+    if( a_domain < m_boundaries[0] ) return( 0 );
+    if( a_domain >= m_boundaries.back( ) ) return( m_boundaries.size( ) - 2 );
+
+    int group = a_energyIndexHint.find( m_boundaries, a_domain, 0 );
+
+    if( group < 0 ) {
+        group = index( a_domain );
+        a_energyIndexHint.set( 0, group );
+    }
+
+    return( group );
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
@@ -0,0 +1,75 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include "MCGIDI.hpp"
+
+#ifndef MCGIDI_EnergyIndexHintWalk
+    #define MCGIDI_EnergyIndexHintWalk 4
+#endif
+
+namespace MCGIDI {
+
+/*! \class EnergyIndexHint
+ * This class stores the last lower energy index found for a particle so that the next lookup can start from it. A neutron slowing
+ * down loses energy collision by collision, so its next energy is often in the same interval or a few points below the last one.
+ * Two slots are stored, one for each of the two temperatures that may be interpolated in a continuous energy lookup. An instance
+ * is only valid for one grid (i.e., one ProtareSingle or one MultiGroupHash), so a caller needs one instance per particle and grid.
+ * The stored index is always verified against the grid, so a stale hint only costs a fall back to the hash.
+ */
+
+/* *********************************************************************************************************//**
+ * Returns the lower index of the interval of *a_grid* containing *a_value* if it can be found from the index stored in slot *a_slot*
+ * by walking at most **MCGIDI_EnergyIndexHintWalk** points. Otherwise -1 is returned and the caller must find the index (e.g., via
+ * a hash) and store it with **set**. *a_value* must be inside the domain of *a_grid*.
+ *
+ * @param a_grid                [in]    The grid to search.
+ * @param a_value               [in]    The value to find.
+ * @param a_slot                [in]    The slot of the stored index to start from.
+ *
+ * @return                              The lower index of the interval containing *a_value* or -1.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int EnergyIndexHint::find( Vector<double> const &a_grid, double a_value, int a_slot ) {
+
+    int index = m_indices[a_slot], last_index = static_cast<int>( a_grid.size( ) ) - 2;
+
+    ++m_lookups;
+    if( ( index < 0 ) || ( index > last_index ) ) return( -1 );
+
+    if( a_value < a_grid[index] ) {
+        for( int i1 = 0; i1 < MCGIDI_EnergyIndexHintWalk; ++i1 ) {
+            if( index == 0 ) return( -1 );
+            --index;
+            if( a_value >= a_grid[index] ) {
+                ++m_walks;
+                m_indices[a_slot] = index;
+                return( index );
+            }
+        }
+        return( -1 );
+    }
+
+    if( a_value >= a_grid[index+1] ) {
+        for( int i1 = 0; i1 < MCGIDI_EnergyIndexHintWalk; ++i1 ) {
+            if( index == last_index ) return( -1 );
+            ++index;
+            if( a_value < a_grid[index+1] ) {
+                ++m_walks;
+                m_indices[a_slot] = index;
+                return( index );
+            }
+        }
+        return( -1 );
+    }
+
+    ++m_hits;
+    return( index );
+}
+
+}
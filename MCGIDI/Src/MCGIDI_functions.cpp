@@ -152,7 +152,7 @@ HOST_DEVICE Function1d::~Function1d( ) {
 */
 HOST_DEVICE int Function1d::sampleBoundingInteger( double a_x1, double (*rng)( void * ), void *rngState ) const {
 
-    double d_value = evaluate( a_x1 );
+    double d_value = evaluateFunction1d( this, a_x1 );
     int iValue = (int) d_value;
     if( iValue == d_value ) return( iValue );
     if( d_value - iValue > rng( rngState ) ) ++iValue;
@@ -1097,7 +1097,10 @@ HOST_DEVICE void ProbabilityBase1d::serialize( DataBuffer &a_buffer, DataBuffer:
 */
 HOST_DEVICE Xs_pdf_cdf1d::Xs_pdf_cdf1d( ) :
         m_pdf( ),
-        m_cdf( ) {
+        m_cdf( ),
+        m_aliasProbabilities( ),
+        m_aliasIndices( ),
+        m_guideIndices( ) {
 
     m_type = ProbabilityBase1dType::xs_pdf_cdf;
 }
@@ -1106,8 +1109,11 @@ HOST_DEVICE Xs_pdf_cdf1d::Xs_pdf_cdf1d( ) :
 */
 HOST Xs_pdf_cdf1d::Xs_pdf_cdf1d( GIDI::Functions::Xs_pdf_cdf1d const &a_xs_pdf_cdf1d ) :
         ProbabilityBase1d( a_xs_pdf_cdf1d, a_xs_pdf_cdf1d.Xs( ) ),
-        m_pdf( a_xs_pdf_cdf1d.pdf( ) ),
-        m_cdf( a_xs_pdf_cdf1d.cdf( ) ) {
+        m_pdf( vectorDoublesToStorageVector( a_xs_pdf_cdf1d.pdf( ) ) ),
+        m_cdf( a_xs_pdf_cdf1d.cdf( ) ),
+        m_aliasProbabilities( ),
+        m_aliasIndices( ),
+        m_guideIndices( ) {
 
     m_type = ProbabilityBase1dType::xs_pdf_cdf;
 }
@@ -1118,6 +1124,89 @@ HOST Xs_pdf_cdf1d::Xs_pdf_cdf1d( GIDI::Functions::Xs_pdf_cdf1d const &a_xs_pdf_c
 HOST_DEVICE Xs_pdf_cdf1d::~Xs_pdf_cdf1d( ) {
 
 }
+
+/* *********************************************************************************************************//**
+ * Builds the Walker alias table (Vose's method) for the bins of *m_cdf* so that **sample** selects a bin in constant time instead of
+ * doing a binary search over *m_cdf*. The bin is then inverted as without an alias table. As the mapping from the random number to the
+ * sampled value is then not monotone, an alias table must only be built if *this* is not sampled in correlation with another
+ * probability (e.g., by XYs2d when interpolating between the values sampled at two incident energies).
+ ***********************************************************************************************************/
+
+HOST void Xs_pdf_cdf1d::buildAliasTable( ) {
+
+    if( m_cdf.size( ) < 2 ) return;
+
+    int numberOfBins = static_cast<int>( m_cdf.size( ) ) - 1;
+    double total = m_cdf.back( ) - m_cdf[0];
+    if( total <= 0.0 ) return;
+
+    std::vector<double> scaled( numberOfBins );
+    std::vector<int> smalls, larges;
+
+    for( int bin = 0; bin < numberOfBins; ++bin ) {
+        scaled[bin] = numberOfBins * ( m_cdf[bin+1] - m_cdf[bin] ) / total;
+        if( scaled[bin] < 1.0 ) {
+            smalls.push_back( bin ); }
+        else {
+            larges.push_back( bin );
+        }
+    }
+
+    m_aliasProbabilities.resize( numberOfBins );
+    m_aliasIndices.resize( numberOfBins );
+    while( ( smalls.size( ) > 0 ) && ( larges.size( ) > 0 ) ) {
+        int small = smalls.back( );
+        int large = larges.back( );
+
+        smalls.pop_back( );
+        m_aliasProbabilities[small] = scaled[small];
+        m_aliasIndices[small] = large;
+        scaled[large] -= 1.0 - scaled[small];
+        if( scaled[large] < 1.0 ) {
+            larges.pop_back( );
+            smalls.push_back( large );
+        }
+    }
+    for( auto iter = larges.begin( ); iter != larges.end( ); ++iter ) {         // Remaining bins, and those left by round off, are always kept.
+        m_aliasProbabilities[*iter] = 1.0;
+        m_aliasIndices[*iter] = *iter;
+    }
+    for( auto iter = smalls.begin( ); iter != smalls.end( ); ++iter ) {
+        m_aliasProbabilities[*iter] = 1.0;
+        m_aliasIndices[*iter] = *iter;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds the guide table for *m_cdf*. The cdf range is divided into *a_guideTableFactor* times the number of cdf bins equal
+ * intervals and, for the start of each interval (and the end of the last), the cdf bin containing it is stored. The binary search
+ * over *m_cdf* in **sample** is then bounded to the bins of one interval. Unlike an alias table, the mapping from the random number
+ * to the sampled value is unchanged so a guide table can be used with correlated sampling. No guide table is built if *this*
+ * has an alias table as it would not be used.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void Xs_pdf_cdf1d::buildGuideTable( double a_guideTableFactor ) {
+
+    if( ( a_guideTableFactor <= 0.0 ) || hasAliasTable( ) || ( m_cdf.size( ) < 2 ) ) return;
+
+    int numberOfBins = static_cast<int>( m_cdf.size( ) ) - 1;
+    double total = m_cdf.back( ) - m_cdf[0];
+    if( total <= 0.0 ) return;
+
+    int numberOfGuides = static_cast<int>( ceil( a_guideTableFactor * numberOfBins ) );
+    if( numberOfGuides < 1 ) numberOfGuides = 1;
+
+    m_guideIndices.resize( numberOfGuides + 1 );
+    int bin = 0;
+    for( int guide = 0; guide <= numberOfGuides; ++guide ) {
+        double cdfValue = m_cdf[0] + total * guide / numberOfGuides;
+
+        while( ( bin < numberOfBins - 1 ) && ( m_cdf[bin+1] <= cdfValue ) ) ++bin;
+        m_guideIndices[guide] = bin;
+    }
+}
 /*
 ============================================================
 */
@@ -1138,9 +1227,39 @@ HOST_DEVICE double Xs_pdf_cdf1d::evaluate( double a_x1 ) const {
 */
 HOST_DEVICE double Xs_pdf_cdf1d::sample( double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const {
 
-    MCGIDI_VectorSizeType lower = binarySearchVector( a_rngValue, m_cdf );
+    MCGIDI_VectorSizeType lower;
     double domainValue = 0;
 
+    if( hasAliasTable( ) ) {                            // Select the bin with the alias table and map the rest of a_rngValue into the bin.
+        MCGIDI_VectorSizeType numberOfBins = m_aliasIndices.size( );
+        double binValue = a_rngValue * numberOfBins;
+
+        lower = static_cast<MCGIDI_VectorSizeType>( binValue );
+        if( lower >= numberOfBins ) lower = numberOfBins - 1;
+        double fraction = binValue - lower;
+        double aliasProbability = m_aliasProbabilities[lower];
+
+        if( fraction < aliasProbability ) {
+            fraction /= aliasProbability; }
+        else {
+            fraction = ( fraction - aliasProbability ) / ( 1.0 - aliasProbability );
+            lower = m_aliasIndices[lower];
+        }
+        a_rngValue = m_cdf[lower] + fraction * ( m_cdf[lower+1] - m_cdf[lower] ); }
+    else if( hasGuideTable( ) ) {                       // Search only the cdf bins of the guide interval containing a_rngValue.
+        MCGIDI_VectorSizeType numberOfGuides = m_guideIndices.size( ) - 1;
+        MCGIDI_VectorSizeType guide = static_cast<MCGIDI_VectorSizeType>( numberOfGuides * ( a_rngValue - m_cdf[0] ) / ( m_cdf.back( ) - m_cdf[0] ) );
+
+        if( guide < 0 ) guide = 0;
+        if( guide >= numberOfGuides ) guide = numberOfGuides - 1;
+        MCGIDI_VectorSizeType upper = m_guideIndices[guide+1] + 1;
+        if( upper >= m_cdf.size( ) ) upper = m_cdf.size( ) - 1;
+        lower = binarySearchVectorBounded( a_rngValue, m_cdf, m_guideIndices[guide], upper, false );
+                                                        // Round off can put a_rngValue just outside the guide interval.
+        if( lower < 0 ) lower = binarySearchVector( a_rngValue, m_cdf ); }
+    else {
+        lower = binarySearchVector( a_rngValue, m_cdf );
+    }
 
     if( lower < 0 ) {                                   // This should never happen.
         THROW( "Xs_pdf_cdf1d::sample: lower < 0." );
@@ -1150,10 +1269,11 @@ HOST_DEVICE double Xs_pdf_cdf1d::sample( double a_rngValue, double (*a_userrng)(
         double fraction = ( m_cdf[lower+1] - a_rngValue ) / ( m_cdf[lower+1] - m_cdf[lower] );
         domainValue = fraction * m_Xs[lower] + ( 1 - fraction ) * m_Xs[lower+1]; }
     else {                                              // Assumes lin-lin interpolation.
-        double slope = m_pdf[lower+1] - m_pdf[lower];
+        double pdf1 = m_pdf[lower], pdf2 = m_pdf[lower+1];
+        double slope = pdf2 - pdf1;
 
         if( slope == 0.0 ) {
-            if( m_pdf[lower] == 0.0 ) {
+            if( pdf1 == 0.0 ) {
                 domainValue = m_Xs[lower];
                 if( lower == 0 ) domainValue = m_Xs[1]; }
             else {
@@ -1167,9 +1287,9 @@ HOST_DEVICE double Xs_pdf_cdf1d::sample( double a_rngValue, double (*a_userrng)(
             d1 = a_rngValue - m_cdf[lower];
             d2 = m_cdf[lower+1] - a_rngValue;
             if( d2 > d1 ) {                         // Closer to lower.
-                domainValue = m_Xs[lower] + ( sqrt( m_pdf[lower] * m_pdf[lower] + 2. * slope * d1 ) - m_pdf[lower] ) / slope; }
+                domainValue = m_Xs[lower] + ( sqrt( pdf1 * pdf1 + 2. * slope * d1 ) - pdf1 ) / slope; }
             else {                                  // Closer to lower + 1.
-                domainValue = m_Xs[lower+1] - ( m_pdf[lower+1] - sqrt( m_pdf[lower+1] * m_pdf[lower+1] - 2. * slope * d2 ) ) / slope;
+                domainValue = m_Xs[lower+1] - ( pdf2 - sqrt( pdf2 * pdf2 - 2. * slope * d2 ) ) / slope;
             }
         }
     }
@@ -1189,6 +1309,9 @@ HOST_DEVICE void Xs_pdf_cdf1d::serialize( DataBuffer &a_buffer, DataBuffer::Mode
     ProbabilityBase1d::serialize( a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_pdf, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_cdf, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_aliasProbabilities, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_aliasIndices, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_guideIndices, a_buffer, a_mode );
 }
 
 /*
@@ -1235,7 +1358,8 @@ HOST_DEVICE ProbabilityBase2d::~ProbabilityBase2d( ) {
  * @param a_x1_2                [in]        The upper value of the x1 value.
  ***********************************************************************************************************/
 
-HOST_DEVICE double ProbabilityBase2d::sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2 ) const {
+HOST_DEVICE double ProbabilityBase2d::sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2,
+                double *a_bracketRngValue ) const {
 
     THROW( "ProbabilityBase2d::sample2dOf3d: not implemented." );
 
@@ -1255,13 +1379,36 @@ HOST_DEVICE void ProbabilityBase2d::serialize( DataBuffer &a_buffer, DataBuffer:
     ProbabilityBase::serialize( a_buffer, a_mode );
 }
 
+/* *********************************************************************************************************//**
+ * Returns the weight of the lower of two bracketing points when interpolating to *a_x*. Used for stochastic interpolation
+ * where the lower point is chosen with this probability and the upper point otherwise.
+ *
+ * @param a_interpolation       [in]    The interpolation between the bracketing points.
+ * @param a_x                   [in]    The value to interpolate to.
+ * @param a_xLower              [in]    The value of the lower bracketing point.
+ * @param a_xUpper              [in]    The value of the upper bracketing point.
+ ***********************************************************************************************************/
+
+HOST_DEVICE static double stochasticInterpolationLowerWeight( Interpolation a_interpolation, double a_x, double a_xLower, double a_xUpper ) {
+
+    if( ( a_interpolation == Interpolation::LINLIN ) || ( a_interpolation == Interpolation::LOGLIN ) ) {
+        return( ( a_xUpper - a_x ) / ( a_xUpper - a_xLower ) ); }
+    else if( ( a_interpolation == Interpolation::LINLOG ) || ( a_interpolation == Interpolation::LOGLOG ) ) {
+        return( log( a_xUpper / a_x ) / log( a_xUpper / a_xLower ) );
+    }
+
+    THROW( "stochasticInterpolationLowerWeight: unsupported interpolation." );
+    return( 1.0 );
+}
+
 /*
 ============================================================
 ========================== XYs2d ===========================
 ============================================================
 */
 HOST_DEVICE XYs2d::XYs2d( ) :
-        m_probabilities( ) {
+        m_probabilities( ),
+        m_stochasticInterpolation( false ) {
 
     m_type = ProbabilityBase2dType::XYs;
 }
@@ -1269,7 +1416,8 @@ HOST_DEVICE XYs2d::XYs2d( ) :
 ============================================================
 */
 HOST XYs2d::XYs2d( GIDI::Functions::XYs2d const &a_XYs2d ) :
-        ProbabilityBase2d( a_XYs2d, a_XYs2d.Xs( ) ) {
+        ProbabilityBase2d( a_XYs2d, a_XYs2d.Xs( ) ),
+        m_stochasticInterpolation( false ) {
 
     m_type = ProbabilityBase2dType::XYs;
 
@@ -1308,22 +1456,25 @@ HOST_DEVICE double XYs2d::sample( double a_x2, double a_rngValue, double (*a_use
 /*
 C    Samples from a pdf(x1|x2). First determine which pdf(s) to sample from given x2.
 C    Then use rngValue to sample from pdf1(x1) and maybe pdf2(x1) and interpolate to
-C    determine x1.
+C    determine x1. For stochastic interpolation, only one of pdf1(x1) and pdf2(x1) is sampled.
 */
     double sampledValue;
     MCGIDI_VectorSizeType lower = binarySearchVector( a_x2, m_Xs );
 
     if( lower == -2 ) {
-        sampledValue = m_probabilities[0]->sample( a_rngValue, a_userrng, a_rngState ); }
+        sampledValue = sampleProbability1d( m_probabilities[0], a_rngValue, a_userrng, a_rngState ); }
     else if( lower == -1 ) {
-        sampledValue = m_probabilities.back( )->sample( a_rngValue, a_userrng, a_rngState ); }
+        sampledValue = sampleProbability1d( m_probabilities.back( ), a_rngValue, a_userrng, a_rngState ); }
+    else if( m_stochasticInterpolation && ( interpolation( ) != Interpolation::FLAT ) ) {
+        if( a_userrng( a_rngState ) >= stochasticInterpolationLowerWeight( interpolation( ), a_x2, m_Xs[lower], m_Xs[lower+1] ) ) ++lower;
+        sampledValue = sampleProbability1d( m_probabilities[lower], a_rngValue, a_userrng, a_rngState ); }
     else {
-        double sampled1 = m_probabilities[lower]->sample( a_rngValue, a_userrng, a_rngState );
+        double sampled1 = sampleProbability1d( m_probabilities[lower], a_rngValue, a_userrng, a_rngState );
 
         if( interpolation( ) == Interpolation::FLAT ) {
             sampledValue = sampled1; }
         else {
-            double sampled2 = m_probabilities[lower+1]->sample( a_rngValue, a_userrng, a_rngState );
+            double sampled2 = sampleProbability1d( m_probabilities[lower+1], a_rngValue, a_userrng, a_rngState );
 
             if( interpolation( ) == Interpolation::LINLIN ) {
                 double fraction = ( m_Xs[lower+1] - a_x2 ) / ( m_Xs[lower+1] - m_Xs[lower] );
@@ -1354,29 +1505,39 @@ C    determine x1.
  * @param a_rngState            [in/out]    The random number generator state.
  * @param a_x1_1                [in]        The lower value of the x1 value.
  * @param a_x1_2                [in]        The upper value of the x1 value.
+ * @param a_bracketRngValue     [out]       The random number used to choose the bracketing probability for stochastic interpolation,
+ *                                          or -1 if none was used. Must be passed to **XYs3d::sample** so that it chooses the same bracket.
  ***********************************************************************************************************/
 
-HOST_DEVICE double XYs2d::sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2 ) const {
+HOST_DEVICE double XYs2d::sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2,
+                double *a_bracketRngValue ) const {
 /*
 C   Samples from a pdf(x1|x2). First determine which pdf(s) to sample from given x2. Then use rngValue to sample from pdf1(x1) 
-C   and maybe pdf2(x1) and interpolate to determine x1.
+C   and maybe pdf2(x1) and interpolate to determine x1. For stochastic interpolation, only one of pdf1(x1) and pdf2(x1) is 
+C   sampled, both returned x1 values are the sampled value and the random number that chose it is returned in *a_bracketRngValue*.
 */
     double sampledValue;
     MCGIDI_VectorSizeType lower = binarySearchVector( a_x2, m_Xs );
 
+    *a_bracketRngValue = -1.0;
     if( lower == -2 ) {
-        sampledValue = m_probabilities[0]->sample( a_rngValue, a_userrng, a_rngState );
+        sampledValue = sampleProbability1d( m_probabilities[0], a_rngValue, a_userrng, a_rngState );
         *a_x1_2 = *a_x1_1 = sampledValue; }
     else if( lower == -1 ) {
-        sampledValue = m_probabilities.back( )->sample( a_rngValue, a_userrng, a_rngState );
+        sampledValue = sampleProbability1d( m_probabilities.back( ), a_rngValue, a_userrng, a_rngState );
+        *a_x1_2 = *a_x1_1 = sampledValue; }
+    else if( m_stochasticInterpolation && ( interpolation( ) != Interpolation::FLAT ) ) {
+        *a_bracketRngValue = a_userrng( a_rngState );
+        if( *a_bracketRngValue >= stochasticInterpolationLowerWeight( interpolation( ), a_x2, m_Xs[lower], m_Xs[lower+1] ) ) ++lower;
+        sampledValue = sampleProbability1d( m_probabilities[lower], a_rngValue, a_userrng, a_rngState );
         *a_x1_2 = *a_x1_1 = sampledValue; }
     else {
-        *a_x1_1 = m_probabilities[lower]->sample( a_rngValue, a_userrng, a_rngState );
+        *a_x1_1 = sampleProbability1d( m_probabilities[lower], a_rngValue, a_userrng, a_rngState );
 
         if( interpolation( ) == Interpolation::FLAT ) {
             sampledValue = *a_x1_2 = *a_x1_1; }
         else {
-            *a_x1_2 = m_probabilities[lower+1]->sample( a_rngValue, a_userrng, a_rngState );
+            *a_x1_2 = sampleProbability1d( m_probabilities[lower+1], a_rngValue, a_userrng, a_rngState );
 
             if( interpolation( ) == Interpolation::LINLIN ) {
                 double fraction = ( m_Xs[lower+1] - a_x2 ) / ( m_Xs[lower+1] - m_Xs[lower] );
@@ -1398,6 +1559,33 @@ C   and maybe pdf2(x1) and interpolate to determine x1.
     return( sampledValue );
 }
 
+/* *********************************************************************************************************//**
+ * Builds alias tables for the probabilities of *this* if each sample uses only one of them (i.e., for stochastic or flat
+ * interpolation). Otherwise, the two probabilities bracketing x2 are sampled with the same random number and their sampled values 
+ * interpolated which requires the monotone mapping of a cdf search, so no alias tables are built.
+ ***********************************************************************************************************/
+
+HOST void XYs2d::buildAliasTables( ) {
+
+    if( !m_stochasticInterpolation && ( interpolation( ) != Interpolation::FLAT ) ) return;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) {
+        if( ProbabilityBase1dClass( m_probabilities[i1] ) == ProbabilityBase1dType::xs_pdf_cdf )
+            static_cast<Xs_pdf_cdf1d *>( m_probabilities[i1] )->buildAliasTable( );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for the probabilities of *this*.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void XYs2d::buildGuideTables( double a_guideTableFactor ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) buildGuideTables1d( m_probabilities[i1], a_guideTableFactor );
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
@@ -1409,6 +1597,7 @@ C   and maybe pdf2(x1) and interpolate to determine x1.
 HOST_DEVICE void XYs2d::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
 
     ProbabilityBase2d::serialize( a_buffer, a_mode );
+    DATA_MEMBER_CAST( m_stochasticInterpolation, a_buffer, a_mode, bool );
 
     MCGIDI_VectorSizeType vectorSize = m_probabilities.size( );
     int vectorSizeInt = (int) vectorSize;
@@ -1495,6 +1684,48 @@ HOST_DEVICE Regions2d::~Regions2d( ) {
 
     for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) delete m_probabilities[i1];
 }
+
+/* *********************************************************************************************************//**
+ * Sets the stochastic interpolation flag of each region of *this*.
+ *
+ * @param a_stochasticInterpolation     [in]    If true, tabulated regions are sampled with stochastic interpolation.
+ ***********************************************************************************************************/
+
+HOST void Regions2d::setStochasticInterpolation( bool a_stochasticInterpolation ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) setStochasticInterpolation2d( m_probabilities[i1], a_stochasticInterpolation );
+}
+
+/* *********************************************************************************************************//**
+ * Builds alias tables for each region of *this*. As only one region is sampled per call, each region decides for itself.
+ ***********************************************************************************************************/
+
+HOST void Regions2d::buildAliasTables( ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) buildAliasTables2d( m_probabilities[i1] );
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for the probabilities of *this*.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void Regions2d::buildGuideTables( double a_guideTableFactor ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) buildGuideTables2d( m_probabilities[i1], a_guideTableFactor );
+}
+
+/* *********************************************************************************************************//**
+ * Builds inverse cdf tables for the analytic spectra of *this*.
+ *
+ * @param a_tolerance           [in]    The tolerance of the tables relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST void Regions2d::buildInverseCdfTables( double a_tolerance ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) buildInverseCdfTables2d( m_probabilities[i1], a_tolerance );
+}
 /*
 ============================================================
 */
@@ -1520,12 +1751,12 @@ HOST_DEVICE double Regions2d::sample( double a_x2, double a_rngValue, double (*a
 
     if( lower < 0 ) {
         if( lower == -1 ) {                         // a_x2 > last value of m_Xs.
-            return( m_probabilities.back( )->sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+            return( sampleProbability2d( m_probabilities.back( ), a_x2, a_rngValue, a_userrng, a_rngState ) );
         }
         lower = 0;                                  // a_x2 < first value of m_Xs.
     }
 
-    return( m_probabilities[lower]->sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+    return( sampleProbability2d( m_probabilities[lower], a_x2, a_rngValue, a_userrng, a_rngState ) );
 }
 
 /* *********************************************************************************************************//**
@@ -1808,7 +2039,18 @@ HOST_DEVICE double NBodyPhaseSpace2d::evaluate( double a_x2, double a_x1 ) const
 */
 HOST_DEVICE double NBodyPhaseSpace2d::sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const {
 
-    return( ( m_energy_in_COMFactor * a_x2 + m_Q ) * m_massFactor * m_dist->sample( a_rngValue, a_userrng, a_rngState ) );
+    return( ( m_energy_in_COMFactor * a_x2 + m_Q ) * m_massFactor * sampleProbability1d( m_dist, a_rngValue, a_userrng, a_rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Builds the guide table for the probability of *this*.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void NBodyPhaseSpace2d::buildGuideTables( double a_guideTableFactor ) {
+
+    buildGuideTables1d( m_dist, a_guideTableFactor );
 }
 
 /* *********************************************************************************************************//**
@@ -1831,6 +2073,260 @@ HOST_DEVICE void NBodyPhaseSpace2d::serialize( DataBuffer &a_buffer, DataBuffer:
     m_dist = serializeProbability1d( a_buffer, a_mode, m_dist );
 }
 
+/*
+============================================================
+==================== InverseCdfTable2d =====================
+============================================================
+*/
+
+/*! \class InverseCdfTable2d
+ * This class stores the inverse cdf of an outgoing energy spectrum at a list of projectile energies. At each projectile energy, the
+ * outgoing energies are stored at equally spaced cdf values. A sample is a lookup with linear interpolation in the cdf and in the
+ * projectile energy (i.e., equiprobable interpolation). It is used to sample analytic spectra (e.g., Watt) without their per sample
+ * rejection loops or root finding.
+ */
+
+/* *********************************************************************************************************//**
+ ***********************************************************************************************************/
+
+HOST_DEVICE InverseCdfTable2d::InverseCdfTable2d( ) :
+        m_numberOfCdfIntervals( 0 ),
+        m_energies( ),
+        m_outgoingEnergies( ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * Sets the tables of *this*.
+ *
+ * @param a_energies                [in]    The projectile energies of the tables in ascending order.
+ * @param a_numberOfCdfIntervals    [in]    The number of equal cdf intervals of each table.
+ * @param a_outgoingEnergies        [in]    For each projectile energy, the *a_numberOfCdfIntervals* + 1 outgoing energies of its table.
+ ***********************************************************************************************************/
+
+HOST void InverseCdfTable2d::setup( std::vector<double> const &a_energies, int a_numberOfCdfIntervals, std::vector<double> const &a_outgoingEnergies ) {
+
+    if( a_numberOfCdfIntervals < 1 ) THROW( "InverseCdfTable2d::setup: number of cdf intervals must be positive." );
+    if( a_outgoingEnergies.size( ) != a_energies.size( ) * ( a_numberOfCdfIntervals + 1 ) )
+        THROW( "InverseCdfTable2d::setup: number of outgoing energies does not match number of energies." );
+
+    m_numberOfCdfIntervals = a_numberOfCdfIntervals;
+    m_energies.resize( a_energies.size( ) );
+    for( std::size_t i1 = 0; i1 < a_energies.size( ); ++i1 ) m_energies[i1] = a_energies[i1];
+    m_outgoingEnergies.resize( a_outgoingEnergies.size( ) );
+    for( std::size_t i1 = 0; i1 < a_outgoingEnergies.size( ); ++i1 ) m_outgoingEnergies[i1] = a_outgoingEnergies[i1];
+}
+
+/* *********************************************************************************************************//**
+ * Returns an outgoing energy sampled from the tables of *this*. Projectile energies outside the energies of *this* use the first
+ * or last table.
+ *
+ * @param a_energy                  [in]    The energy of the projectile.
+ * @param a_rngValue                [in]    The random number used to sample.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double InverseCdfTable2d::sample( double a_energy, double a_rngValue ) const {
+
+    double cdfIndex = a_rngValue * m_numberOfCdfIntervals;
+    int index = static_cast<int>( cdfIndex );
+    if( index >= m_numberOfCdfIntervals ) index = m_numberOfCdfIntervals - 1;
+    double cdfFraction = cdfIndex - index;
+
+    MCGIDI_VectorSizeType lower = binarySearchVector( a_energy, m_energies, true );
+    if( lower == static_cast<MCGIDI_VectorSizeType>( m_energies.size( ) ) - 1 ) {
+        if( lower > 0 ) --lower;
+    }
+
+    MCGIDI_VectorSizeType offset = lower * ( m_numberOfCdfIntervals + 1 ) + index;
+    double energyOut1 = m_outgoingEnergies[offset] + cdfFraction * ( m_outgoingEnergies[offset+1] - m_outgoingEnergies[offset] );
+    if( m_energies.size( ) == 1 ) return( energyOut1 );
+
+    double energyFraction = ( a_energy - m_energies[lower] ) / ( m_energies[lower+1] - m_energies[lower] );
+    if( energyFraction < 0.0 ) energyFraction = 0.0;
+    if( energyFraction > 1.0 ) energyFraction = 1.0;
+
+    offset += m_numberOfCdfIntervals + 1;
+    double energyOut2 = m_outgoingEnergies[offset] + cdfFraction * ( m_outgoingEnergies[offset+1] - m_outgoingEnergies[offset] );
+
+    return( energyOut1 + energyFraction * ( energyOut2 - energyOut1 ) );
+}
+
+/* *********************************************************************************************************//**
+ * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
+ * bytes, pack *this* or unpack *this* depending on *a_mode*.
+ *
+ * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
+ * @param a_mode                [in]    Specifies the action of this method.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void InverseCdfTable2d::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+
+    DATA_MEMBER_INT( m_numberOfCdfIntervals, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_energies, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_outgoingEnergies, a_buffer, a_mode );
+}
+
+/* *********************************************************************************************************//**
+ * Sets *a_row* to the outgoing energies of *a_spectrum* at projectile energy *a_energy* for *a_numberOfCdfIntervals* + 1 equally
+ * spaced cdf values. The cdf is inverted by bisection. *a_spectrum* must have the methods **energyOutMax** and **cdf** (not normalized).
+ *
+ * @param a_spectrum                [in]    The spectrum to tabulate.
+ * @param a_energy                  [in]    The energy of the projectile.
+ * @param a_numberOfCdfIntervals    [in]    The number of equal cdf intervals.
+ * @param a_row                     [out]   The outgoing energies.
+ ***********************************************************************************************************/
+
+template <typename Spectrum> HOST static void inverseCdfTableRow( Spectrum const &a_spectrum, double a_energy, int a_numberOfCdfIntervals, 
+                std::vector<double> &a_row ) {
+
+    double energyOutMax = a_spectrum.energyOutMax( a_energy );
+
+    a_row.assign( a_numberOfCdfIntervals + 1, 0.0 );
+    if( energyOutMax <= 0.0 ) return;
+
+    double norm = a_spectrum.cdf( a_energy, energyOutMax );
+    double energyOutMin = 0.0;
+
+    a_row[a_numberOfCdfIntervals] = energyOutMax;
+    for( int index = 1; index < a_numberOfCdfIntervals; ++index ) {
+        double cdf = norm * index / a_numberOfCdfIntervals, lower = energyOutMin, upper = energyOutMax;
+
+        for( int iteration = 0; iteration < 52; ++iteration ) {
+            double middle = 0.5 * ( lower + upper );
+
+            if( a_spectrum.cdf( a_energy, middle ) < cdf ) {
+                lower = middle; }
+            else {
+                upper = middle;
+            }
+        }
+        a_row[index] = 0.5 * ( lower + upper );
+        energyOutMin = a_row[index];
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Returns the mean absolute difference between the outgoing energies of *a_row* and the average of the outgoing energies of *a_row1*
+ * and *a_row2*, relative to the mean of the outgoing energies of *a_row*. If *a_row1* and *a_row2* are the same, the odd entries
+ * of *a_row* are compared to the average of their neighbors. As the entries are equiprobable, this is the mean shift of a sampled
+ * outgoing energy. A maximum difference is not used as the inverse cdf is singular at one or both of its ends for these spectra.
+ *
+ * @param a_row                     [in]    The outgoing energies to compare to.
+ * @param a_row1                    [in]    The first outgoing energies to average.
+ * @param a_row2                    [in]    The second outgoing energies to average.
+ ***********************************************************************************************************/
+
+HOST static double inverseCdfTableError( std::vector<double> const &a_row, std::vector<double> const &a_row1, std::vector<double> const &a_row2 ) {
+
+    double mean = 0.0, sumOfDifferences = 0.0;
+    std::size_t numberOfDifferences = 0;
+
+    for( std::size_t index = 0; index < a_row.size( ); ++index ) mean += a_row[index];
+    mean /= a_row.size( );
+    if( mean <= 0.0 ) return( 0.0 );
+
+    if( &a_row1 == &a_row2 ) {
+        for( std::size_t index = 1; index < a_row.size( ); index += 2, ++numberOfDifferences ) {
+            sumOfDifferences += fabs( a_row[index] - 0.5 * ( a_row[index-1] + a_row[index+1] ) );
+        } }
+    else {
+        for( std::size_t index = 0; index < a_row.size( ); ++index, ++numberOfDifferences ) {
+            sumOfDifferences += fabs( a_row[index] - 0.5 * ( a_row1[index] + a_row2[index] ) );
+        }
+    }
+
+    return( sumOfDifferences / ( numberOfDifferences * mean ) );
+}
+
+/* *********************************************************************************************************//**
+ * Adds the tables of *a_spectrum* between projectile energies *a_energy1* and *a_energy2* (both exclusive) to *a_energies* and
+ * *a_outgoingEnergies*. The interval is bisected until linear interpolation between the tables at its ends meets *a_tolerance*.
+ *
+ * @param a_spectrum                [in]    The spectrum to tabulate.
+ * @param a_energy1                 [in]    The lower projectile energy of the interval.
+ * @param a_row1                    [in]    The table at *a_energy1*.
+ * @param a_energy2                 [in]    The upper projectile energy of the interval.
+ * @param a_row2                    [in]    The table at *a_energy2*.
+ * @param a_numberOfCdfIntervals    [in]    The number of equal cdf intervals.
+ * @param a_tolerance               [in]    The tolerance.
+ * @param a_depth                   [in]    The number of bisections so far.
+ * @param a_energies                [out]   The list of projectile energies to add to.
+ * @param a_outgoingEnergies        [out]   The list of tables to add to.
+ ***********************************************************************************************************/
+
+template <typename Spectrum> HOST static void inverseCdfTableRefine( Spectrum const &a_spectrum, double a_energy1, std::vector<double> const &a_row1,
+                double a_energy2, std::vector<double> const &a_row2, int a_numberOfCdfIntervals, double a_tolerance, int a_depth, 
+                std::vector<double> &a_energies, std::vector<double> &a_outgoingEnergies ) {
+
+    if( a_depth > 24 ) return;
+
+    double energy = 0.5 * ( a_energy1 + a_energy2 );
+    std::vector<double> row;
+
+    inverseCdfTableRow( a_spectrum, energy, a_numberOfCdfIntervals, row );
+    if( inverseCdfTableError( row, a_row1, a_row2 ) <= a_tolerance ) return;
+
+    inverseCdfTableRefine( a_spectrum, a_energy1, a_row1, energy, row, a_numberOfCdfIntervals, a_tolerance, a_depth + 1, a_energies, a_outgoingEnergies );
+    a_energies.push_back( energy );
+    a_outgoingEnergies.insert( a_outgoingEnergies.end( ), row.begin( ), row.end( ) );
+    inverseCdfTableRefine( a_spectrum, energy, row, a_energy2, a_row2, a_numberOfCdfIntervals, a_tolerance, a_depth + 1, a_energies, a_outgoingEnergies );
+}
+
+/* *********************************************************************************************************//**
+ * Builds the inverse cdf tables of *a_spectrum* for projectile energies from *a_energyMin* to *a_energyMax* into *a_table*.
+ * The number of cdf intervals is doubled (starting at 16 and up to 4096) until linear interpolation in the cdf meets *a_tolerance*
+ * at *a_energyMin*, *a_energyMax* and their geometric mean. Then projectile energies are added where needed for linear interpolation
+ * between tables to meet *a_tolerance*. Errors are mean shifts of a sampled outgoing energy relative to the mean outgoing energy.
+ *
+ * @param a_table                   [out]   The table to build.
+ * @param a_spectrum                [in]    The spectrum to tabulate.
+ * @param a_energyMin               [in]    The lowest projectile energy.
+ * @param a_energyMax               [in]    The highest projectile energy.
+ * @param a_tolerance               [in]    The tolerance.
+ ***********************************************************************************************************/
+
+template <typename Spectrum> HOST static void inverseCdfTableBuild( InverseCdfTable2d &a_table, Spectrum const &a_spectrum, double a_energyMin, 
+                double a_energyMax, double a_tolerance ) {
+
+    std::vector<double> checkEnergies, energies, outgoingEnergies, row;
+    int numberOfCdfIntervals = 16;
+
+    if( a_energyMax <= a_energyMin ) return;
+    checkEnergies.push_back( a_energyMin );
+    if( a_energyMin > 0.0 ) checkEnergies.push_back( sqrt( a_energyMin * a_energyMax ) );
+    checkEnergies.push_back( a_energyMax );
+    for( ; numberOfCdfIntervals < 4096; numberOfCdfIntervals *= 2 ) {
+        bool converged = true;
+
+        for( std::size_t i1 = 0; i1 < checkEnergies.size( ); ++i1 ) {
+            inverseCdfTableRow( a_spectrum, checkEnergies[i1], 2 * numberOfCdfIntervals, row );
+            if( inverseCdfTableError( row, row, row ) > a_tolerance ) converged = false;
+        }
+        if( converged ) break;
+    }
+
+    std::vector<double> row1, row2;
+    double energy1 = a_energyMin;
+
+    inverseCdfTableRow( a_spectrum, energy1, numberOfCdfIntervals, row1 );
+    energies.push_back( energy1 );
+    outgoingEnergies.insert( outgoingEnergies.end( ), row1.begin( ), row1.end( ) );
+    for( int decade = 1; ; ++decade ) {                     // At least one table per decade of projectile energy.
+        double energy2 = a_energyMin * pow( 10.0, decade );
+
+        if( ( a_energyMin <= 0.0 ) || ( energy2 > a_energyMax ) ) energy2 = a_energyMax;
+        inverseCdfTableRow( a_spectrum, energy2, numberOfCdfIntervals, row2 );
+        inverseCdfTableRefine( a_spectrum, energy1, row1, energy2, row2, numberOfCdfIntervals, a_tolerance, 0, energies, outgoingEnergies );
+        energies.push_back( energy2 );
+        outgoingEnergies.insert( outgoingEnergies.end( ), row2.begin( ), row2.end( ) );
+        if( energy2 == a_energyMax ) break;
+        energy1 = energy2;
+        row1.swap( row2 );
+    }
+
+    a_table.setup( energies, numberOfCdfIntervals, outgoingEnergies );
+}
+
 /*
 ============================================================
 ====================== Evaporation2d =======================
@@ -1838,7 +2334,8 @@ HOST_DEVICE void NBodyPhaseSpace2d::serialize( DataBuffer &a_buffer, DataBuffer:
 */
 HOST_DEVICE Evaporation2d::Evaporation2d( ) :
         m_U( 0.0 ),
-        m_theta( nullptr ) {
+        m_theta( nullptr ),
+        m_inverseCdfTable( ) {
 
     m_type = ProbabilityBase2dType::evaporation;
 }
@@ -1848,7 +2345,8 @@ HOST_DEVICE Evaporation2d::Evaporation2d( ) :
 HOST Evaporation2d::Evaporation2d( GIDI::Functions::Evaporation2d const &a_evaporation2d ) :
         ProbabilityBase2d( a_evaporation2d ),
         m_U( a_evaporation2d.U( ) ),
-        m_theta( Functions::parseFunction1d( a_evaporation2d.theta( ) ) ) {
+        m_theta( Functions::parseFunction1d( a_evaporation2d.theta( ) ) ),
+        m_inverseCdfTable( ) {
 
     m_type = ProbabilityBase2dType::evaporation;
 }
@@ -1860,6 +2358,39 @@ HOST_DEVICE Evaporation2d::~Evaporation2d( ) {
 
     delete m_theta;
 }
+
+/* *********************************************************************************************************//**
+ * The evaporation spectrum for **inverseCdfTableBuild**.
+ ***********************************************************************************************************/
+
+class InverseCdfTableEvaporation {
+
+    private:
+        double m_U;
+        Functions::Function1d const *m_theta;
+
+    public:
+        InverseCdfTableEvaporation( double a_U, Functions::Function1d const *a_theta ) : m_U( a_U ), m_theta( a_theta ) { }
+
+        double energyOutMax( double a_energy ) const { return( a_energy - m_U ); }
+        double cdf( double a_energy, double a_energyOut ) const {
+            double x = a_energyOut / m_theta->evaluate( a_energy );
+
+            return( -expm1( -x ) - x * exp( -x ) );
+        }
+};
+
+/* *********************************************************************************************************//**
+ * Builds the inverse cdf table used to sample *this*.
+ *
+ * @param a_tolerance           [in]    The tolerance of the table relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST void Evaporation2d::buildInverseCdfTable( double a_tolerance ) {
+
+    inverseCdfTableBuild( m_inverseCdfTable, InverseCdfTableEvaporation( m_U, m_theta ), std::max( m_theta->domainMin( ), m_U ), 
+            m_theta->domainMax( ), a_tolerance );
+}
 /*
 ============================================================
 */
@@ -1878,6 +2409,8 @@ HOST_DEVICE double Evaporation2d::evaluate( double a_x2, double a_x1 ) const {
 HOST_DEVICE static double MCGIDI_sampleEvaporation( double a_xMax, double a_rngValue );
 HOST_DEVICE double Evaporation2d::sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const {
 
+    if( m_inverseCdfTable.active( ) ) return( m_inverseCdfTable.sample( a_x2, a_rngValue ) );
+
     double theta = m_theta->evaluate( a_x2 );
 
     return( theta * MCGIDI_sampleEvaporation( ( a_x2 - m_U ) / theta, a_rngValue ) );
@@ -1917,6 +2450,7 @@ HOST_DEVICE void Evaporation2d::serialize( DataBuffer &a_buffer, DataBuffer::Mod
     DATA_MEMBER_FLOAT( m_U, a_buffer, a_mode );
 
     m_theta = serializeFunction1d( a_buffer, a_mode, m_theta );
+    m_inverseCdfTable.serialize( a_buffer, a_mode );
 }
 
 /*
@@ -1961,7 +2495,18 @@ HOST_DEVICE double GeneralEvaporation2d::evaluate( double a_x2, double a_x1 ) co
 */
 HOST_DEVICE double GeneralEvaporation2d::sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const {
 
-    return( m_theta->evaluate( a_x2 ) * m_g->sample( a_rngValue, a_userrng, a_rngState ) );
+    return( m_theta->evaluate( a_x2 ) * sampleProbability1d( m_g, a_rngValue, a_userrng, a_rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Builds the guide table for the probability of *this*.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void GeneralEvaporation2d::buildGuideTables( double a_guideTableFactor ) {
+
+    buildGuideTables1d( m_g, a_guideTableFactor );
 }
 
 /* *********************************************************************************************************//**
@@ -1986,7 +2531,8 @@ HOST_DEVICE void GeneralEvaporation2d::serialize( DataBuffer &a_buffer, DataBuff
 */
 HOST_DEVICE SimpleMaxwellianFission2d::SimpleMaxwellianFission2d( ) :
         m_U( 0.0 ),
-        m_theta( nullptr ) {
+        m_theta( nullptr ),
+        m_inverseCdfTable( ) {
 
     m_type = ProbabilityBase2dType::simpleMaxwellianFission;
 }
@@ -1996,7 +2542,8 @@ HOST_DEVICE SimpleMaxwellianFission2d::SimpleMaxwellianFission2d( ) :
 HOST SimpleMaxwellianFission2d::SimpleMaxwellianFission2d( GIDI::Functions::SimpleMaxwellianFission2d const &a_simpleMaxwellianFission2d ) :
         ProbabilityBase2d( a_simpleMaxwellianFission2d ),
         m_U( a_simpleMaxwellianFission2d.U( ) ),
-        m_theta( Functions::parseFunction1d( a_simpleMaxwellianFission2d.theta( ) ) ) {
+        m_theta( Functions::parseFunction1d( a_simpleMaxwellianFission2d.theta( ) ) ),
+        m_inverseCdfTable( ) {
 
     m_type = ProbabilityBase2dType::simpleMaxwellianFission;
 }
@@ -2008,6 +2555,39 @@ HOST_DEVICE SimpleMaxwellianFission2d::~SimpleMaxwellianFission2d( ) {
 
     delete m_theta;
 }
+
+/* *********************************************************************************************************//**
+ * The simple Maxwellian fission spectrum for **inverseCdfTableBuild**.
+ ***********************************************************************************************************/
+
+class InverseCdfTableSimpleMaxwellianFission {
+
+    private:
+        double m_U;
+        Functions::Function1d const *m_theta;
+
+    public:
+        InverseCdfTableSimpleMaxwellianFission( double a_U, Functions::Function1d const *a_theta ) : m_U( a_U ), m_theta( a_theta ) { }
+
+        double energyOutMax( double a_energy ) const { return( a_energy - m_U ); }
+        double cdf( double a_energy, double a_energyOut ) const {
+            double x = a_energyOut / m_theta->evaluate( a_energy ), sqrt_x = sqrt( x );
+
+            return( 0.5 * sqrt( M_PI ) * erf( sqrt_x ) - sqrt_x * exp( -x ) );
+        }
+};
+
+/* *********************************************************************************************************//**
+ * Builds the inverse cdf table used to sample *this*.
+ *
+ * @param a_tolerance           [in]    The tolerance of the table relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST void SimpleMaxwellianFission2d::buildInverseCdfTable( double a_tolerance ) {
+
+    inverseCdfTableBuild( m_inverseCdfTable, InverseCdfTableSimpleMaxwellianFission( m_U, m_theta ), std::max( m_theta->domainMin( ), m_U ), 
+            m_theta->domainMax( ), a_tolerance );
+}
 /*
 ============================================================
 */
@@ -2029,6 +2609,8 @@ HOST_DEVICE double SimpleMaxwellianFission2d::evaluate( double a_x2, double a_x1
 HOST_DEVICE static double MCGIDI_sampleSimpleMaxwellianFission( double a_xMax, double a_rngValue );
 HOST_DEVICE double SimpleMaxwellianFission2d::sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const {
 
+    if( m_inverseCdfTable.active( ) ) return( m_inverseCdfTable.sample( a_x2, a_rngValue ) );
+
     double theta = m_theta->evaluate( a_x2 );
 
     return( theta * MCGIDI_sampleSimpleMaxwellianFission( ( a_x2 - m_U ) / theta, a_rngValue ) );
@@ -2069,6 +2651,7 @@ HOST_DEVICE void SimpleMaxwellianFission2d::serialize( DataBuffer &a_buffer, Dat
     ProbabilityBase2d::serialize( a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_U, a_buffer, a_mode );
     m_theta = serializeFunction1d( a_buffer, a_mode, m_theta );
+    m_inverseCdfTable.serialize( a_buffer, a_mode );
 }
 
 /*
@@ -2078,7 +2661,8 @@ HOST_DEVICE void SimpleMaxwellianFission2d::serialize( DataBuffer &a_buffer, Dat
 */
 HOST_DEVICE Watt2d::Watt2d( ) :
         m_a( nullptr ),
-        m_b( nullptr ) {
+        m_b( nullptr ),
+        m_inverseCdfTable( ) {
 
     m_type = ProbabilityBase2dType::Watt;
 }
@@ -2089,7 +2673,8 @@ HOST Watt2d::Watt2d( GIDI::Functions::Watt2d const &a_Watt2d ) :
         ProbabilityBase2d( a_Watt2d ),
         m_U( a_Watt2d.U( ) ),
         m_a( Functions::parseFunction1d( a_Watt2d.a( ) ) ),
-        m_b( Functions::parseFunction1d( a_Watt2d.b( ) ) ) {
+        m_b( Functions::parseFunction1d( a_Watt2d.b( ) ) ),
+        m_inverseCdfTable( ) {
 
     m_type = ProbabilityBase2dType::Watt;
 }
@@ -2102,6 +2687,44 @@ HOST_DEVICE Watt2d::~Watt2d( ) {
     delete m_a;
     delete m_b;
 }
+
+/* *********************************************************************************************************//**
+ * The Watt spectrum for **inverseCdfTableBuild**. The cdf is the integral of exp( -E' / a ) sinh( sqrt( b E' ) ) from 0 to E'.
+ ***********************************************************************************************************/
+
+class InverseCdfTableWatt {
+
+    private:
+        double m_U;
+        Functions::Function1d const *m_a;
+        Functions::Function1d const *m_b;
+
+    public:
+        InverseCdfTableWatt( double a_U, Functions::Function1d const *a_a, Functions::Function1d const *a_b ) : m_U( a_U ), m_a( a_a ), m_b( a_b ) { }
+
+        double energyOutMax( double a_energy ) const { return( a_energy - m_U ); }
+        double cdf( double a_energy, double a_energyOut ) const {
+            double Watt_a = m_a->evaluate( a_energy ), Watt_b = m_b->evaluate( a_energy );
+            double sqrt_ab_4 = 0.5 * sqrt( Watt_a * Watt_b ), sqrt_Ep_a = sqrt( a_energyOut / Watt_a );
+
+            return( 0.5 * sqrt_ab_4 * Watt_a * sqrt( M_PI ) * exp( sqrt_ab_4 * sqrt_ab_4 ) * ( erf( sqrt_Ep_a - sqrt_ab_4 ) + erf( sqrt_Ep_a + sqrt_ab_4 ) )
+                    - Watt_a * exp( -a_energyOut / Watt_a ) * sinh( sqrt( Watt_b * a_energyOut ) ) );
+        }
+};
+
+/* *********************************************************************************************************//**
+ * Builds the inverse cdf table used to sample *this*.
+ *
+ * @param a_tolerance           [in]    The tolerance of the table relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST void Watt2d::buildInverseCdfTable( double a_tolerance ) {
+
+    double energyMin = std::max( std::max( m_a->domainMin( ), m_b->domainMin( ) ), m_U );
+    double energyMax = std::min( m_a->domainMax( ), m_b->domainMax( ) );
+
+    inverseCdfTableBuild( m_inverseCdfTable, InverseCdfTableWatt( m_U, m_a, m_b ), energyMin, energyMax, a_tolerance );
+}
 /*
 ============================================================
 */
@@ -2127,6 +2750,8 @@ HOST_DEVICE double Watt2d::sample( double a_x2, double a_rngValue, double (*a_us
 /*
 *   From MCAPM via Sample Watt Spectrum as in TART ( Kalos algorithm ).
 */
+    if( m_inverseCdfTable.active( ) ) return( m_inverseCdfTable.sample( a_x2, a_rngValue ) );
+
     double WattMin = 0., WattMax = a_x2 - m_U, x, y, z, energyOut, rand1, rand2;
     double Watt_a = m_a->evaluate( a_x2 );
     double Watt_b = m_b->evaluate( a_x2 );
@@ -2158,6 +2783,7 @@ HOST_DEVICE void Watt2d::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mod
     DATA_MEMBER_FLOAT( m_U, a_buffer, a_mode );
     m_a = serializeFunction1d( a_buffer, a_mode, m_a );
     m_b = serializeFunction1d( a_buffer, a_mode, m_b );
+    m_inverseCdfTable.serialize( a_buffer, a_mode );
 }
 
 /*
@@ -2196,6 +2822,48 @@ HOST_DEVICE WeightedFunctionals2d::~WeightedFunctionals2d( ) {
     for( MCGIDI_VectorSizeType i1 = 0; i1 < m_weight.size( ); ++i1 ) delete m_weight[i1];
     for( MCGIDI_VectorSizeType i1 = 0; i1 < m_energy.size( ); ++i1 ) delete m_energy[i1];
 }
+
+/* *********************************************************************************************************//**
+ * Sets the stochastic interpolation flag of each energy probability of *this*.
+ *
+ * @param a_stochasticInterpolation     [in]    If true, tabulated energy probabilities are sampled with stochastic interpolation.
+ ***********************************************************************************************************/
+
+HOST void WeightedFunctionals2d::setStochasticInterpolation( bool a_stochasticInterpolation ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_energy.size( ); ++i1 ) setStochasticInterpolation2d( m_energy[i1], a_stochasticInterpolation );
+}
+
+/* *********************************************************************************************************//**
+ * Builds alias tables for each energy probability of *this*. As only one energy probability is sampled per call, each decides for itself.
+ ***********************************************************************************************************/
+
+HOST void WeightedFunctionals2d::buildAliasTables( ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_energy.size( ); ++i1 ) buildAliasTables2d( m_energy[i1] );
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for the energy probabilities of *this*.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void WeightedFunctionals2d::buildGuideTables( double a_guideTableFactor ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_energy.size( ); ++i1 ) buildGuideTables2d( m_energy[i1], a_guideTableFactor );
+}
+
+/* *********************************************************************************************************//**
+ * Builds inverse cdf tables for the analytic spectra of *this*.
+ *
+ * @param a_tolerance           [in]    The tolerance of the tables relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST void WeightedFunctionals2d::buildInverseCdfTables( double a_tolerance ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_energy.size( ); ++i1 ) buildInverseCdfTables2d( m_energy[i1], a_tolerance );
+}
 /*
 ============================================================
 */
@@ -2224,7 +2892,7 @@ c   This routine assumes that the weights sum to 1.
         cumulativeWeight += m_weight[i1]->evaluate( a_x2 );
         if( cumulativeWeight >= randomWeight ) break;
     }
-    return( m_energy[i1]->sample( a_x2, a_rngValue, a_userrng, a_rngState) );
+    return( sampleProbability2d( m_energy[i1], a_x2, a_rngValue, a_userrng, a_rngState ) );
 }
 
 /* *********************************************************************************************************//**
@@ -2327,7 +2995,8 @@ HOST_DEVICE void ProbabilityBase3d::serialize( DataBuffer &a_buffer, DataBuffer:
 ============================================================
 */
 HOST_DEVICE XYs3d::XYs3d( ) :
-        m_probabilities( ) {
+        m_probabilities( ),
+        m_stochasticInterpolation( false ) {
 
     m_type = ProbabilityBase3dType::XYs;
 }
@@ -2335,7 +3004,8 @@ HOST_DEVICE XYs3d::XYs3d( ) :
 ============================================================
 */
 HOST XYs3d::XYs3d( GIDI::Functions::XYs3d const &a_XYs3d ) :
-        ProbabilityBase3d( a_XYs3d, a_XYs3d.Xs( ) ) {
+        ProbabilityBase3d( a_XYs3d, a_XYs3d.Xs( ) ),
+        m_stochasticInterpolation( false ) {
 
     m_type = ProbabilityBase3dType::XYs;
 
@@ -2351,6 +3021,41 @@ HOST_DEVICE XYs3d::~XYs3d( ) {
 
     for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) delete m_probabilities[i1];
 }
+
+/* *********************************************************************************************************//**
+ * Sets the stochastic interpolation flag of *this* and of each of its 2d probabilities.
+ *
+ * @param a_stochasticInterpolation     [in]    If true, only one of the two bracketing probabilities is sampled.
+ ***********************************************************************************************************/
+
+HOST void XYs3d::setStochasticInterpolation( bool a_stochasticInterpolation ) {
+
+    m_stochasticInterpolation = a_stochasticInterpolation;
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) setStochasticInterpolation2d( m_probabilities[i1], a_stochasticInterpolation );
+}
+
+/* *********************************************************************************************************//**
+ * Builds alias tables for the 2d probabilities of *this* if each sample uses only one of them (i.e., for stochastic or flat
+ * interpolation). See XYs2d::buildAliasTables.
+ ***********************************************************************************************************/
+
+HOST void XYs3d::buildAliasTables( ) {
+
+    if( !m_stochasticInterpolation && ( interpolation( ) != Interpolation::FLAT ) ) return;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) buildAliasTables2d( m_probabilities[i1] );
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for the probabilities of *this*.
+ *
+ * @param a_guideTableFactor    [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void XYs3d::buildGuideTables( double a_guideTableFactor ) {
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_probabilities.size( ); ++i1 ) buildGuideTables2d( m_probabilities[i1], a_guideTableFactor );
+}
 /*
 ============================================================
 */
@@ -2394,26 +3099,35 @@ HOST_DEVICE double XYs3d::evaluate( double a_x3, double a_x2, double a_x1 ) cons
 /*
 ============================================================
 */
-HOST_DEVICE double XYs3d::sample( double a_x3, double a_x2_1, double a_x2_2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const {
+HOST_DEVICE double XYs3d::sample( double a_x3, double a_x2_1, double a_x2_2, double a_bracketRngValue, double a_rngValue, double (*a_userrng)( void * ), 
+                void *a_rngState ) const {
 /*
 C    Samples from a pdf(x1|x3,x2). First determine which pdf(s) to sample from given x3
 C    Then use rngValue to sample from pdf2_1(x2) and maybe pdf2_2(x2) and interpolate to
-C    determine x1.
+C    determine x1. For stochastic interpolation, only one of pdf2_1(x2) and pdf2_2(x2) is sampled. It is chosen with
+C    a_bracketRngValue if not negative so that x2 and x1 are sampled at the same x3 bracket (see XYs2d::sample2dOf3d).
 */
     double sampledValue;
     MCGIDI_VectorSizeType lower = binarySearchVector( a_x3, m_Xs );
 
     if( lower == -2 ) {                         // x3 < first value of Xs.
-        sampledValue = m_probabilities[0]->sample( a_x2_1, a_rngValue, a_userrng, a_rngState ); }
+        sampledValue = sampleProbability2d( m_probabilities[0], a_x2_1, a_rngValue, a_userrng, a_rngState ); }
     else if( lower == -1 ) {                    // x3 > last value of Xs.
-        sampledValue = m_probabilities.back( )->sample( a_x2_1, a_rngValue, a_userrng, a_rngState ); }
+        sampledValue = sampleProbability2d( m_probabilities.back( ), a_x2_1, a_rngValue, a_userrng, a_rngState ); }
+    else if( m_stochasticInterpolation && ( interpolation( ) != Interpolation::FLAT ) ) {
+        if( a_bracketRngValue < 0.0 ) a_bracketRngValue = a_userrng( a_rngState );
+        if( a_bracketRngValue < stochasticInterpolationLowerWeight( interpolation( ), a_x3, m_Xs[lower], m_Xs[lower+1] ) ) {
+            sampledValue = sampleProbability2d( m_probabilities[lower], a_x2_1, a_rngValue, a_userrng, a_rngState ); }
+        else {
+            sampledValue = sampleProbability2d( m_probabilities[lower+1], a_x2_2, a_rngValue, a_userrng, a_rngState );
+        } }
     else {
-        double sampled1 = m_probabilities[lower]->sample( a_x2_1, a_rngValue, a_userrng, a_rngState );
+        double sampled1 = sampleProbability2d( m_probabilities[lower], a_x2_1, a_rngValue, a_userrng, a_rngState );
 
         if( interpolation( ) == Interpolation::FLAT ) {
             sampledValue = sampled1; }
         else {
-            double sampled2 = m_probabilities[lower+1]->sample( a_x2_2, a_rngValue, a_userrng, a_rngState );
+            double sampled2 = sampleProbability2d( m_probabilities[lower+1], a_x2_2, a_rngValue, a_userrng, a_rngState );
 
             if( interpolation( ) == Interpolation::LINLIN ) {
                 double fraction = ( m_Xs[lower+1] - a_x3 ) / ( m_Xs[lower+1] - m_Xs[lower] );
@@ -2447,6 +3161,7 @@ C    determine x1.
 HOST_DEVICE void XYs3d::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
 
     ProbabilityBase3d::serialize( a_buffer, a_mode );
+    DATA_MEMBER_CAST( m_stochasticInterpolation, a_buffer, a_mode, bool );
 
     MCGIDI_VectorSizeType vectorSize = m_probabilities.size( );
     int vectorSizeInt = (int) vectorSize;
@@ -2537,6 +3252,169 @@ HOST ProbabilityBase3d *parseProbability3d( GIDI::Functions::Function3dForm cons
     return( nullptr );
 }
 
+/* *********************************************************************************************************//**
+ * Sets the stochastic interpolation flag of all tabulated probabilities in *a_probability2d*. For stochastic interpolation, only
+ * one of the two probabilities bracketing the incident value is sampled, chosen with probability given by the interpolation 
+ * fraction, instead of sampling both and interpolating the sampled values.
+ *
+ * @param a_probability2d               [in]    The probability whose flag is set. Can be a *nullptr*.
+ * @param a_stochasticInterpolation     [in]    The value of the flag.
+ ***********************************************************************************************************/
+
+HOST void setStochasticInterpolation2d( ProbabilityBase2d *a_probability2d, bool a_stochasticInterpolation ) {
+
+    switch( ProbabilityBase2dClass( a_probability2d ) ) {
+    case ProbabilityBase2dType::XYs :
+        static_cast<XYs2d *>( a_probability2d )->setStochasticInterpolation( a_stochasticInterpolation );
+        break;
+    case ProbabilityBase2dType::regions :
+        static_cast<Regions2d *>( a_probability2d )->setStochasticInterpolation( a_stochasticInterpolation );
+        break;
+    case ProbabilityBase2dType::weightedFunctionals :
+        static_cast<WeightedFunctionals2d *>( a_probability2d )->setStochasticInterpolation( a_stochasticInterpolation );
+        break;
+    default :
+        break;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Sets the stochastic interpolation flag of all tabulated probabilities in *a_probability3d*. See **setStochasticInterpolation2d**.
+ *
+ * @param a_probability3d               [in]    The probability whose flag is set. Can be a *nullptr*.
+ * @param a_stochasticInterpolation     [in]    The value of the flag.
+ ***********************************************************************************************************/
+
+HOST void setStochasticInterpolation3d( ProbabilityBase3d *a_probability3d, bool a_stochasticInterpolation ) {
+
+    if( ProbabilityBase3dClass( a_probability3d ) == ProbabilityBase3dType::XYs )
+        static_cast<XYs3d *>( a_probability3d )->setStochasticInterpolation( a_stochasticInterpolation );
+}
+
+/* *********************************************************************************************************//**
+ * Builds alias tables for the pdf/cdf probabilities in *a_probability2d* that are sampled independently of other probabilities.
+ * Should be called after the stochastic interpolation flags are set as these determine which probabilities qualify.
+ *
+ * @param a_probability2d               [in]    The probability whose alias tables are built. Can be a *nullptr*.
+ ***********************************************************************************************************/
+
+HOST void buildAliasTables2d( ProbabilityBase2d *a_probability2d ) {
+
+    switch( ProbabilityBase2dClass( a_probability2d ) ) {
+    case ProbabilityBase2dType::XYs :
+        static_cast<XYs2d *>( a_probability2d )->buildAliasTables( );
+        break;
+    case ProbabilityBase2dType::regions :
+        static_cast<Regions2d *>( a_probability2d )->buildAliasTables( );
+        break;
+    case ProbabilityBase2dType::weightedFunctionals :
+        static_cast<WeightedFunctionals2d *>( a_probability2d )->buildAliasTables( );
+        break;
+    default :
+        break;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds alias tables for the pdf/cdf probabilities in *a_probability3d* that are sampled independently of other probabilities.
+ * See **buildAliasTables2d**.
+ *
+ * @param a_probability3d               [in]    The probability whose alias tables are built. Can be a *nullptr*.
+ ***********************************************************************************************************/
+
+HOST void buildAliasTables3d( ProbabilityBase3d *a_probability3d ) {
+
+    if( ProbabilityBase3dClass( a_probability3d ) == ProbabilityBase3dType::XYs ) static_cast<XYs3d *>( a_probability3d )->buildAliasTables( );
+}
+
+/* *********************************************************************************************************//**
+ * Builds the guide table for *a_probability1d* if it is a pdf/cdf probability.
+ *
+ * @param a_probability1d               [in]    The probability whose guide table is built. Can be a *nullptr*.
+ * @param a_guideTableFactor            [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void buildGuideTables1d( ProbabilityBase1d *a_probability1d, double a_guideTableFactor ) {
+
+    if( ProbabilityBase1dClass( a_probability1d ) == ProbabilityBase1dType::xs_pdf_cdf )
+        static_cast<Xs_pdf_cdf1d *>( a_probability1d )->buildGuideTable( a_guideTableFactor );
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for all pdf/cdf probabilities in *a_probability2d*. Should be called after alias tables are built as
+ * pdf/cdf probabilities with an alias table do not get a guide table.
+ *
+ * @param a_probability2d               [in]    The probability whose guide tables are built. Can be a *nullptr*.
+ * @param a_guideTableFactor            [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void buildGuideTables2d( ProbabilityBase2d *a_probability2d, double a_guideTableFactor ) {
+
+    switch( ProbabilityBase2dClass( a_probability2d ) ) {
+    case ProbabilityBase2dType::XYs :
+        static_cast<XYs2d *>( a_probability2d )->buildGuideTables( a_guideTableFactor );
+        break;
+    case ProbabilityBase2dType::regions :
+        static_cast<Regions2d *>( a_probability2d )->buildGuideTables( a_guideTableFactor );
+        break;
+    case ProbabilityBase2dType::NBodyPhaseSpace :
+        static_cast<NBodyPhaseSpace2d *>( a_probability2d )->buildGuideTables( a_guideTableFactor );
+        break;
+    case ProbabilityBase2dType::generalEvaporation :
+        static_cast<GeneralEvaporation2d *>( a_probability2d )->buildGuideTables( a_guideTableFactor );
+        break;
+    case ProbabilityBase2dType::weightedFunctionals :
+        static_cast<WeightedFunctionals2d *>( a_probability2d )->buildGuideTables( a_guideTableFactor );
+        break;
+    default :
+        break;
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Builds guide tables for all pdf/cdf probabilities in *a_probability3d*. See **buildGuideTables2d**.
+ *
+ * @param a_probability3d               [in]    The probability whose guide tables are built. Can be a *nullptr*.
+ * @param a_guideTableFactor            [in]    The number of guide table intervals per cdf bin.
+ ***********************************************************************************************************/
+
+HOST void buildGuideTables3d( ProbabilityBase3d *a_probability3d, double a_guideTableFactor ) {
+
+    if( ProbabilityBase3dClass( a_probability3d ) == ProbabilityBase3dType::XYs )
+        static_cast<XYs3d *>( a_probability3d )->buildGuideTables( a_guideTableFactor );
+}
+
+/* *********************************************************************************************************//**
+ * Builds inverse cdf tables for the evaporation, simple Maxwellian fission and Watt spectra in *a_probability2d* so that they are
+ * sampled by table lookup instead of by rejection or root finding.
+ *
+ * @param a_probability2d               [in]    The probability whose spectra are tabulated. Can be a *nullptr*.
+ * @param a_tolerance                   [in]    The tolerance of the tables relative to the mean outgoing energy.
+ ***********************************************************************************************************/
+
+HOST void buildInverseCdfTables2d( ProbabilityBase2d *a_probability2d, double a_tolerance ) {
+
+    switch( ProbabilityBase2dClass( a_probability2d ) ) {
+    case ProbabilityBase2dType::regions :
+        static_cast<Regions2d *>( a_probability2d )->buildInverseCdfTables( a_tolerance );
+        break;
+    case ProbabilityBase2dType::evaporation :
+        static_cast<Evaporation2d *>( a_probability2d )->buildInverseCdfTable( a_tolerance );
+        break;
+    case ProbabilityBase2dType::simpleMaxwellianFission :
+        static_cast<SimpleMaxwellianFission2d *>( a_probability2d )->buildInverseCdfTable( a_tolerance );
+        break;
+    case ProbabilityBase2dType::Watt :
+        static_cast<Watt2d *>( a_probability2d )->buildInverseCdfTable( a_tolerance );
+        break;
+    case ProbabilityBase2dType::weightedFunctionals :
+        static_cast<WeightedFunctionals2d *>( a_probability2d )->buildInverseCdfTables( a_tolerance );
+        break;
+    default :
+        break;
+    }
+}
+
 /*
 ============================================================
 */
@@ -3121,4 +3999,134 @@ HOST_DEVICE Probabilities::ProbabilityBase3d *serializeProbability3d( DataBuffer
     return( a_probability3d );
 }
 
+
+/* *********************************************************************************************************//**
+ * Returns the value of *a_function1d* at *a_x1*. The call is dispatched on the type of *a_function1d* to the non-virtual **evaluate**
+ * method of its class so that the compiler can inline it. If MCGIDI_VirtualDispatch is defined, the virtual **evaluate** is called.
+ *
+ * @param a_function1d          [in]    The function to evaluate.
+ * @param a_x1                  [in]    The value of the function's domain to evaluate the function at.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double evaluateFunction1d( Functions::Function1d const *a_function1d, double a_x1 ) {
+
+#ifndef MCGIDI_VirtualDispatch
+    switch( a_function1d->type( ) ) {
+    case Function1dType::constant :
+        return( static_cast<Functions::Constant1d const *>( a_function1d )->Functions::Constant1d::evaluate( a_x1 ) );
+    case Function1dType::XYs :
+        return( static_cast<Functions::XYs1d const *>( a_function1d )->Functions::XYs1d::evaluate( a_x1 ) );
+    case Function1dType::polyomial :
+        return( static_cast<Functions::Polynomial1d const *>( a_function1d )->Functions::Polynomial1d::evaluate( a_x1 ) );
+    case Function1dType::gridded :
+        return( static_cast<Functions::Gridded1d const *>( a_function1d )->Functions::Gridded1d::evaluate( a_x1 ) );
+    case Function1dType::regions :
+        return( static_cast<Functions::Regions1d const *>( a_function1d )->Functions::Regions1d::evaluate( a_x1 ) );
+    default :
+        break;
+    }
+#endif
+
+    return( a_function1d->evaluate( a_x1 ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns a value sampled from *a_probability1d*. The call is dispatched on the type of *a_probability1d* to the non-virtual
+ * **sample** method of its class. If MCGIDI_VirtualDispatch is defined, the virtual **sample** is called.
+ *
+ * @param a_probability1d       [in]    The probability to sample.
+ * @param a_rngValue            [in]    The random number used to sample.
+ * @param a_userrng             [in]    The random number generator function.
+ * @param a_rngState            [in]    The state for the random number generator.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double sampleProbability1d( Probabilities::ProbabilityBase1d const *a_probability1d, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) {
+
+#ifndef MCGIDI_VirtualDispatch
+    if( a_probability1d->type( ) == ProbabilityBase1dType::xs_pdf_cdf )
+        return( static_cast<Probabilities::Xs_pdf_cdf1d const *>( a_probability1d )->Probabilities::Xs_pdf_cdf1d::sample( a_rngValue, a_userrng, a_rngState ) );
+#endif
+
+    return( a_probability1d->sample( a_rngValue, a_userrng, a_rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns a value sampled from *a_probability2d* at *a_x2*. The call is dispatched on the type of *a_probability2d* to the non-virtual
+ * **sample** method of its class. If MCGIDI_VirtualDispatch is defined, the virtual **sample** is called.
+ *
+ * @param a_probability2d       [in]    The probability to sample.
+ * @param a_x2                  [in]    The value of the outer most domain (e.g., the projectile's energy).
+ * @param a_rngValue            [in]    The random number used to sample.
+ * @param a_userrng             [in]    The random number generator function.
+ * @param a_rngState            [in]    The state for the random number generator.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double sampleProbability2d( Probabilities::ProbabilityBase2d const *a_probability2d, double a_x2, double a_rngValue, double (*a_userrng)( void * ), 
+                void *a_rngState ) {
+
+#ifndef MCGIDI_VirtualDispatch
+    switch( a_probability2d->type( ) ) {
+    case ProbabilityBase2dType::XYs :
+        return( static_cast<Probabilities::XYs2d const *>( a_probability2d )->Probabilities::XYs2d::sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+    case ProbabilityBase2dType::regions :
+        return( static_cast<Probabilities::Regions2d const *>( a_probability2d )->Probabilities::Regions2d::sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+    case ProbabilityBase2dType::isotropic :
+        return( static_cast<Probabilities::Isotropic2d const *>( a_probability2d )->Probabilities::Isotropic2d::sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+    case ProbabilityBase2dType::discreteGamma :
+        return( static_cast<Probabilities::DiscreteGamma2d const *>( a_probability2d )->Probabilities::DiscreteGamma2d::sample( a_x2, a_rngValue, a_userrng, 
+                a_rngState ) );
+    case ProbabilityBase2dType::primaryGamma :
+        return( static_cast<Probabilities::PrimaryGamma2d const *>( a_probability2d )->Probabilities::PrimaryGamma2d::sample( a_x2, a_rngValue, a_userrng, 
+                a_rngState ) );
+    case ProbabilityBase2dType::NBodyPhaseSpace :
+        return( static_cast<Probabilities::NBodyPhaseSpace2d const *>( a_probability2d )->Probabilities::NBodyPhaseSpace2d::sample( a_x2, a_rngValue, a_userrng, 
+                a_rngState ) );
+    case ProbabilityBase2dType::evaporation :
+        return( static_cast<Probabilities::Evaporation2d const *>( a_probability2d )->Probabilities::Evaporation2d::sample( a_x2, a_rngValue, a_userrng, 
+                a_rngState ) );
+    case ProbabilityBase2dType::generalEvaporation :
+        return( static_cast<Probabilities::GeneralEvaporation2d const *>( a_probability2d )->Probabilities::GeneralEvaporation2d::sample( a_x2, a_rngValue, 
+                a_userrng, a_rngState ) );
+    case ProbabilityBase2dType::simpleMaxwellianFission :
+        return( static_cast<Probabilities::SimpleMaxwellianFission2d const *>( a_probability2d )->Probabilities::SimpleMaxwellianFission2d::sample( a_x2, 
+                a_rngValue, a_userrng, a_rngState ) );
+    case ProbabilityBase2dType::Watt :
+        return( static_cast<Probabilities::Watt2d const *>( a_probability2d )->Probabilities::Watt2d::sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+    case ProbabilityBase2dType::weightedFunctionals :
+        return( static_cast<Probabilities::WeightedFunctionals2d const *>( a_probability2d )->Probabilities::WeightedFunctionals2d::sample( a_x2, a_rngValue, 
+                a_userrng, a_rngState ) );
+    default :
+        break;
+    }
+#endif
+
+    return( a_probability2d->sample( a_x2, a_rngValue, a_userrng, a_rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns a value sampled from *a_probability3d*. The call is dispatched on the type of *a_probability3d* to the non-virtual
+ * **sample** method of its class. If MCGIDI_VirtualDispatch is defined, the virtual **sample** is called.
+ *
+ * @param a_probability3d       [in]    The probability to sample.
+ * @param a_x3                  [in]    The value of the outer most domain (e.g., the projectile's energy).
+ * @param a_x2_1                [in]    The value of the second domain sampled from the lower bracketing probability.
+ * @param a_x2_2                [in]    The value of the second domain sampled from the upper bracketing probability.
+ * @param a_bracketRngValue     [in]    The random number returned by **sample2dOf3d** when sampling the second domain, or -1.
+ * @param a_rngValue            [in]    The random number used to sample.
+ * @param a_userrng             [in]    The random number generator function.
+ * @param a_rngState            [in]    The state for the random number generator.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double sampleProbability3d( Probabilities::ProbabilityBase3d const *a_probability3d, double a_x3, double a_x2_1, double a_x2_2, double a_bracketRngValue, 
+                double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) {
+
+#ifndef MCGIDI_VirtualDispatch
+    if( a_probability3d->type( ) == ProbabilityBase3dType::XYs )
+        return( static_cast<Probabilities::XYs3d const *>( a_probability3d )->Probabilities::XYs3d::sample( a_x3, a_x2_1, a_x2_2, a_bracketRngValue, a_rngValue, 
+                a_userrng, a_rngState ) );
+#endif
+
+    return( a_probability3d->sample( a_x3, a_x2_1, a_x2_2, a_bracketRngValue, a_rngValue, a_userrng, a_rngState ) );
+}
+
 }           // End of namespace MCGIDI.
@@ -73,7 +73,7 @@ class Function1d : public FunctionBase {
 
         HOST_DEVICE virtual int sampleBoundingInteger( double a_x1, double (*rng)( void * ), void *rngState ) const ;
         HOST_DEVICE virtual double evaluate( double a_x1 ) const = 0;
-        HOST_DEVICE Function1dType type( ) { return( m_type ); }
+        HOST_DEVICE Function1dType type( ) const { return( m_type ); }
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -238,7 +238,7 @@ class Function2d : public FunctionBase {
         HOST Function2d( double a_domainMin, double a_domainMax, Interpolation a_interpolation, double a_outerDomainValue = 0 );
         HOST_DEVICE ~Function2d( );
 
-        HOST_DEVICE Function2dType type( ) { return m_type; }
+        HOST_DEVICE Function2dType type( ) const { return m_type; }
         HOST_DEVICE virtual double evaluate( double a_x2, double a_x1 ) const = 0;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
@@ -301,6 +301,8 @@ class ProbabilityBase : public Functions::FunctionBase {
         HOST ProbabilityBase( GIDI::Functions::FunctionForm const &a_probabilty );
         HOST ProbabilityBase( GIDI::Functions::FunctionForm const &a_probabilty, Vector<double> const &a_Xs );
         HOST_DEVICE ~ProbabilityBase( );
+
+        HOST_DEVICE Vector<double> const &Xs( ) const { return( m_Xs ); }                  /**< Returns a reference to **m_Xs**. */
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -319,7 +321,7 @@ class ProbabilityBase1d : public ProbabilityBase {
         HOST ProbabilityBase1d( GIDI::Functions::FunctionForm const &a_probabilty, Vector<double> const &a_Xs );
         HOST_DEVICE ~ProbabilityBase1d( );
 
-        HOST_DEVICE ProbabilityBase1dType type( ) { return m_type; }
+        HOST_DEVICE ProbabilityBase1dType type( ) const { return m_type; }
         HOST_DEVICE virtual double evaluate( double a_x1 ) const = 0;
         HOST_DEVICE virtual double sample( double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const = 0;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -333,14 +335,23 @@ class ProbabilityBase1d : public ProbabilityBase {
 class Xs_pdf_cdf1d : public ProbabilityBase1d {
 
     private:
-        Vector<double> m_pdf;
+        Vector<MCGIDI_StorageType> m_pdf;
         Vector<double> m_cdf;
+        Vector<double> m_aliasProbabilities;            /**< For each cdf bin, the probability of keeping the bin in alias sampling. Empty if no alias table. */
+        Vector<int> m_aliasIndices;                     /**< For each cdf bin, the bin selected when the bin is not kept in alias sampling. */
+        Vector<int> m_guideIndices;                     /**< For equally spaced cdf values, the cdf bin containing the value. Empty if no guide table. */
 
     public:
         HOST_DEVICE Xs_pdf_cdf1d( );
         HOST Xs_pdf_cdf1d( GIDI::Functions::Xs_pdf_cdf1d const &a_xs_pdf_cdf1d );
         HOST_DEVICE ~Xs_pdf_cdf1d( );
 
+        HOST_DEVICE Vector<MCGIDI_StorageType> const &pdf( ) const { return( m_pdf ); }    /**< Returns a reference to **m_pdf**. */
+        HOST_DEVICE Vector<double> const &cdf( ) const { return( m_cdf ); }                /**< Returns a reference to **m_cdf**. */
+        HOST_DEVICE bool hasAliasTable( ) const { return( m_aliasIndices.size( ) > 0 ); }  /**< Returns *true* if *this* has an alias table and *false* otherwise. */
+        HOST void buildAliasTable( );
+        HOST_DEVICE bool hasGuideTable( ) const { return( m_guideIndices.size( ) > 0 ); }  /**< Returns *true* if *this* has a guide table and *false* otherwise. */
+        HOST void buildGuideTable( double a_guideTableFactor );
         HOST_DEVICE double evaluate( double a_x1 ) const ;
         HOST_DEVICE double sample( double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -362,10 +373,10 @@ class ProbabilityBase2d : public ProbabilityBase {
         HOST ProbabilityBase2d( GIDI::Functions::FunctionForm const &a_probabilty, Vector<double> const &a_Xs );
         HOST_DEVICE ~ProbabilityBase2d( );
 
-        HOST_DEVICE ProbabilityBase2dType type( ) { return m_type; }
+        HOST_DEVICE ProbabilityBase2dType type( ) const { return m_type; }
         HOST_DEVICE virtual double evaluate( double a_x2, double a_x1 ) const = 0;
         HOST_DEVICE virtual double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const = 0;
-        HOST_DEVICE virtual double sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2 ) const ;
+        HOST_DEVICE virtual double sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2, double *a_bracketRngValue ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -378,15 +389,22 @@ class XYs2d : public ProbabilityBase2d {
 
     private:
         Vector<ProbabilityBase1d *> m_probabilities;
+        bool m_stochasticInterpolation;                 /**< If true, only one of the two bracketing probabilities is sampled, chosen by the interpolation fraction. */
 
     public:
         HOST_DEVICE XYs2d( );
         HOST XYs2d( GIDI::Functions::XYs2d const &a_XYs2d );
         HOST_DEVICE ~XYs2d( );
 
+        HOST_DEVICE Vector<ProbabilityBase1d *> const &probabilities( ) const { return( m_probabilities ); }    /**< Returns a reference to **m_probabilities**. */
+        HOST_DEVICE bool stochasticInterpolation( ) const { return( m_stochasticInterpolation ); }              /**< Returns the value of the **m_stochasticInterpolation**. */
+        HOST void setStochasticInterpolation( bool a_stochasticInterpolation ) { m_stochasticInterpolation = a_stochasticInterpolation; }
+                                                                                /**< Sets the value of the **m_stochasticInterpolation**. */
+        HOST void buildAliasTables( );
+        HOST void buildGuideTables( double a_guideTableFactor );
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
-        HOST_DEVICE double sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2 ) const ;
+        HOST_DEVICE double sample2dOf3d( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState, double *a_x1_1, double *a_x1_2, double *a_bracketRngValue ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -405,6 +423,10 @@ class Regions2d : public ProbabilityBase2d {
         HOST Regions2d( GIDI::Functions::Regions2d const &a_regions2d );
         HOST_DEVICE ~Regions2d( );
 
+        HOST void setStochasticInterpolation( bool a_stochasticInterpolation );
+        HOST void buildAliasTables( );
+        HOST void buildGuideTables( double a_guideTableFactor );
+        HOST void buildInverseCdfTables( double a_tolerance );
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -508,11 +530,35 @@ class NBodyPhaseSpace2d : public ProbabilityBase2d {
         HOST NBodyPhaseSpace2d( GIDI::Functions::NBodyPhaseSpace2d const &a_NBodyPhaseSpace2d, SetupInfo *a_setupInfo );
         HOST_DEVICE ~NBodyPhaseSpace2d( );
 
+        HOST void buildGuideTables( double a_guideTableFactor );
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
+/*
+============================================================
+==================== InverseCdfTable2d =====================
+============================================================
+*/
+class InverseCdfTable2d {
+
+    private:
+        int m_numberOfCdfIntervals;                     /**< The number of equal cdf intervals of each table. */
+        Vector<double> m_energies;                      /**< The projectile energies of the tables. Empty if *this* is not active. */
+        Vector<double> m_outgoingEnergies;              /**< For each projectile energy, the outgoing energies at cdf = i / *m_numberOfCdfIntervals*, flattened. */
+
+    public:
+        HOST_DEVICE InverseCdfTable2d( );
+        HOST void setup( std::vector<double> const &a_energies, int a_numberOfCdfIntervals, std::vector<double> const &a_outgoingEnergies );
+
+        HOST_DEVICE bool active( ) const { return( m_energies.size( ) > 0 ); }        /**< Returns *true* if *this* has tables and *false* otherwise. */
+        HOST_DEVICE int numberOfCdfIntervals( ) const { return( m_numberOfCdfIntervals ); }    /**< Returns the value of the **m_numberOfCdfIntervals**. */
+        HOST_DEVICE Vector<double> const &energies( ) const { return( m_energies ); }          /**< Returns a reference to **m_energies**. */
+        HOST_DEVICE double sample( double a_energy, double a_rngValue ) const ;
+        HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
+};
+
 /*
 ============================================================
 ====================== Evaporation2d =======================
@@ -523,12 +569,15 @@ class Evaporation2d: public ProbabilityBase2d {
     private:
         double m_U;
         Functions::Function1d *m_theta;
+        InverseCdfTable2d m_inverseCdfTable;            /**< If active, used to sample *this*. */
 
     public:
         HOST_DEVICE Evaporation2d( );
         HOST Evaporation2d( GIDI::Functions::Evaporation2d const &a_generalEvaporation2d );
         HOST_DEVICE ~Evaporation2d( );
 
+        HOST void buildInverseCdfTable( double a_tolerance );
+
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -550,6 +599,7 @@ class GeneralEvaporation2d: public ProbabilityBase2d {
         HOST GeneralEvaporation2d( GIDI::Functions::GeneralEvaporation2d const &a_generalEvaporation2d );
         HOST_DEVICE ~GeneralEvaporation2d( );
 
+        HOST void buildGuideTables( double a_guideTableFactor );
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -565,12 +615,15 @@ class SimpleMaxwellianFission2d: public ProbabilityBase2d {
     private:
         double m_U;
         Functions::Function1d *m_theta;
+        InverseCdfTable2d m_inverseCdfTable;            /**< If active, used to sample *this*. */
 
     public:
         HOST_DEVICE SimpleMaxwellianFission2d( );
         HOST SimpleMaxwellianFission2d( GIDI::Functions::SimpleMaxwellianFission2d const &a_simpleMaxwellianFission2d );
         HOST_DEVICE ~SimpleMaxwellianFission2d( );
 
+        HOST void buildInverseCdfTable( double a_tolerance );
+
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -587,12 +640,15 @@ class Watt2d : public ProbabilityBase2d {
         double m_U;
         Functions::Function1d *m_a;
         Functions::Function1d *m_b;
+        InverseCdfTable2d m_inverseCdfTable;            /**< If active, used to sample *this*. */
 
     public:
         HOST_DEVICE Watt2d( );
         HOST Watt2d( GIDI::Functions::Watt2d const &a_Watt2d );
         HOST_DEVICE ~Watt2d( );
 
+        HOST void buildInverseCdfTable( double a_tolerance );
+
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -614,6 +670,10 @@ class WeightedFunctionals2d: public ProbabilityBase2d {
         HOST WeightedFunctionals2d( GIDI::Functions::WeightedFunctionals2d const &a_weightedFunctionals2d );
         HOST_DEVICE ~WeightedFunctionals2d( );
 
+        HOST void setStochasticInterpolation( bool a_stochasticInterpolation );
+        HOST void buildAliasTables( );
+        HOST void buildGuideTables( double a_guideTableFactor );
+        HOST void buildInverseCdfTables( double a_tolerance );
         HOST_DEVICE double evaluate( double a_x2, double a_x1 ) const ;
         HOST_DEVICE double sample( double a_x2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
@@ -634,9 +694,9 @@ class ProbabilityBase3d : public ProbabilityBase {
         HOST ProbabilityBase3d( GIDI::Functions::FunctionForm const &a_probabilty, Vector<double> const &a_Xs );
         HOST_DEVICE ~ProbabilityBase3d( );
 
-        HOST_DEVICE ProbabilityBase3dType type( ) { return m_type; }
+        HOST_DEVICE ProbabilityBase3dType type( ) const { return m_type; }
         HOST_DEVICE virtual double evaluate( double a_x3, double a_x2, double a_x1 ) const = 0;
-        HOST_DEVICE virtual double sample( double a_x3, double a_x2_1, double a_x2_2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const = 0;
+        HOST_DEVICE virtual double sample( double a_x3, double a_x2_1, double a_x2_2, double a_bracketRngValue, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const = 0;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -649,14 +709,19 @@ class XYs3d : public ProbabilityBase3d {
 
     private:
         Vector<ProbabilityBase2d *> m_probabilities;
+        bool m_stochasticInterpolation;                 /**< If true, only one of the two bracketing probabilities is sampled, chosen by the interpolation fraction. */
 
     public:
         HOST_DEVICE XYs3d( );
         HOST XYs3d( GIDI::Functions::XYs3d const &a_XYs3d );
         HOST_DEVICE ~XYs3d( );
 
+        HOST_DEVICE bool stochasticInterpolation( ) const { return( m_stochasticInterpolation ); }              /**< Returns the value of the **m_stochasticInterpolation**. */
+        HOST void setStochasticInterpolation( bool a_stochasticInterpolation );
+        HOST void buildAliasTables( );
+        HOST void buildGuideTables( double a_guideTableFactor );
         HOST_DEVICE double evaluate( double a_x3, double a_x2, double a_x1 ) const ;
-        HOST_DEVICE double sample( double a_x3, double a_x2_1, double a_x2_2, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
+        HOST_DEVICE double sample( double a_x3, double a_x2_1, double a_x2_2, double a_bracketRngValue, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState ) const ;
         HOST_DEVICE void serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode );
 };
 
@@ -671,6 +736,14 @@ HOST ProbabilityBase2d *parseProbability2d( Transporting::MC const &a_settings,
 HOST ProbabilityBase2d *parseProbability2d( GIDI::Functions::Function2dForm const *form2d, SetupInfo *a_setupInfo );
 HOST ProbabilityBase3d *parseProbability3d( Transporting::MC const &a_settings, GIDI::Suite const &a_suite );
 HOST ProbabilityBase3d *parseProbability3d( GIDI::Functions::Function3dForm const *form3d );
+HOST void setStochasticInterpolation2d( ProbabilityBase2d *a_probability2d, bool a_stochasticInterpolation );
+HOST void setStochasticInterpolation3d( ProbabilityBase3d *a_probability3d, bool a_stochasticInterpolation );
+HOST void buildAliasTables2d( ProbabilityBase2d *a_probability2d );
+HOST void buildAliasTables3d( ProbabilityBase3d *a_probability3d );
+HOST void buildGuideTables1d( ProbabilityBase1d *a_probability1d, double a_guideTableFactor );
+HOST void buildGuideTables2d( ProbabilityBase2d *a_probability2d, double a_guideTableFactor );
+HOST void buildGuideTables3d( ProbabilityBase3d *a_probability3d, double a_guideTableFactor );
+HOST void buildInverseCdfTables2d( ProbabilityBase2d *a_probability2d, double a_tolerance );
 
 
 }           // End of namespace Probabilities.
@@ -697,6 +770,14 @@ HOST_DEVICE Probabilities::ProbabilityBase2d *serializeProbability2d( DataBuffer
 HOST_DEVICE ProbabilityBase3dType ProbabilityBase3dClass (Probabilities::ProbabilityBase3d *funct );
 HOST_DEVICE Probabilities::ProbabilityBase3d *serializeProbability3d( DataBuffer &a_buffer, DataBuffer::Mode a_mode, Probabilities::ProbabilityBase3d *a_probability3d );
 
+// Non-virtual dispatch on the type tags. If MCGIDI_VirtualDispatch is defined, these call the virtual methods instead.
+HOST_DEVICE double evaluateFunction1d( Functions::Function1d const *a_function1d, double a_x1 );
+HOST_DEVICE double sampleProbability1d( Probabilities::ProbabilityBase1d const *a_probability1d, double a_rngValue, double (*a_userrng)( void * ), void *a_rngState );
+HOST_DEVICE double sampleProbability2d( Probabilities::ProbabilityBase2d const *a_probability2d, double a_x2, double a_rngValue, double (*a_userrng)( void * ), 
+                void *a_rngState );
+HOST_DEVICE double sampleProbability3d( Probabilities::ProbabilityBase3d const *a_probability3d, double a_x3, double a_x2_1, double a_x2_2, double a_bracketRngValue, double a_rngValue, 
+                double (*a_userrng)( void * ), void *a_rngState );
+
 }           // End of namespace MCGIDI.
 
 #endif      // End of MCGIDI_functions_hpp_included
@@ -7,6 +7,9 @@
 # <<END-copyright>>
 */
 
+#include <algorithm>
+#include <thread>
+
 #include "MCGIDI.hpp"
 
 #ifndef MCGIDI_CrossSectionLinearSubSearch
@@ -15,9 +18,35 @@
     #endif
 #endif
 
+#ifndef MCGIDI_CrossSectionBatchChunkSize
+    #define MCGIDI_CrossSectionBatchChunkSize 64
+#endif
+
+// If MCGIDI_CrossSectionVectorOpenMP is defined (set by building with MCGIDI_OPENMP, see Makefile.paths), the crossSectionVectors and
+// reactionCrossSectionVectors methods use OpenMP threads; otherwise, std::thread.
+
+#ifndef MCGIDI_DopplerBroadeningWidth
+    #define MCGIDI_DopplerBroadeningWidth 4.0
+#endif
+
+#ifndef MCGIDI_DopplerBroadeningIntervals
+    #define MCGIDI_DopplerBroadeningIntervals 64
+#endif
+
+#ifndef MCGIDI_DopplerBroadeningReactionChunkSize
+    #define MCGIDI_DopplerBroadeningReactionChunkSize 64
+#endif
+
 namespace MCGIDI {
 
 static void writeVector( FILE *a_file, std::string const &a_prefix, int a_offset, Vector<double> const &a_vector );
+template <typename FUNCTION> static void crossSectionVectorRanges( int a_size, int a_numberOfThreads, FUNCTION const &a_function );
+static void interpolateMultiGroupVectors( Vector<double> const &a_vector1, Vector<double> const &a_vector2, double a_fraction, Vector<double> &a_vector );
+static void thinStorageVector( Vector<MCGIDI_StorageType> &a_vector, int a_offset, std::vector<int> const &a_newIndices );
+static void mapCrossSectionToFixedGrid( std::vector<double> const &a_energies, std::vector<double> const &a_fixedGridPoints, std::vector<int> const &a_fixedGridIndices,
+                GIDI::Functions::Ys1d const &a_crossSection, GIDI::Functions::Ys1d &a_fixedGridCrossSection );
+HOST_DEVICE static double cumulativeReactionCrossSectionAt( double const *a_cumulative11, double const *a_cumulative21, double a_weight11, double a_weight12, 
+                double a_weight21, double a_weight22, int a_numberOfReactions, int a_reactionIndex );
 
 /*
 ============================================================
@@ -28,16 +57,18 @@ HOST_DEVICE HeatedReactionCrossSectionContinuousEnergy::HeatedReactionCrossSecti
         m_offset( 0 ),
         m_threshold( 0.0 ),
         m_crossSection( ),
+        m_crossSectionSource( -1 ),
         m_URR_probabilityTables( nullptr ) {
 
 }
 /*
 ============================================================
 */
-HOST HeatedReactionCrossSectionContinuousEnergy::HeatedReactionCrossSectionContinuousEnergy( int a_offset, double a_threshold, Vector<double> &a_crossSection ) :
+HOST HeatedReactionCrossSectionContinuousEnergy::HeatedReactionCrossSectionContinuousEnergy( int a_offset, double a_threshold, Vector<MCGIDI_StorageType> &a_crossSection ) :
         m_offset( a_offset ),
         m_threshold( a_threshold ),
         m_crossSection( a_crossSection ),
+        m_crossSectionSource( -1 ),
         m_URR_probabilityTables( nullptr ) {
 
 }
@@ -47,7 +78,8 @@ HOST HeatedReactionCrossSectionContinuousEnergy::HeatedReactionCrossSectionConti
 HOST HeatedReactionCrossSectionContinuousEnergy::HeatedReactionCrossSectionContinuousEnergy( double a_threshold, GIDI::Functions::Ys1d const &a_crossSection, Probabilities::ProbabilityBase2d *a_URR_probabilityTables ) :
         m_offset( a_crossSection.start( ) ),
         m_threshold( a_threshold ),
-        m_crossSection( a_crossSection.Ys( ) ),
+        m_crossSection( vectorDoublesToStorageVector( a_crossSection.Ys( ) ) ),
+        m_crossSectionSource( -1 ),
         m_URR_probabilityTables( a_URR_probabilityTables ) {
 
 }
@@ -70,22 +102,94 @@ HOST_DEVICE double HeatedReactionCrossSectionContinuousEnergy::URR_domainMax( )
     return( -1.0 );    
 }
 
+/* *********************************************************************************************************//**
+ * Returns the largest factor the URR probability tables can multiply the reaction cross section by (i.e., the largest
+ * domain value of the probability tables at all energies). Returns 1 if *this* has no URR probability tables.
+ *
+ * @return                              The largest URR cross section factor.
+ ***********************************************************************************************************/
+
+HOST double HeatedReactionCrossSectionContinuousEnergy::URR_maximumFactor( ) const {
+
+    if( m_URR_probabilityTables == nullptr ) return( 1.0 );
+    if( m_URR_probabilityTables->type( ) != ProbabilityBase2dType::XYs )
+        THROW( "HeatedReactionCrossSectionContinuousEnergy::URR_maximumFactor: unsupported URR probability tables form." );
+
+    Probabilities::XYs2d const *URR_probabilityTables = static_cast<Probabilities::XYs2d const *>( m_URR_probabilityTables );
+    Vector<Probabilities::ProbabilityBase1d *> const &probabilities = URR_probabilityTables->probabilities( );
+    double maximumFactor = 1.0;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < probabilities.size( ); ++i1 ) {
+        if( probabilities[i1]->domainMax( ) > maximumFactor ) maximumFactor = probabilities[i1]->domainMax( );
+    }
+
+    return( maximumFactor );
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
  *
  * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
  * @param a_mode                [in]    Specifies the action of this method.
+ * @param a_heatedCrossSections [in]    The heated cross sections of all temperatures. Only needed when unpacking or interning shared data.
+ * @param a_reactionIndex       [in]    The index of *this* in its HeatedCrossSectionContinuousEnergy. Only needed when unpacking or interning shared data.
  ***********************************************************************************************************/
 
-HOST_DEVICE void HeatedReactionCrossSectionContinuousEnergy::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+HOST_DEVICE void HeatedReactionCrossSectionContinuousEnergy::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode, 
+                HeatedCrossSectionContinuousEnergy * const *a_heatedCrossSections, int a_reactionIndex ) {
 
     DATA_MEMBER_INT( m_offset, a_buffer, a_mode );
     DATA_MEMBER_FLOAT(  m_threshold, a_buffer, a_mode  );
-    DATA_MEMBER_VECTOR_DOUBLE( m_crossSection, a_buffer, a_mode );
+    DATA_MEMBER_INT( m_crossSectionSource, a_buffer, a_mode );
+    if( m_crossSectionSource < 0 ) {
+        DATA_MEMBER_VECTOR_DOUBLE( m_crossSection, a_buffer, a_mode ); }
+    else {                                  // When interning, the source may have been replaced by an interned copy so *this* shares again.
+        if( ( a_mode == DataBuffer::Mode::Unpack ) || ( a_mode == DataBuffer::Mode::Intern ) )
+            m_crossSection.share( a_heatedCrossSections[m_crossSectionSource]->reactionCrossSection( a_reactionIndex )->crossSections( ) );
+        if( a_mode == DataBuffer::Mode::Memory ) a_buffer.m_sharedPlacementSize += sizeof( MCGIDI_StorageType ) * m_crossSection.capacity( );
+    }
     m_URR_probabilityTables = serializeProbability2d( a_buffer, a_mode, m_URR_probabilityTables );
 }
 
+/* *********************************************************************************************************//**
+ * If the cross section of *a_other* is identical to that of *this*, *this* frees its cross section data and shares the data 
+ * of *a_other*. Only data owned by both *this* and *a_other* are considered.
+ *
+ * @param a_other               [in]    The reaction cross section at another temperature.
+ * @param a_source              [in]    The index of the temperature of *a_other*.
+ *
+ * @return                              *true* if the data are now shared and *false* otherwise.
+ ***********************************************************************************************************/
+
+HOST bool HeatedReactionCrossSectionContinuousEnergy::shareCrossSection( HeatedReactionCrossSectionContinuousEnergy const &a_other, int a_source ) {
+
+    if( ( m_crossSectionSource >= 0 ) || ( a_other.m_crossSectionSource >= 0 ) ) return( false );
+    if( ( m_offset != a_other.m_offset ) || ( m_crossSection.size( ) != a_other.m_crossSection.size( ) ) ) return( false );
+    if( m_crossSection.size( ) == 0 ) return( false );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_crossSection.size( ); ++i1 ) {
+        if( m_crossSection[i1] != a_other.m_crossSection[i1] ) return( false );
+    }
+
+    m_crossSection.share( a_other.m_crossSection );
+    m_crossSectionSource = a_source;
+
+    return( true );
+}
+
+/* *********************************************************************************************************//**
+ * Removes the cross section values at the energy points that were removed by HeatedCrossSectionContinuousEnergy::thinEnergyGrid.
+ * The energy point at **m_offset** is never removed.
+ *
+ * @param a_newIndices          [in]    For each energy index of the original grid, its index in the thinned grid or -1 if removed.
+ ***********************************************************************************************************/
+
+HOST void HeatedReactionCrossSectionContinuousEnergy::thin( std::vector<int> const &a_newIndices ) {
+
+    thinStorageVector( m_crossSection, m_offset, a_newIndices );
+    m_offset = a_newIndices[m_offset];
+}
+
 /*
 ============================================================
 =================== ContinuousEnergyGain ===================
@@ -106,7 +210,7 @@ ContinuousEnergyGain::ContinuousEnergyGain( ) :
 ContinuousEnergyGain::ContinuousEnergyGain( int a_particleIndex, std::size_t a_size ) :
         m_particleIndex( a_particleIndex ),
         m_userParticleIndex( -1 ),
-        m_gain( a_size, 0.0 ) {
+        m_gain( static_cast<MCGIDI_VectorSizeType>( a_size ), 0.0f ) {
 
 }
 
@@ -145,12 +249,24 @@ HOST_DEVICE void ContinuousEnergyGain::serialize( DataBuffer &a_buffer, DataBuff
     DATA_MEMBER_VECTOR_DOUBLE( m_gain, a_buffer, a_mode );
 }
 
+/* *********************************************************************************************************//**
+ * Removes the gain values at the energy points that were removed by HeatedCrossSectionContinuousEnergy::thinEnergyGrid.
+ *
+ * @param a_newIndices          [in]    For each energy index of the original grid, its index in the thinned grid or -1 if removed.
+ ***********************************************************************************************************/
+
+HOST void ContinuousEnergyGain::thin( std::vector<int> const &a_newIndices ) {
+
+    thinStorageVector( m_gain, 0, a_newIndices );
+}
+
 /*
 ============================================================
 =========== HeatedCrossSectionContinuousEnergy =============
 ============================================================
 */
 HOST_DEVICE HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( ) :
+        m_energyGridSource( -1 ),
         m_hashIndices( ),
         m_energies( ),
         m_totalCrossSection( ),
@@ -159,7 +275,12 @@ HOST_DEVICE HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEner
         m_productionEnergy( ),
         m_gains( ),
         m_reactionsInURR_region( ),
-        m_reactionCrossSections( ) {
+        m_URR_bandTables( ),
+        m_reactionCrossSections( ),
+        m_packedReactionCrossSections( ),
+        m_cumulativeReactionCrossSections( ),
+        m_logEnergyMin( 0.0 ),
+        m_inverseLethargyStep( 0.0 ) {
 
 }
 
@@ -179,6 +300,7 @@ HOST_DEVICE HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEner
 HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( SetupInfo &a_setupInfo, Transporting::MC const &a_settings, 
                 GIDI::Transporting::Particles const &a_particles, DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfo const &a_temperatureInfo, 
                 std::vector<GIDI::Reaction const *> const &a_reactions, std::vector<GIDI::Reaction const *> const &a_orphanProducts, bool a_fixedGrid ) :
+        m_energyGridSource( -1 ),
         m_hashIndices( ),
         m_energies( ),
         m_totalCrossSection( ),
@@ -187,7 +309,12 @@ HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( Set
         m_productionEnergy( ),
         m_gains( ),
         m_reactionsInURR_region( ),
-        m_reactionCrossSections( ) {
+        m_URR_bandTables( ),
+        m_reactionCrossSections( ),
+        m_packedReactionCrossSections( ),
+        m_cumulativeReactionCrossSections( ),
+        m_logEnergyMin( 0.0 ),
+        m_inverseLethargyStep( 0.0 ) {
 
     std::string label( a_temperatureInfo.griddedCrossSection( ) );
     std::string URR_label( a_temperatureInfo.URR_probabilityTables( ) );
@@ -201,9 +328,14 @@ HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( Set
     std::vector<int> fixedGridIndices( fixedGridPoints.size( ) );
     if( a_fixedGrid ) {
         for( int i1 = 0; i1 < static_cast<int>( fixedGridPoints.size( ) ); ++i1 ) {
-            fixedGridIndices[i1] = static_cast<int>( binarySearchVector( fixedGridPoints[i1], energies ) );
+            fixedGridIndices[i1] = static_cast<int>( binarySearchVector( fixedGridPoints[i1], energies, true ) );
+            if( fixedGridIndices[i1] == static_cast<int>( energies.size( ) ) - 1 ) --fixedGridIndices[i1];
         }
-        m_energies = fixedGridPoints; }
+        m_energies = fixedGridPoints;
+        if( a_settings.fixedGridEqualLethargy( ) ) {
+            m_logEnergyMin = log( m_energies[0] );
+            m_inverseLethargyStep = ( m_energies.size( ) - 1 ) / ( log( m_energies.back( ) ) - m_logEnergyMin );
+        } }
     else {
         m_energies = energies;
     }
@@ -229,22 +361,7 @@ HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( Set
         }
 
         if( a_fixedGrid ) {
-            GIDI::Functions::Ys1d *reactionCrossSection4 = &fixedGridCrossSection;
-
-            int start = 0;
-
-            if( energies[reactionCrossSection3->start( )] > fixedGridPoints[0] ) {
-                start = static_cast<MCGIDI_VectorSizeType>( binarySearchVector( energies[reactionCrossSection3->start( )], fixedGridPoints ) ) + 1;
-            }
-
-            for( int i1 = 0; i1 < start; ++i1 ) reactionCrossSection4->set( i1, 0.0 );
-            for( int i1 = start; i1 < static_cast<int>( fixedGridPoints.size( ) ); ++i1 ) {
-                int index = fixedGridIndices[i1];
-                double fraction = ( fixedGridPoints[i1] - energies[index] ) / ( energies[index+1] - energies[index] );
-
-                index -= reactionCrossSection3->start( );
-                reactionCrossSection4->set( i1, ( 1.0 - fraction ) * (*reactionCrossSection3)[index] + fraction * (*reactionCrossSection3)[index+1] );
-            }
+            mapCrossSectionToFixedGrid( energies, fixedGridPoints, fixedGridIndices, *reactionCrossSection3, fixedGridCrossSection );
             reactionCrossSection3 = &fixedGridCrossSection;
         }
         m_reactionCrossSections[reactionIndex] = new HeatedReactionCrossSectionContinuousEnergy( (*reactionIter)->crossSectionThreshold( ), *reactionCrossSection3, URR_probabilityTables );
@@ -262,6 +379,8 @@ HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( Set
 
         m_reactionsInURR_region.resize( reactions_in_URR_region.size( ) );
         for( std::size_t i1 = 0; i1 < reactions_in_URR_region.size( ); ++i1 ) m_reactionsInURR_region[i1] = reactions_in_URR_region[i1];
+
+        m_URR_bandTables.setup( m_reactionCrossSections );
     }
 
     m_depositionEnergy.resize( totalCrossSection.length( ), 0.0 );
@@ -304,6 +423,11 @@ HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( Set
             GIDI::Suite const &reactionCrossSectionSuite = reaction->crossSection( );
             reactionCrossSection = reactionCrossSectionSuite.get<GIDI::Functions::Ys1d>( label );
             offset = reactionCrossSection->start( );
+            if( a_fixedGrid ) {
+                mapCrossSectionToFixedGrid( energies, fixedGridPoints, fixedGridIndices, *reactionCrossSection, fixedGridCrossSection );
+                reactionCrossSection = &fixedGridCrossSection;
+                offset = 0;
+            }
         }
 
         for( int energy_index = offset; energy_index < m_energies.size( ); ++energy_index ) {
@@ -353,6 +477,156 @@ HOST HeatedCrossSectionContinuousEnergy::HeatedCrossSectionContinuousEnergy( Set
             }
         }
     }
+
+    if( !a_fixedGrid && ( a_settings.gridThinningTolerance( ) > 0.0 ) ) thinEnergyGrid( a_domainHash, a_settings.gridThinningTolerance( ) );
+
+    if( a_settings.wantCumulativeReactionCrossSections( ) && ( numberOfReactions( ) > 0 ) ) {
+        int number_of_reactions = numberOfReactions( );
+        MCGIDI_VectorSizeType number_of_energies = m_energies.size( );
+
+        m_cumulativeReactionCrossSections.resize( number_of_energies * number_of_reactions, 0.0 );
+        for( MCGIDI_VectorSizeType energy_index = 0; energy_index < number_of_energies; ++energy_index ) {
+            double *cumulative_cross_sections = &m_cumulativeReactionCrossSections[energy_index * number_of_reactions];
+            double cumulative_cross_section = 0.0;
+
+            for( int reaction_index = 0; reaction_index < number_of_reactions; ++reaction_index ) {
+                cumulative_cross_section += m_reactionCrossSections[reaction_index]->crossSection( energy_index );
+                cumulative_cross_sections[reaction_index] = cumulative_cross_section;
+            }
+        }
+    }
+
+    if( a_settings.wantPackedReactionCrossSections( ) && ( numberOfReactions( ) > 0 ) ) {
+        int number_of_reactions = numberOfReactions( );
+        MCGIDI_VectorSizeType number_of_energies = m_energies.size( );
+
+        m_packedReactionCrossSections.resize( number_of_energies * number_of_reactions, 0.0 );
+        for( int reaction_index = 0; reaction_index < number_of_reactions; ++reaction_index ) {
+            HeatedReactionCrossSectionContinuousEnergy *reaction_cross_section = m_reactionCrossSections[reaction_index];
+
+            for( MCGIDI_VectorSizeType energy_index = reaction_cross_section->offset( ); energy_index < number_of_energies; ++energy_index ) {
+                m_packedReactionCrossSections[energy_index * number_of_reactions + reaction_index] = reaction_cross_section->crossSection( energy_index );
+            }
+            reaction_cross_section->releaseCrossSection( );
+        }
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Removes energy points from **m_energies** where all continuous energy data are reproduced by lin-lin interpolation between the
+ * remaining points to within the relative tolerance *a_tolerance* (i.e., |y - y_interpolated| <= a_tolerance * ( |y| + |y_interpolated| ) / 2, 
+ * as in ptwXY_thin). The data checked are the total and each reaction cross section, the deposition-energy, deposition-momentum and 
+ * production-energy cross sections and all gains. Each data set is first thinned by ptwXY_thin to half of *a_tolerance* and the union of 
+ * the kept points is used as a starting grid. Since interpolating on the union can still exceed *a_tolerance*, every removed point is 
+ * then checked for all data and the worst failing point of an interval is added back until all intervals pass. The first and last points, 
+ * and the threshold point of each reaction and the point below it are always kept.
+ *
+ * @param a_domainHash              [in]    The hash data used when looking up a cross section.
+ * @param a_tolerance               [in]    The relative tolerance.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionContinuousEnergy::thinEnergyGrid( DomainHash const &a_domainHash, double a_tolerance ) {
+
+    int number_of_energies = static_cast<int>( m_energies.size( ) );
+
+    if( number_of_energies < 3 ) return;
+
+    std::vector<double> energies( m_energies.begin( ), m_energies.end( ) );
+    std::vector< std::vector<double> > curves;
+
+    curves.push_back( std::vector<double>( m_totalCrossSection.begin( ), m_totalCrossSection.end( ) ) );
+    curves.push_back( std::vector<double>( m_depositionEnergy.begin( ), m_depositionEnergy.end( ) ) );
+    curves.push_back( std::vector<double>( m_depositionMomentum.begin( ), m_depositionMomentum.end( ) ) );
+    curves.push_back( std::vector<double>( m_productionEnergy.begin( ), m_productionEnergy.end( ) ) );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_gains.size( ); ++i1 ) {
+        curves.push_back( std::vector<double>( m_gains[i1].gain( ).begin( ), m_gains[i1].gain( ).end( ) ) );
+    }
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionCrossSections.size( ); ++i1 ) {
+        std::vector<double> curve( number_of_energies );
+
+        for( int energy_index = 0; energy_index < number_of_energies; ++energy_index ) curve[energy_index] = m_reactionCrossSections[i1]->crossSection( energy_index );
+        curves.push_back( curve );
+    }
+    for( std::size_t i1 = 0; i1 < curves.size( ); ++i1 ) curves[i1].resize( number_of_energies, 0.0 );
+
+    std::vector<bool> keep( number_of_energies, false );
+    keep[0] = true;
+    keep[number_of_energies-1] = true;
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionCrossSections.size( ); ++i1 ) {
+        int offset = m_reactionCrossSections[i1]->offset( );
+
+        keep[offset] = true;
+        if( offset > 0 ) keep[offset-1] = true;
+    }
+
+    for( std::size_t i1 = 0; i1 < curves.size( ); ++i1 ) {
+        ptwXYPoints *ptwXY = ptwXY_createFrom_Xs_Ys( nullptr, ptwXY_interpolationLinLin, nullptr, 12, 0.5 * a_tolerance, number_of_energies, 10, 
+                number_of_energies, energies.data( ), curves[i1].data( ), 0 );
+        if( ptwXY == nullptr ) THROW( "HeatedCrossSectionContinuousEnergy::thinEnergyGrid: ptwXY_createFrom_Xs_Ys returned nullptr." );
+
+        ptwXYPoints *thinned = ptwXY_thin( nullptr, ptwXY, 0.5 * a_tolerance );
+        ptwXY_free( ptwXY );
+        if( thinned == nullptr ) THROW( "HeatedCrossSectionContinuousEnergy::thinEnergyGrid: ptwXY_thin returned nullptr." );
+
+        int energy_index = 0;
+        for( int64_t i2 = 0; i2 < ptwXY_length( nullptr, thinned ); ++i2 ) {
+            double energy = ptwXY_getPointAtIndex_Unsafely( thinned, i2 )->x;
+
+            while( ( energy_index < number_of_energies - 1 ) && ( energies[energy_index] < energy ) ) ++energy_index;
+            keep[energy_index] = true;
+        }
+        ptwXY_free( thinned );
+    }
+
+    int lower = 0;
+    while( lower < number_of_energies - 1 ) {
+        int upper = lower + 1;
+        while( !keep[upper] ) ++upper;
+
+        int worst = -1;
+        double worst_ratio = 1.0;
+        for( std::size_t i1 = 0; i1 < curves.size( ); ++i1 ) {
+            std::vector<double> const &curve = curves[i1];
+            double slope = ( curve[upper] - curve[lower] ) / ( energies[upper] - energies[lower] );
+
+            for( int energy_index = lower + 1; energy_index < upper; ++energy_index ) {
+                double y = curve[lower] + slope * ( energies[energy_index] - energies[lower] );
+                double difference = fabs( y - curve[energy_index] );
+
+                if( difference == 0.0 ) continue;
+                double ratio = difference / ( 0.5 * a_tolerance * ( fabs( y ) + fabs( curve[energy_index] ) ) );
+                if( ratio > worst_ratio ) {
+                    worst_ratio = ratio;
+                    worst = energy_index;
+                }
+            }
+        }
+
+        if( worst < 0 ) {
+            lower = upper; }
+        else {
+            keep[worst] = true;
+        }
+    }
+
+    std::vector<int> new_indices( number_of_energies, -1 );
+    std::vector<double> thinned_energies;
+    for( int energy_index = 0; energy_index < number_of_energies; ++energy_index ) {
+        if( keep[energy_index] ) {
+            new_indices[energy_index] = static_cast<int>( thinned_energies.size( ) );
+            thinned_energies.push_back( energies[energy_index] );
+        }
+    }
+    if( static_cast<int>( thinned_energies.size( ) ) == number_of_energies ) return;
+
+    m_energies = thinned_energies;
+    m_hashIndices = a_domainHash.map( m_energies );
+    thinStorageVector( m_totalCrossSection, 0, new_indices );
+    thinStorageVector( m_depositionEnergy, 0, new_indices );
+    thinStorageVector( m_depositionMomentum, 0, new_indices );
+    thinStorageVector( m_productionEnergy, 0, new_indices );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_gains.size( ); ++i1 ) m_gains[i1].thin( new_indices );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionCrossSections.size( ); ++i1 ) m_reactionCrossSections[i1]->thin( new_indices );
 }
 
 /* *********************************************************************************************************//**
@@ -375,6 +649,19 @@ HOST_DEVICE int HeatedCrossSectionContinuousEnergy::evaluationInfo( int a_hashIn
         return( (int) ( m_energies.size( ) - 2 ) );
     }
 
+    if( m_inverseLethargyStep > 0.0 ) {                 // Equal-lethargy fixed grid so index is computed directly.
+        int index = static_cast<int>( m_inverseLethargyStep * ( log( a_energy ) - m_logEnergyMin ) );
+
+        if( index > static_cast<int>( m_energies.size( ) ) - 2 ) index = static_cast<int>( m_energies.size( ) ) - 2;
+        if( a_energy < m_energies[index] ) {            // Correct for round-off.
+            --index; }
+        else if( a_energy > m_energies[index+1] ) {
+            ++index;
+        }
+        *a_energyFraction = ( m_energies[index+1] - a_energy ) / ( m_energies[index+1] - m_energies[index] );
+        return( index );
+    }
+
     int index1 = m_hashIndices[a_hashIndex];
 
 #ifdef MCGIDI_CrossSectionLinearSubSearch
@@ -403,6 +690,206 @@ HOST_DEVICE int HeatedCrossSectionContinuousEnergy::evaluationInfo( int a_hashIn
     *a_energyFraction = ( m_energies[index1+1] - a_energy ) / ( m_energies[index1+1] - m_energies[index1] );
     return( index1 );
 }
+
+/* *********************************************************************************************************//**
+ * Same as **evaluationInfo** but the lower index of the energy interval containing *a_energy* has already been
+ * determined (e.g., by a UnionizedGrid). This method only handles the end points and computes the energy fraction.
+ *
+ * @param a_energyIndex         [in]    The lower index of *m_energies* that bounds *a_energy*.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_energyFraction      [out]   The fraction of the lower point.
+ *
+ * @return                              The lower energy index.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int HeatedCrossSectionContinuousEnergy::evaluationInfoAtIndex( int a_energyIndex, double a_energy, double *a_energyFraction ) const {
+
+    *a_energyFraction = 1.0;
+
+    if( a_energy <= m_energies[0] ) return( 0 );
+    if( a_energy >= m_energies.back( ) ) {
+        *a_energyFraction = 0.0;
+        return( (int) ( m_energies.size( ) - 2 ) );
+    }
+
+    *a_energyFraction = ( m_energies[a_energyIndex+1] - a_energy ) / ( m_energies[a_energyIndex+1] - m_energies[a_energyIndex] );
+    return( a_energyIndex );
+}
+
+/* *********************************************************************************************************//**
+ * Same as **evaluationInfo** but first tries the energy index stored in slot *a_slot* of *a_energyIndexHint* and a few of its neighbors
+ * before using the hash. The found index is stored in *a_energyIndexHint*. If *a_energyIndexHint* is *nullptr*, this is
+ * the same as **evaluationInfo**.
+ *
+ * @param a_hashIndex           [in]    The cross section hash index.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_energyFraction      [out]   The fraction of the lower point.
+ * @param a_energyIndexHint     [in]    The particle's last energy indices or *nullptr*.
+ * @param a_slot                [in]    The slot of *a_energyIndexHint* to use (0 for the lower temperature and 1 for the upper).
+ *
+ * @return                              The lower energy index.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int HeatedCrossSectionContinuousEnergy::evaluationInfo( int a_hashIndex, double a_energy, double *a_energyFraction, 
+                EnergyIndexHint *a_energyIndexHint, int a_slot ) const {
+
+    if( ( a_energyIndexHint == nullptr ) || ( m_inverseLethargyStep > 0.0 ) ) return( evaluationInfo( a_hashIndex, a_energy, a_energyFraction ) );
+
+    *a_energyFraction = 1.0;
+
+    if( a_energy <= m_energies[0] ) return( 0 );
+    if( a_energy >= m_energies.back( ) ) {
+        *a_energyFraction = 0.0;
+        return( (int) ( m_energies.size( ) - 2 ) );
+    }
+
+    int energy_index = a_energyIndexHint->find( m_energies, a_energy, a_slot );
+
+    if( energy_index < 0 ) {
+        energy_index = evaluationInfo( a_hashIndex, a_energy, a_energyFraction );
+        a_energyIndexHint->set( a_slot, energy_index );
+        return( energy_index );
+    }
+
+    *a_energyFraction = ( m_energies[energy_index+1] - a_energy ) / ( m_energies[energy_index+1] - m_energies[energy_index] );
+    return( energy_index );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the cross section at energy index *a_energyIndex* for reaction *a_reactionIndex*. If *a_reactionIndex* is
+ * negative, the total cross section is returned. The packed table is used when present.
+ *
+ * @param a_reactionIndex       [in]    The index of the reaction or -1 for the total cross section.
+ * @param a_energyIndex         [in]    The index of the energy in *m_energies*.
+ *
+ * @return                              The cross section at the energy point.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionContinuousEnergy::crossSectionAtIndex( int a_reactionIndex, int a_energyIndex ) const {
+
+    if( a_reactionIndex < 0 ) return( m_totalCrossSection[a_energyIndex] );
+    if( m_packedReactionCrossSections.size( ) > 0 ) return( m_packedReactionCrossSections[a_energyIndex * numberOfReactions( ) + a_reactionIndex] );
+    return( m_reactionCrossSections[a_reactionIndex]->crossSection( a_energyIndex ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the cross section for reaction *a_reactionIndex* (or the total cross section if *a_reactionIndex* is negative)
+ * Doppler broadened from this temperature by a free gas target. The broadening kernel is
+ *
+ *      sigma(E) = sqrt( alpha / pi ) / y^2 * Integral dx sigma_0( x^2 ) x^2 [ exp( -alpha ( y - x )^2 ) - exp( -alpha ( y + x )^2 ) ]
+ *
+ * where y = sqrt( E ), x = sqrt( E' ) and alpha = A / ( T - T_0 ). The integral is evaluated with the trapezoid rule over
+ * the union of the points of *m_energies* and a uniform sub-division of the integration range which extends
+ * **MCGIDI_DopplerBroadeningWidth** widths of the kernel on each side of y. Below the first energy point the cross section
+ * is extrapolated as 1/v and above the last energy point it is held constant.
+ *
+ * @param a_reactionIndex       [in]    The index of the reaction or -1 for the total cross section.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_alpha               [in]    The target to projectile mass ratio divided by the temperature increment.
+ *
+ * @return                              The Doppler broadened cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionContinuousEnergy::dopplerBroadenedCrossSection( int a_reactionIndex, double a_energy, double a_alpha ) const {
+
+    double cross_section;
+
+    dopplerBroadenedCrossSections( a_reactionIndex, 1, a_energy, a_alpha, &cross_section );
+    return( cross_section );
+}
+
+/* *********************************************************************************************************//**
+ * Sets *a_crossSections* to the Doppler broadened cross sections of the *a_numberOfReactions* reactions starting at index *a_reactionIndex*
+ * (or to the total cross section if *a_reactionIndex* is -1 and *a_numberOfReactions* is 1). The broadening is the same as in 
+ * **dopplerBroadenedCrossSection** but the integration points and kernel values are computed once for all reactions.
+ * *a_numberOfReactions* must not be greater than **MCGIDI_DopplerBroadeningReactionChunkSize**.
+ *
+ * @param a_reactionIndex       [in]    The index of the first reaction or -1 for the total cross section.
+ * @param a_numberOfReactions   [in]    The number of reactions.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_alpha               [in]    The target to projectile mass ratio divided by the temperature increment.
+ * @param a_crossSections       [out]   The *a_numberOfReactions* Doppler broadened cross sections.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void HeatedCrossSectionContinuousEnergy::dopplerBroadenedCrossSections( int a_reactionIndex, int a_numberOfReactions, double a_energy, 
+                double a_alpha, double *a_crossSections ) const {
+
+    if( a_numberOfReactions > MCGIDI_DopplerBroadeningReactionChunkSize ) 
+        THROW( "HeatedCrossSectionContinuousEnergy::dopplerBroadenedCrossSections: too many reactions." );
+
+    int number_of_energies = static_cast<int>( m_energies.size( ) );
+    double y = sqrt( a_energy ), width = MCGIDI_DopplerBroadeningWidth / sqrt( a_alpha );
+    double x_min = y - width, x_max = y + width;
+
+    if( x_min < 0.0 ) x_min = 0.0;
+
+    double dx = ( x_max - x_min ) / MCGIDI_DopplerBroadeningIntervals;
+    int energy_index = 0, grid_index = 0, uniform_index = 1;
+
+    if( x_min * x_min >= m_energies[0] ) {
+        energy_index = static_cast<int>( binarySearchVector( x_min * x_min, m_energies, true ) );
+        if( energy_index > number_of_energies - 2 ) energy_index = number_of_energies - 2;
+        grid_index = energy_index + 1;
+    }
+
+    double x1 = x_min, x2 = x_min, f1s[MCGIDI_DopplerBroadeningReactionChunkSize];
+
+    for( int i1 = 0; i1 < a_numberOfReactions; ++i1 ) {
+        a_crossSections[i1] = 0.0;
+        f1s[i1] = 0.0;
+    }
+
+    for( bool first = true; ; first = false ) {
+        double energy = x2 * x2, kernel = energy * ( exp( -a_alpha * ( y - x2 ) * ( y - x2 ) ) - exp( -a_alpha * ( y + x2 ) * ( y + x2 ) ) );
+        double half_step = first ? 0.0 : 0.5 * ( x2 - x1 );
+        int index1 = 0, index2 = 0;
+        double weight1 = 0.0, weight2 = 0.0;
+
+        if( energy <= m_energies[0] ) {
+            if( energy > 0.0 ) weight1 = sqrt( m_energies[0] / energy ); }
+        else if( energy >= m_energies[number_of_energies-1] ) {
+            index1 = number_of_energies - 1;
+            weight1 = 1.0; }
+        else {
+            while( ( energy_index < number_of_energies - 2 ) && ( m_energies[energy_index+1] < energy ) ) ++energy_index;
+
+            double fraction = ( energy - m_energies[energy_index] ) / ( m_energies[energy_index+1] - m_energies[energy_index] );
+            index1 = energy_index;
+            index2 = energy_index + 1;
+            weight1 = 1.0 - fraction;
+            weight2 = fraction;
+        }
+
+        for( int i1 = 0; i1 < a_numberOfReactions; ++i1 ) {
+            int reaction_index = a_reactionIndex + i1;
+            double cross_section = weight1 * crossSectionAtIndex( reaction_index, index1 );
+
+            if( weight2 != 0.0 ) cross_section += weight2 * crossSectionAtIndex( reaction_index, index2 );
+
+            double f2 = cross_section * kernel;
+            a_crossSections[i1] += half_step * ( f1s[i1] + f2 );
+            f1s[i1] = f2;
+        }
+        x1 = x2;
+        if( x2 >= x_max ) break;
+
+        double x_uniform = x_max, x_grid = x_max;
+        if( uniform_index < MCGIDI_DopplerBroadeningIntervals ) x_uniform = x_min + uniform_index * dx;
+        if( grid_index < number_of_energies ) x_grid = sqrt( m_energies[grid_index] );
+
+        if( x_grid < x_uniform ) {
+            x2 = x_grid;
+            ++grid_index; }
+        else {
+            x2 = x_uniform;
+            ++uniform_index;
+            if( x_grid == x_uniform ) ++grid_index;
+        }
+    }
+
+    double factor = sqrt( a_alpha / M_PI ) / a_energy;
+    for( int i1 = 0; i1 < a_numberOfReactions; ++i1 ) a_crossSections[i1] *= factor;
+}
 /*
 =========================================================
 */
@@ -450,21 +937,41 @@ HOST_DEVICE double HeatedCrossSectionContinuousEnergy::crossSection( URR_protare
     double energy_fraction;
     int energy_index = evaluationInfo( a_hashIndex, a_energy, &energy_fraction );
 
+    return( crossSection2( a_URR_protareInfos, a_URR_index, a_energy, energy_index, energy_fraction, a_sampling ) );
+}
+/*
+=========================================================
+*/
+HOST_DEVICE double HeatedCrossSectionContinuousEnergy::crossSection2( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_energy, 
+                int a_energyIndex, double a_energyFraction, bool a_sampling ) const {
+
     if( a_URR_index >= 0 ) {
         URR_protareInfo const &URR_protare_info = a_URR_protareInfos[a_URR_index];
 
         if( URR_protare_info.m_inURR ) {
             double cross_section = 0.0;
 
-            for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionsInURR_region.size( ); ++i1 ) {
-                cross_section += reactionCrossSection2( m_reactionsInURR_region[i1], a_URR_protareInfos, a_URR_index, a_energy, energy_index, energy_fraction, false );
+            if( m_URR_bandTables.active( ) ) {          // The URR energy interval is looked up once for all reactions.
+                double URR_energyFraction;
+                int URR_energyIndex = m_URR_bandTables.energyIndex( a_energy, &URR_energyFraction );
+
+                for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionsInURR_region.size( ); ++i1 ) {
+                    int reactionIndex = m_reactionsInURR_region[i1];
+
+                    cross_section += m_URR_bandTables.factor( reactionIndex, URR_energyIndex, URR_energyFraction, URR_protare_info.m_rng_Value )
+                            * smoothReactionCrossSection( reactionIndex, a_energyIndex, a_energyFraction );
+                } }
+            else {
+                for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionsInURR_region.size( ); ++i1 ) {
+                    cross_section += reactionCrossSection2( m_reactionsInURR_region[i1], a_URR_protareInfos, a_URR_index, a_energy, a_energyIndex, a_energyFraction, false );
+                }
             }
 
             return( cross_section );
         }
     }
 
-    return( energy_fraction * m_totalCrossSection[energy_index] + ( 1.0 - energy_fraction ) * m_totalCrossSection[energy_index+1] );
+    return( a_energyFraction * m_totalCrossSection[a_energyIndex] + ( 1.0 - a_energyFraction ) * m_totalCrossSection[a_energyIndex+1] );
 }
 /*
 =========================================================
@@ -482,18 +989,85 @@ HOST_DEVICE double HeatedCrossSectionContinuousEnergy::reactionCrossSection( int
 HOST_DEVICE double HeatedCrossSectionContinuousEnergy::reactionCrossSection2( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, 
         double a_energy, int a_energyIndex, double a_energyFraction, bool a_sampling ) const {
 
-    HeatedReactionCrossSectionContinuousEnergy const &reaction = *m_reactionCrossSections[a_reactionIndex];
     double URR_cross_section_factor = 1.0;
 
     if( a_URR_index >= 0 ) {
         URR_protareInfo const &URR_protare_info = a_URR_protareInfos[a_URR_index];
 
         if( URR_protare_info.m_inURR ) {
-            if( reaction.URR_probabilityTables( ) != nullptr ) URR_cross_section_factor = reaction.URR_probabilityTables( )->sample( a_energy, URR_protare_info.m_rng_Value, nullptr, nullptr );
+            if( m_URR_bandTables.active( ) ) {
+                URR_cross_section_factor = m_URR_bandTables.factor( a_reactionIndex, a_energy, URR_protare_info.m_rng_Value ); }
+            else {
+                HeatedReactionCrossSectionContinuousEnergy const &reaction = *m_reactionCrossSections[a_reactionIndex];
+
+                if( reaction.URR_probabilityTables( ) != nullptr ) URR_cross_section_factor = reaction.URR_probabilityTables( )->sample( a_energy, URR_protare_info.m_rng_Value, nullptr, nullptr );
+            }
         }
     }
 
-    return( URR_cross_section_factor * ( a_energyFraction * reaction.crossSection( a_energyIndex ) + ( 1.0 - a_energyFraction ) * reaction.crossSection( a_energyIndex+1 ) ) );
+    return( URR_cross_section_factor * smoothReactionCrossSection( a_reactionIndex, a_energyIndex, a_energyFraction ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the cross section for reaction *a_reactionIndex* without any URR probability table factor.
+ *
+ * @param a_reactionIndex           [in]    The index of the reaction.
+ * @param a_energyIndex             [in]    The lower index of the energy interval.
+ * @param a_energyFraction          [in]    The weight of the cross section at *a_energyIndex*.
+ *
+ * @return                                  The reaction's cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionContinuousEnergy::smoothReactionCrossSection( int a_reactionIndex, int a_energyIndex, double a_energyFraction ) const {
+
+    if( m_packedReactionCrossSections.size( ) > 0 ) {
+        int number_of_reactions = numberOfReactions( );
+        MCGIDI_StorageType const *cross_sections = &m_packedReactionCrossSections[a_energyIndex * number_of_reactions + a_reactionIndex];
+
+        return( a_energyFraction * cross_sections[0] + ( 1.0 - a_energyFraction ) * cross_sections[number_of_reactions] );
+    }
+
+    HeatedReactionCrossSectionContinuousEnergy const &reaction = *m_reactionCrossSections[a_reactionIndex];
+
+    return( a_energyFraction * reaction.crossSection( a_energyIndex ) + ( 1.0 - a_energyFraction ) * reaction.crossSection( a_energyIndex+1 ) );
+}
+
+/* *********************************************************************************************************//**
+ * Adds the cross sections of all reactions at energy indices *a_energyBegin* up to but not including *a_energyEnd*, multiplied by
+ * *a_factor*, to *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at
+ * *a_reactionCrossSectionVectors* + *reactionIndex* * *a_numberAllocated*.
+ *
+ * @param   a_factor                        [in]        The factor all cross sections are multiplied by.
+ * @param   a_energyBegin                   [in]        The first energy index to add.
+ * @param   a_energyEnd                     [in]        One past the last energy index to add.
+ * @param   a_numberAllocated               [in]        The length of each reaction's vector.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The reaction cross section vectors to add cross section data to.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionContinuousEnergy::addReactionCrossSectionVectors( double a_factor, int a_energyBegin, int a_energyEnd, int a_numberAllocated, 
+                double *a_reactionCrossSectionVectors ) const {
+
+    int number_of_reactions = numberOfReactions( );
+
+    if( m_packedReactionCrossSections.size( ) > 0 ) {
+        for( int energy_index = a_energyBegin; energy_index < a_energyEnd; ++energy_index ) {
+            MCGIDI_StorageType const *cross_sections = &m_packedReactionCrossSections[energy_index * number_of_reactions];
+
+            for( int reaction_index = 0; reaction_index < number_of_reactions; ++reaction_index )
+                a_reactionCrossSectionVectors[reaction_index * a_numberAllocated + energy_index] += a_factor * cross_sections[reaction_index];
+        } }
+    else {
+        for( int reaction_index = 0; reaction_index < number_of_reactions; ++reaction_index ) {
+            HeatedReactionCrossSectionContinuousEnergy const &reaction = *m_reactionCrossSections[reaction_index];
+            Vector<MCGIDI_StorageType> const &cross_sections = reaction.crossSections( );
+            double *vector = &a_reactionCrossSectionVectors[reaction_index * a_numberAllocated];
+            int offset = reaction.offset( );
+            int begin = std::max( a_energyBegin, offset );
+            int end = std::min( a_energyEnd, offset + static_cast<int>( cross_sections.size( ) ) );
+
+            for( int energy_index = begin; energy_index < end; ++energy_index ) vector[energy_index] += a_factor * cross_sections[energy_index - offset];
+        }
+    }
 }
 
 /*
@@ -601,23 +1175,69 @@ HOST void HeatedCrossSectionContinuousEnergy::setUserParticleIndex( int a_partic
     for( auto iter = m_gains.begin( ); iter != m_gains.end( ); ++iter ) iter->setUserParticleIndex( a_particleIndex, a_userParticleIndex );
 }
 
+/* *********************************************************************************************************//**
+ * Shares the energy grid (and hash indices) and each reaction cross section of *this* with the ones of *a_other* that are identical,
+ * freeing the data of *this*. *a_other* must be for a lower temperature index than *this* and must outlive *this*.
+ *
+ * @param a_other               [in]    The heated cross section at another temperature.
+ * @param a_otherIndex          [in]    The index of the temperature of *a_other*.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionContinuousEnergy::shareData( HeatedCrossSectionContinuousEnergy const &a_other, int a_otherIndex ) {
+
+    if( ( m_energyGridSource < 0 ) && ( a_other.m_energyGridSource < 0 ) && ( m_energies.size( ) == a_other.m_energies.size( ) )
+            && ( m_hashIndices.size( ) == a_other.m_hashIndices.size( ) ) ) {
+        bool identical = true;
+
+        for( MCGIDI_VectorSizeType i1 = 0; identical && ( i1 < m_energies.size( ) ); ++i1 ) identical = m_energies[i1] == a_other.m_energies[i1];
+        for( MCGIDI_VectorSizeType i1 = 0; identical && ( i1 < m_hashIndices.size( ) ); ++i1 ) identical = m_hashIndices[i1] == a_other.m_hashIndices[i1];
+        if( identical ) {
+            m_energies.share( a_other.m_energies );
+            m_hashIndices.share( a_other.m_hashIndices );
+            m_energyGridSource = a_otherIndex;
+        }
+    }
+
+    if( numberOfReactions( ) != a_other.numberOfReactions( ) ) return;
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions( ); ++reactionIndex ) 
+        m_reactionCrossSections[reactionIndex]->shareCrossSection( *a_other.m_reactionCrossSections[reactionIndex], a_otherIndex );
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
  *
  * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
  * @param a_mode                [in]    Specifies the action of this method.
+ * @param a_heatedCrossSections [in]    The heated cross sections of all temperatures. Only needed when unpacking or interning shared data.
  ***********************************************************************************************************/
 
-HOST_DEVICE void HeatedCrossSectionContinuousEnergy::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+HOST_DEVICE void HeatedCrossSectionContinuousEnergy::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode, HeatedCrossSectionContinuousEnergy * const *a_heatedCrossSections ) {
 
-    DATA_MEMBER_VECTOR_INT( m_hashIndices, a_buffer, a_mode );
-    DATA_MEMBER_VECTOR_DOUBLE( m_energies, a_buffer, a_mode );
+    DATA_MEMBER_INT( m_energyGridSource, a_buffer, a_mode );
+    if( m_energyGridSource < 0 ) {
+        DATA_MEMBER_VECTOR_INT( m_hashIndices, a_buffer, a_mode );
+        DATA_MEMBER_VECTOR_DOUBLE( m_energies, a_buffer, a_mode ); }
+    else {
+        if( ( a_mode == DataBuffer::Mode::Unpack ) || ( a_mode == DataBuffer::Mode::Intern ) ) {
+            HeatedCrossSectionContinuousEnergy const *source = a_heatedCrossSections[m_energyGridSource];
+
+            m_hashIndices.share( source->m_hashIndices );
+            m_energies.share( source->m_energies );
+        }
+        if( a_mode == DataBuffer::Mode::Memory ) 
+            a_buffer.m_sharedPlacementSize += sizeof( int ) * m_hashIndices.capacity( ) + sizeof( double ) * m_energies.capacity( );
+    }
     DATA_MEMBER_VECTOR_DOUBLE( m_totalCrossSection, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_depositionEnergy, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_depositionMomentum, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_productionEnergy, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_INT( m_reactionsInURR_region, a_buffer, a_mode );
+    m_URR_bandTables.serialize( a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_packedReactionCrossSections, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_cumulativeReactionCrossSections, a_buffer, a_mode );
+    DATA_MEMBER_FLOAT( m_logEnergyMin, a_buffer, a_mode );
+    DATA_MEMBER_FLOAT( m_inverseLethargyStep, a_buffer, a_mode );
 
     MCGIDI_VectorSizeType vectorSize = m_reactionCrossSections.size( );
     int vectorSizeInt = (int) vectorSize;
@@ -638,7 +1258,7 @@ HOST_DEVICE void HeatedCrossSectionContinuousEnergy::serialize( DataBuffer &a_bu
         if( a_mode == DataBuffer::Mode::Memory ) {
             a_buffer.incrementPlacement( sizeof( HeatedReactionCrossSectionContinuousEnergy ) );
         }
-        m_reactionCrossSections[memberIndex]->serialize( a_buffer, a_mode );
+        m_reactionCrossSections[memberIndex]->serialize( a_buffer, a_mode, a_heatedCrossSections, memberIndex );
     }
 
     vectorSize = m_gains.size( );
@@ -660,7 +1280,8 @@ HOST_DEVICE void HeatedCrossSectionContinuousEnergy::serialize( DataBuffer &a_bu
 HOST_DEVICE HeatedCrossSectionsContinuousEnergy::HeatedCrossSectionsContinuousEnergy( ) :
         m_temperatures( ),
         m_thresholds( ),
-        m_heatedCrossSections( ) {
+        m_heatedCrossSections( ),
+        m_targetMassRatio( 0.0 ) {
 
 }
 
@@ -683,40 +1304,204 @@ HOST_DEVICE HeatedCrossSectionsContinuousEnergy::~HeatedCrossSectionsContinuousE
  * @param a_reactions                   [in]    The list of reactions to use.
  * @param a_orphanProducts              [in]    The list of orphan products to use.
  * @param a_fixedGrid                   [in]    If true, the specified fixed grid is used; otherwise, grid in the file is used.
+ *
+ * If on-the-fly Doppler broadening is requested, only the data for the lowest temperature are stored and higher
+ * temperatures are obtained by broadening those data at lookup time.
  ***********************************************************************************************************/
 
 HOST void HeatedCrossSectionsContinuousEnergy::update( SetupInfo &a_setupInfo, Transporting::MC const &a_settings, GIDI::Transporting::Particles const &a_particles, 
                 DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfos const &a_temperatureInfos, std::vector<GIDI::Reaction const *> const &a_reactions, 
                 std::vector<GIDI::Reaction const *> const &a_orphanProducts, bool a_fixedGrid ) {
 
-    m_temperatures.reserve( a_temperatureInfos.size( ) );
-    m_heatedCrossSections.reserve( a_temperatureInfos.size( ) );
+    if( a_settings.wantOnTheFlyDopplerBroadening( ) && ( a_setupInfo.m_protare.projectileMass( ) > 0.0 ) && ( a_temperatureInfos.size( ) > 0 ) ) {
+        GIDI::Styles::TemperatureInfos::const_iterator lowest = a_temperatureInfos.begin( );
 
-    for( GIDI::Styles::TemperatureInfos::const_iterator iter = a_temperatureInfos.begin( ); iter != a_temperatureInfos.end( ); ++iter ) {
-        m_temperatures.push_back( iter->temperature( ).value( ) );
-        m_heatedCrossSections.push_back( new HeatedCrossSectionContinuousEnergy( a_setupInfo, a_settings, a_particles, a_domainHash, *iter, a_reactions, a_orphanProducts, a_fixedGrid ) );
+        for( GIDI::Styles::TemperatureInfos::const_iterator iter = a_temperatureInfos.begin( ); iter != a_temperatureInfos.end( ); ++iter ) {
+            if( iter->temperature( ).value( ) < lowest->temperature( ).value( ) ) lowest = iter;
+        }
+
+        m_targetMassRatio = a_setupInfo.m_protare.targetMass( ) / a_setupInfo.m_protare.projectileMass( );
+        m_temperatures.push_back( lowest->temperature( ).value( ) );
+        m_heatedCrossSections.push_back( new HeatedCrossSectionContinuousEnergy( a_setupInfo, a_settings, a_particles, a_domainHash, *lowest, a_reactions, a_orphanProducts, a_fixedGrid ) ); }
+    else {
+        m_temperatures.reserve( a_temperatureInfos.size( ) );
+        m_heatedCrossSections.reserve( a_temperatureInfos.size( ) );
+
+        for( GIDI::Styles::TemperatureInfos::const_iterator iter = a_temperatureInfos.begin( ); iter != a_temperatureInfos.end( ); ++iter ) {
+            m_temperatures.push_back( iter->temperature( ).value( ) );
+            m_heatedCrossSections.push_back( new HeatedCrossSectionContinuousEnergy( a_setupInfo, a_settings, a_particles, a_domainHash, *iter, a_reactions, a_orphanProducts, a_fixedGrid ) );
+        }
     }
 
     m_thresholds.resize( m_heatedCrossSections[0]->numberOfReactions( ) );
     for( int i1 = 0; i1 < m_heatedCrossSections[0]->numberOfReactions( ); ++i1 ) m_thresholds[i1] = m_heatedCrossSections[0]->threshold( i1 );
+
+    for( MCGIDI_VectorSizeType i1 = 1; i1 < m_heatedCrossSections.size( ); ++i1 ) {        // Share data identical to that of a lower temperature.
+        for( MCGIDI_VectorSizeType i2 = 0; i2 < i1; ++i2 ) m_heatedCrossSections[i1]->shareData( *m_heatedCrossSections[i2], static_cast<int>( i2 ) );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Returns the largest URR cross section factor for the reaction with index *a_index* over all temperatures.
+ *
+ * @param a_index                 [in]    The index of the reaction.
+ *
+ * @return                                The largest URR cross section factor.
+ ***********************************************************************************************************/
+
+HOST double HeatedCrossSectionsContinuousEnergy::URR_maximumFactor( int a_index ) const {
+
+    double maximumFactor = 1.0;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_heatedCrossSections.size( ); ++i1 ) {
+        double factor = m_heatedCrossSections[i1]->URR_maximumFactor( a_index );
+
+        if( factor > maximumFactor ) maximumFactor = factor;
+    }
+
+    return( maximumFactor );
+}
+
+/* *********************************************************************************************************//**
+ * Returns true if cross sections at temperature *a_temperature* are to be obtained by on-the-fly Doppler broadening of the
+ * lowest temperature data. Broadening is not applied in the unresolved resonance region, where the probability tables
+ * of the lowest temperature are used.
+ *
+ * @param a_URR_protareInfos      [in]    URR information.
+ * @param a_URR_index             [in]    The URR index of the protare.
+ * @param a_temperature           [in]    The target temperature.
+ *
+ * @return                                true if the cross section is to be Doppler broadened.
+ ***********************************************************************************************************/
+
+HOST_DEVICE bool HeatedCrossSectionsContinuousEnergy::dopplerBroaden( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_temperature ) const {
+
+    if( m_targetMassRatio <= 0.0 ) return( false );
+    if( a_temperature <= m_temperatures[0] ) return( false );
+    if( ( a_URR_index >= 0 ) && a_URR_protareInfos[a_URR_index].m_inURR ) return( false );
+
+    return( true );
 }
 /*
 =========================================================
 */
-HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling ) const {
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex,
+                double a_temperature, double a_energy, bool a_sampling ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double cross_section;
+    return( crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy, a_sampling ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) { 
-        cross_section = m_heatedCrossSections[0]->crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        cross_section = m_heatedCrossSections.back( )->crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        cross_section = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling )
-                            + fraction * m_heatedCrossSections[i1]->crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling );
+/* *********************************************************************************************************//**
+ * Returns the total cross section using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_URR_protareInfos      [in]    URR information.
+ * @param a_URR_index             [in]    The URR index of the protare.
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                [in]    The energy of the projectile.
+ * @param a_sampling              [in]    Not used for continuous energy cross sections.
+ *
+ * @return                              The total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex,
+                TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling ) const {
+
+    if( dopplerBroaden( a_URR_protareInfos, a_URR_index, a_temperatureContext.temperature( ) ) )
+        return( m_heatedCrossSections[0]->dopplerBroadenedCrossSection( -1, a_energy, dopplerBroadeningAlpha( a_temperatureContext.temperature( ) ) ) );
+
+    double cross_section = m_heatedCrossSections[a_temperatureContext.index1( )]->crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling );
+
+    if( a_temperatureContext.interpolate( ) ) cross_section = ( 1. - a_temperatureContext.fraction( ) ) * cross_section
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->crossSection( a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling );
+
+    return( cross_section );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **crossSection** method with argument *a_temperatureContext* but the energy search starts from the indices stored in *a_energyIndexHint*.
+ *
+ * @param a_URR_protareInfos      [in]    URR information.
+ * @param a_URR_index             [in]    The URR index of the protare.
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energyIndexHint       [in]    The particle's last energy indices for *this*. Updated on return.
+ * @param a_energy                [in]    The energy of the projectile.
+ * @param a_sampling              [in]    Not used for continuous energy cross sections.
+ *
+ * @return                              The total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex,
+                TemperatureContext const &a_temperatureContext, EnergyIndexHint &a_energyIndexHint, double a_energy, bool a_sampling ) const {
+
+    if( dopplerBroaden( a_URR_protareInfos, a_URR_index, a_temperatureContext.temperature( ) ) )
+        return( m_heatedCrossSections[0]->dopplerBroadenedCrossSection( -1, a_energy, dopplerBroadeningAlpha( a_temperatureContext.temperature( ) ) ) );
+
+    HeatedCrossSectionContinuousEnergy const &heatedCrossSection1 = *m_heatedCrossSections[a_temperatureContext.index1( )];
+    double energy_fraction;
+    int energy_index = heatedCrossSection1.evaluationInfo( a_hashIndex, a_energy, &energy_fraction, &a_energyIndexHint, 0 );
+    double cross_section = heatedCrossSection1.crossSection2( a_URR_protareInfos, a_URR_index, a_energy, energy_index, energy_fraction, a_sampling );
+
+    if( a_temperatureContext.interpolate( ) ) {
+        HeatedCrossSectionContinuousEnergy const &heatedCrossSection2 = *m_heatedCrossSections[a_temperatureContext.index2( )];
+
+        energy_index = heatedCrossSection2.evaluationInfo( a_hashIndex, a_energy, &energy_fraction, &a_energyIndexHint, 1 );
+        cross_section = ( 1. - a_temperatureContext.fraction( ) ) * cross_section
+                + a_temperatureContext.fraction( ) * heatedCrossSection2.crossSection2( a_URR_protareInfos, a_URR_index, a_energy, energy_index, energy_fraction, a_sampling );
+    }
+
+    return( cross_section );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the total cross section using the lower energy indices determined by a UnionizedGrid, one index for each temperature of *this*.
+ * No energy search is performed by this method.
+ *
+ * @param   a_URR_protareInfos  [in]    URR information.
+ * @param   a_URR_index         [in]    The URR index of the protare.
+ * @param   a_energyIndices     [in]    The lower energy index for each temperature.
+ * @param   a_temperature       [in]    The target temperature.
+ * @param   a_energy            [in]    The projectile energy.
+ * @param   a_sampling          [in]    Not used for continuous energy cross sections.
+ *
+ * @return                              The total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::unionizedCrossSection( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int const *a_energyIndices, 
+                double a_temperature, double a_energy, bool a_sampling ) const {
+
+    return( unionizedCrossSection( a_URR_protareInfos, a_URR_index, a_energyIndices, TemperatureContext( m_temperatures, a_temperature ), a_energy, a_sampling ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **unionizedCrossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param   a_URR_protareInfos      [in]    URR information.
+ * @param   a_URR_index             [in]    The URR index of the protare.
+ * @param   a_energyIndices         [in]    The lower energy index for each temperature.
+ * @param   a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param   a_energy                [in]    The projectile energy.
+ * @param   a_sampling              [in]    Not used for continuous energy cross sections.
+ *
+ * @return                                  The total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::unionizedCrossSection( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int const *a_energyIndices, 
+                TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling ) const {
+
+    if( dopplerBroaden( a_URR_protareInfos, a_URR_index, a_temperatureContext.temperature( ) ) )
+        return( m_heatedCrossSections[0]->dopplerBroadenedCrossSection( -1, a_energy, dopplerBroadeningAlpha( a_temperatureContext.temperature( ) ) ) );
+
+    int index1 = a_temperatureContext.index1( ), index2 = a_temperatureContext.index2( );
+    double energy_fraction;
+    int energy_index = m_heatedCrossSections[index1]->evaluationInfoAtIndex( a_energyIndices[index1], a_energy, &energy_fraction );
+    double cross_section = m_heatedCrossSections[index1]->crossSection2( a_URR_protareInfos, a_URR_index, a_energy, energy_index, energy_fraction, a_sampling );
+
+    if( a_temperatureContext.interpolate( ) ) {
+        cross_section *= 1. - a_temperatureContext.fraction( );
+        energy_index = m_heatedCrossSections[index2]->evaluationInfoAtIndex( a_energyIndices[index2], a_energy, &energy_fraction );
+        cross_section += a_temperatureContext.fraction( ) * m_heatedCrossSections[index2]->crossSection2( a_URR_protareInfos, a_URR_index, a_energy, energy_index, energy_fraction, a_sampling );
     }
 
     return( cross_section );
@@ -735,25 +1520,11 @@ HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::crossSection( URR_protar
 HOST_DEVICE void HeatedCrossSectionsContinuousEnergy::crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, 
         double *a_crossSectionVector ) const {
 
-    int number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    int index1 = 0, index2 = 0;
-    double fraction = 0.0;
-
-    if( a_temperature <= m_temperatures[0] ) { 
-        }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        index1 = index2 = number_of_temperatures - 1;
-        fraction = 1.0; }
-    else {
-        for( ; index2 < number_of_temperatures; ++index2 ) if( a_temperature < m_temperatures[index2] ) break;
-        index1 = index2 - 1;
-        fraction = ( a_temperature - m_temperatures[index1] ) / ( m_temperatures[index2] - m_temperatures[index1] );
-    }
-
-    Vector<double> &totalCrossSection1 = m_heatedCrossSections[index1]->totalCrossSection( );
-    Vector<double> &totalCrossSection2 = m_heatedCrossSections[index2]->totalCrossSection( );
+    TemperatureContext temperatureContext( m_temperatures, a_temperature );
+    Vector<MCGIDI_StorageType> &totalCrossSection1 = m_heatedCrossSections[temperatureContext.index1( )]->totalCrossSection( );
+    Vector<MCGIDI_StorageType> &totalCrossSection2 = m_heatedCrossSections[temperatureContext.index2( )]->totalCrossSection( );
     MCGIDI_VectorSizeType size = totalCrossSection1.size( );
-    double factor1 = a_userFactor * ( 1.0 - fraction ), factor2 = a_userFactor * fraction;
+    double factor1 = a_userFactor * ( 1.0 - temperatureContext.fraction( ) ), factor2 = a_userFactor * temperatureContext.fraction( );
 
     if( a_numberAllocated < totalCrossSection1.size( ) ) THROW( "HeatedCrossSectionsContinuousEnergy::crossSectionVector: a_numberAllocated too small." );
     for( MCGIDI_VectorSizeType i1 = 0; i1 < size; ++i1 ) {
@@ -761,25 +1532,112 @@ HOST_DEVICE void HeatedCrossSectionsContinuousEnergy::crossSectionVector( double
     }
 }
 
+/* *********************************************************************************************************//**
+ * Adds the energy dependent, total cross section for each temperature in *a_temperatures* multiplied by *a_userFactor* to *a_crossSectionVectors*.
+ * The vector for the temperature at index *temperatureIndex* starts at *a_crossSectionVectors* + *temperatureIndex* * *a_numberAllocated*.
+ * The energy grid is split into *a_numberOfThreads* ranges which are filled in parallel. This method only works for fixed-grid data.
+ *
+ * @param   a_numberOfTemperatures          [in]        The number of temperatures in *a_temperatures*.
+ * @param   a_temperatures                  [in]        The temperatures of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each temperature in *a_crossSectionVectors*.
+ * @param   a_crossSectionVectors           [in/out]    The energy dependent, total cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionsContinuousEnergy::crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const {
+
+    int size = static_cast<int>( m_heatedCrossSections[0]->totalCrossSection( ).size( ) );
+    std::vector<MCGIDI_StorageType const *> totalCrossSections1( a_numberOfTemperatures ), totalCrossSections2( a_numberOfTemperatures );
+    std::vector<double> factors1( a_numberOfTemperatures ), factors2( a_numberOfTemperatures );
+
+    if( a_numberAllocated < size ) THROW( "HeatedCrossSectionsContinuousEnergy::crossSectionVectors: a_numberAllocated too small." );
+    if( size == 0 ) return;
+    for( int i1 = 0; i1 < a_numberOfTemperatures; ++i1 ) {
+        TemperatureContext temperatureContext = TemperatureContext( m_temperatures, a_temperatures[i1] );
+
+        totalCrossSections1[i1] = &m_heatedCrossSections[temperatureContext.index1( )]->totalCrossSection( )[0];
+        totalCrossSections2[i1] = &m_heatedCrossSections[temperatureContext.index2( )]->totalCrossSection( )[0];
+        factors1[i1] = a_userFactor * ( 1.0 - temperatureContext.fraction( ) );
+        factors2[i1] = a_userFactor * temperatureContext.fraction( );
+    }
+
+    crossSectionVectorRanges( size, a_numberOfThreads, [&]( int a_begin, int a_end ) {
+        for( int i1 = 0; i1 < a_numberOfTemperatures; ++i1 ) {
+            MCGIDI_StorageType const *totalCrossSection1 = totalCrossSections1[i1];
+            MCGIDI_StorageType const *totalCrossSection2 = totalCrossSections2[i1];
+            double *crossSectionVector = &a_crossSectionVectors[i1 * a_numberAllocated];
+            double factor1 = factors1[i1], factor2 = factors2[i1];
+
+            for( int i2 = a_begin; i2 < a_end; ++i2 ) crossSectionVector[i2] += factor1 * totalCrossSection1[i2] + factor2 * totalCrossSection2[i2];
+        }
+    } );
+}
+
+/* *********************************************************************************************************//**
+ * Adds the energy dependent cross section of each reaction for temperature *a_temperature* multiplied by *a_userFactor* to
+ * *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at *a_reactionCrossSectionVectors* +
+ * *reactionIndex* * *a_numberAllocated*. The energy grid is split into *a_numberOfThreads* ranges which are filled in parallel. This method only works for fixed-grid data.
+ *
+ * @param   a_temperature                   [in]        Specifies the temperature of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each reaction in *a_reactionCrossSectionVectors*.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The energy dependent, reaction cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionsContinuousEnergy::reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, 
+                double *a_reactionCrossSectionVectors, int a_numberOfThreads ) const {
+
+    TemperatureContext temperatureContext = TemperatureContext( m_temperatures, a_temperature );
+    HeatedCrossSectionContinuousEnergy const *heatedCrossSection1 = m_heatedCrossSections[temperatureContext.index1( )];
+    HeatedCrossSectionContinuousEnergy const *heatedCrossSection2 = m_heatedCrossSections[temperatureContext.index2( )];
+    int size = static_cast<int>( m_heatedCrossSections[temperatureContext.index1( )]->totalCrossSection( ).size( ) );
+    double factor1 = a_userFactor * ( 1.0 - temperatureContext.fraction( ) ), factor2 = a_userFactor * temperatureContext.fraction( );
+
+    if( a_numberAllocated < size ) THROW( "HeatedCrossSectionsContinuousEnergy::reactionCrossSectionVectors: a_numberAllocated too small." );
+
+    crossSectionVectorRanges( size, a_numberOfThreads, [&]( int a_begin, int a_end ) {
+        heatedCrossSection1->addReactionCrossSectionVectors( factor1, a_begin, a_end, a_numberAllocated, a_reactionCrossSectionVectors );
+        if( temperatureContext.interpolate( ) )
+            heatedCrossSection2->addReactionCrossSectionVectors( factor2, a_begin, a_end, a_numberAllocated, a_reactionCrossSectionVectors );
+    } );
+}
+
 /*
 =========================================================
 */
-HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index, 
-                int a_hashIndex, double a_temperature, double a_energy, bool a_sampling ) const {
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos,
+                int a_URR_index, int a_hashIndex, double a_temperature, double a_energy, bool a_sampling ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double cross_section;
+    return( reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy, a_sampling ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        cross_section = m_heatedCrossSections[0]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        cross_section = m_heatedCrossSections.back( )->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        cross_section = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling )
-                            + fraction * m_heatedCrossSections[i1]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling );
-    }
+/* *********************************************************************************************************//**
+ * Returns the cross section for the reaction at index *a_reactionIndex* using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_reactionIndex         [in]    The index of the reaction.
+ * @param a_URR_protareInfos      [in]    URR information.
+ * @param a_URR_index             [in]    The URR index of the protare.
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                [in]    The energy of the projectile.
+ * @param a_sampling              [in]    Not used for continuous energy cross sections.
+ *
+ * @return                              The cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos,
+                int a_URR_index, int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling ) const {
+
+    if( dopplerBroaden( a_URR_protareInfos, a_URR_index, a_temperatureContext.temperature( ) ) )
+        return( m_heatedCrossSections[0]->dopplerBroadenedCrossSection( a_reactionIndex, a_energy, dopplerBroadeningAlpha( a_temperatureContext.temperature( ) ) ) );
+
+    double cross_section = m_heatedCrossSections[a_temperatureContext.index1( )]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling );
+
+    if( a_temperatureContext.interpolate( ) ) cross_section = ( 1. - a_temperatureContext.fraction( ) ) * cross_section
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_hashIndex, a_energy, a_sampling );
 
     return( cross_section );
 }
@@ -790,19 +1648,14 @@ HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::reactionCrossSection( in
 HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_URR_index,
                 double a_temperature, double a_energy_in ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double cross_section;
+    if( dopplerBroaden( a_URR_protareInfos, a_URR_index, a_temperature ) )
+        return( m_heatedCrossSections[0]->dopplerBroadenedCrossSection( a_reactionIndex, a_energy_in, dopplerBroadeningAlpha( a_temperature ) ) );
 
-    if( a_temperature <= m_temperatures[0] ) {
-        cross_section = m_heatedCrossSections[0]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_energy_in ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        cross_section = m_heatedCrossSections.back( )->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_energy_in ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        cross_section = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_energy_in )
-                            + fraction * m_heatedCrossSections[i1]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_energy_in );
-    }
+    TemperatureContext temperatureContext( m_temperatures, a_temperature );
+    double cross_section = m_heatedCrossSections[temperatureContext.index1( )]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_energy_in );
+
+    if( temperatureContext.interpolate( ) ) cross_section = ( 1. - temperatureContext.fraction( ) ) * cross_section
+            + temperatureContext.fraction( ) * m_heatedCrossSections[temperatureContext.index2( )]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_URR_index, a_energy_in );
 
     return( cross_section );
 }
@@ -813,48 +1666,171 @@ HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::reactionCrossSection( in
 HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, double a_temperature, 
                 double a_energy, double a_crossSection, double (*userrng)( void * ), void *rngState ) const {
 
-    int i1, sampled_reaction_index, temperatureIndex1, temperatureIndex2, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double sampleCrossSection = a_crossSection * userrng( rngState );
+    return( sampleReaction( a_URR_protareInfos, a_URR_index, a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy, a_crossSection, 
+            userrng, rngState ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        temperatureIndex1 = 0;
-        temperatureIndex2 = temperatureIndex1; }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        temperatureIndex1 = static_cast<int>( m_temperatures.size( ) ) - 1;
-        temperatureIndex2 = temperatureIndex1; }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        temperatureIndex1 = i1 - 1;
-        temperatureIndex2 = i1;
-    }
+/* *********************************************************************************************************//**
+ * Returns the index of a sampled reaction using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_URR_index               [in]    The URR index of the protare.
+ * @param a_hashIndex               [in]    The cross section hash index.
+ * @param a_temperatureContext      [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                  [in]    The energy of the projectile.
+ * @param a_crossSection            [in]    The total cross section.
+ * @param userrng                   [in]    A random number generator that takes the state *rngState* and returns a double in the range [0.0, 1.0).
+ * @param rngState                  [in]    The current state for the random number generator.
+ *
+ * @return                                  The index of the sampled reaction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, double a_energy, double a_crossSection, double (*userrng)( void * ), void *rngState ) const {
+
+    return( sampleReaction2( a_URR_protareInfos, a_URR_index, a_hashIndex, a_temperatureContext, nullptr, a_energy, a_crossSection, userrng, rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **sampleReaction** method with argument *a_temperatureContext* but the energy search starts from the indices stored
+ * in *a_energyIndexHint*.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_URR_index               [in]    The URR index of the protare.
+ * @param a_hashIndex               [in]    The cross section hash index.
+ * @param a_temperatureContext      [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energyIndexHint         [in]    The particle's last energy indices for *this*. Updated on return.
+ * @param a_energy                  [in]    The energy of the projectile.
+ * @param a_crossSection            [in]    The total cross section.
+ * @param userrng                   [in]    A random number generator that takes the state *rngState* and returns a double in the range [0.0, 1.0).
+ * @param rngState                  [in]    The current state for the random number generator.
+ *
+ * @return                                  The index of the sampled reaction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, EnergyIndexHint &a_energyIndexHint, double a_energy, double a_crossSection, 
+                double (*userrng)( void * ), void *rngState ) const {
+
+    return( sampleReaction2( a_URR_protareInfos, a_URR_index, a_hashIndex, a_temperatureContext, &a_energyIndexHint, a_energy, a_crossSection, userrng, rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Does the work for the **sampleReaction** methods. If *a_energyIndexHint* is not *nullptr*, it is used for the energy searches.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_URR_index               [in]    The URR index of the protare.
+ * @param a_hashIndex               [in]    The cross section hash index.
+ * @param a_temperatureContext      [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energyIndexHint         [in]    The particle's last energy indices for *this* or *nullptr*.
+ * @param a_energy                  [in]    The energy of the projectile.
+ * @param a_crossSection            [in]    The total cross section.
+ * @param userrng                   [in]    A random number generator that takes the state *rngState* and returns a double in the range [0.0, 1.0).
+ * @param rngState                  [in]    The current state for the random number generator.
+ *
+ * @return                                  The index of the sampled reaction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReaction2( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, EnergyIndexHint *a_energyIndexHint, double a_energy, double a_crossSection, 
+                double (*userrng)( void * ), void *rngState ) const {
+
+    int sampled_reaction_index, temperatureIndex1 = a_temperatureContext.index1( ), temperatureIndex2 = a_temperatureContext.index2( );
+    double sampleCrossSection = a_crossSection * userrng( rngState );
 
     int numberOfReactions = m_heatedCrossSections[0]->numberOfReactions( );
     double energyFraction1, energyFraction2, crossSectionSum = 0.0;
 
+    if( dopplerBroaden( a_URR_protareInfos, a_URR_index, a_temperatureContext.temperature( ) ) ) {
+        HeatedCrossSectionContinuousEnergy &heatedCrossSection = *m_heatedCrossSections[0];
+        double alpha = dopplerBroadeningAlpha( a_temperatureContext.temperature( ) );
+        double crossSections[MCGIDI_DopplerBroadeningReactionChunkSize];
+        int firstNonZeroIndex = numberOfReactions;
+
+        for( int start = 0; start < numberOfReactions; start += MCGIDI_DopplerBroadeningReactionChunkSize ) {  // One kernel integration per chunk of reactions.
+            int size = numberOfReactions - start;
+            if( size > MCGIDI_DopplerBroadeningReactionChunkSize ) size = MCGIDI_DopplerBroadeningReactionChunkSize;
+
+            heatedCrossSection.dopplerBroadenedCrossSections( start, size, a_energy, alpha, crossSections );
+            for( int i1 = 0; i1 < size; ++i1 ) {
+                if( ( firstNonZeroIndex == numberOfReactions ) && ( crossSections[i1] > 0.0 ) ) firstNonZeroIndex = start + i1;
+                crossSectionSum += crossSections[i1];
+                if( crossSectionSum >= sampleCrossSection ) return( start + i1 );
+            }
+        }
+
+        return( firstNonZeroIndex );                        // Round-off, pick the first reaction with non-zero cross section.
+    }
+
     HeatedCrossSectionContinuousEnergy &heatedCrossSection1 = *m_heatedCrossSections[temperatureIndex1];
-    int energyIndex1 = heatedCrossSection1.evaluationInfo( a_hashIndex, a_energy, &energyFraction1 );
+    int energyIndex1 = heatedCrossSection1.evaluationInfo( a_hashIndex, a_energy, &energyFraction1, a_energyIndexHint, 0 );
+    bool packed = heatedCrossSection1.hasPackedReactionCrossSections( );
+
+    if( heatedCrossSection1.hasCumulativeReactionCrossSections( ) ) {
+        HeatedCrossSectionContinuousEnergy &heatedCrossSection2 = *m_heatedCrossSections[temperatureIndex2];
+        double temperatureFraction1 = 1.0;
+        int energyIndex2 = energyIndex1;
+
+        energyFraction2 = energyFraction1;
+        if( temperatureIndex1 != temperatureIndex2 ) {
+            temperatureFraction1 = 1.0 - a_temperatureContext.fraction( );
+            energyIndex2 = heatedCrossSection2.evaluationInfo( a_hashIndex, a_energy, &energyFraction2, a_energyIndexHint, 1 );
+        }
+
+        sampled_reaction_index = sampleReactionCumulative( a_URR_protareInfos, a_URR_index, a_energy, sampleCrossSection, heatedCrossSection1, energyIndex1, 
+                energyFraction1, temperatureFraction1, heatedCrossSection2, energyIndex2, energyFraction2 );
+        if( sampled_reaction_index >= 0 ) return( sampled_reaction_index );
+    }
+
+    if( ( a_URR_index >= 0 ) && a_URR_protareInfos[a_URR_index].m_inURR ) packed = false;
 
     if( temperatureIndex1 == temperatureIndex2 ) {
-        for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
-            crossSectionSum += heatedCrossSection1.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex1, energyFraction1 );
-            if( crossSectionSum >= sampleCrossSection ) break;
+        if( packed ) {                                  // Reaction cross sections at energyIndex1 and energyIndex1 + 1 are adjacent in memory.
+            MCGIDI_StorageType const *crossSections1 = heatedCrossSection1.packedReactionCrossSectionsAt( energyIndex1 );
+            MCGIDI_StorageType const *crossSections2 = crossSections1 + numberOfReactions;
+
+            for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
+                crossSectionSum += energyFraction1 * crossSections1[sampled_reaction_index] + ( 1.0 - energyFraction1 ) * crossSections2[sampled_reaction_index];
+                if( crossSectionSum >= sampleCrossSection ) break;
+            } }
+        else {
+            for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
+                crossSectionSum += heatedCrossSection1.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex1, energyFraction1 );
+                if( crossSectionSum >= sampleCrossSection ) break;
+            }
         } }
     else {
-        double temperatureFraction2 = ( a_temperature - m_temperatures[temperatureIndex1] ) / ( m_temperatures[temperatureIndex2] - m_temperatures[temperatureIndex1] );
+        double temperatureFraction2 = a_temperatureContext.fraction( );
         double temperatureFraction1 = 1.0 - temperatureFraction2;
         HeatedCrossSectionContinuousEnergy &heatedCrossSection2 = *m_heatedCrossSections[temperatureIndex2];
-        int energyIndex2 = heatedCrossSection2.evaluationInfo( a_hashIndex, a_energy, &energyFraction2 );
-
-        for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
-            if( m_thresholds[sampled_reaction_index] >= a_energy ) continue;
-            crossSectionSum += temperatureFraction1 * heatedCrossSection1.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex1, energyFraction1 );
-            crossSectionSum += temperatureFraction2 * heatedCrossSection2.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex2, energyFraction2 );
-            if( crossSectionSum >= sampleCrossSection ) break;
+        int energyIndex2 = heatedCrossSection2.evaluationInfo( a_hashIndex, a_energy, &energyFraction2, a_energyIndexHint, 1 );
+
+        if( packed ) {
+            MCGIDI_StorageType const *crossSections11 = heatedCrossSection1.packedReactionCrossSectionsAt( energyIndex1 );
+            MCGIDI_StorageType const *crossSections12 = crossSections11 + numberOfReactions;
+            MCGIDI_StorageType const *crossSections21 = heatedCrossSection2.packedReactionCrossSectionsAt( energyIndex2 );
+            MCGIDI_StorageType const *crossSections22 = crossSections21 + numberOfReactions;
+            double factor11 = temperatureFraction1 * energyFraction1, factor12 = temperatureFraction1 * ( 1.0 - energyFraction1 );
+            double factor21 = temperatureFraction2 * energyFraction2, factor22 = temperatureFraction2 * ( 1.0 - energyFraction2 );
+
+            for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
+                if( m_thresholds[sampled_reaction_index] >= a_energy ) continue;
+                crossSectionSum += factor11 * crossSections11[sampled_reaction_index] + factor12 * crossSections12[sampled_reaction_index]
+                                 + factor21 * crossSections21[sampled_reaction_index] + factor22 * crossSections22[sampled_reaction_index];
+                if( crossSectionSum >= sampleCrossSection ) break;
+            } }
+        else {
+            for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
+                if( m_thresholds[sampled_reaction_index] >= a_energy ) continue;
+                crossSectionSum += temperatureFraction1 * heatedCrossSection1.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex1, energyFraction1 );
+                crossSectionSum += temperatureFraction2 * heatedCrossSection2.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex2, energyFraction2 );
+                if( crossSectionSum >= sampleCrossSection ) break;
+            }
         }
     }
 
     if( sampled_reaction_index == numberOfReactions ) {
-        if( crossSectionSum < ( 1.0 - 1e-8 ) * a_crossSection ) THROW( "HeatedCrossSectionsContinuousEnergy::sampleReaction: crossSectionSum less than a_crossSection" );
+        if( crossSectionSum < ( 1.0 - MCGIDI_StorageEpsilon ) * a_crossSection ) THROW( "HeatedCrossSectionsContinuousEnergy::sampleReaction: crossSectionSum less than a_crossSection" );
         for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {   // This should rarely happen so just pick the first reaction with non-zero cross section.
             if( heatedCrossSection1.reactionCrossSection2( sampled_reaction_index, a_URR_protareInfos, a_URR_index, a_energy, energyIndex1, energyFraction1, true ) > 0 ) break;
         }
@@ -863,6 +1839,216 @@ HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReaction( URR_protare
     return( sampled_reaction_index );
 }
 
+/* *********************************************************************************************************//**
+ * Returns the cumulative cross section of reactions 0 to *a_reactionIndex* interpolated between two energy rows for each of two temperatures.
+ *
+ * @param a_cumulative11        [in]    The cumulative cross sections at the lower energy index of the first temperature.
+ * @param a_cumulative21        [in]    The cumulative cross sections at the lower energy index of the second temperature.
+ * @param a_weight11            [in]    The weight of the lower energy row of the first temperature.
+ * @param a_weight12            [in]    The weight of the upper energy row of the first temperature.
+ * @param a_weight21            [in]    The weight of the lower energy row of the second temperature.
+ * @param a_weight22            [in]    The weight of the upper energy row of the second temperature.
+ * @param a_numberOfReactions   [in]    The number of reactions (i.e., the length of a row).
+ * @param a_reactionIndex       [in]    The index of the last reaction in the sum.
+ *
+ * @return                              The cumulative cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE static double cumulativeReactionCrossSectionAt( double const *a_cumulative11, double const *a_cumulative21, double a_weight11, double a_weight12, 
+                double a_weight21, double a_weight22, int a_numberOfReactions, int a_reactionIndex ) {
+
+    return( a_weight11 * a_cumulative11[a_reactionIndex] + a_weight12 * a_cumulative11[a_reactionIndex+a_numberOfReactions]
+          + a_weight21 * a_cumulative21[a_reactionIndex] + a_weight22 * a_cumulative21[a_reactionIndex+a_numberOfReactions] );
+}
+
+/* *********************************************************************************************************//**
+ * Samples a reaction using the cumulative reaction cross section tables. The cumulative cross sections are interpolated in energy and 
+ * temperature and the first reaction whose cumulative cross section is not less than *a_sampleCrossSection* is found by a binary search.
+ * When the protare is in its URR region, the reactions in the URR region have their cross section scaled by a probability table factor.
+ * These reactions split the reaction list into segments, each with a constant correction to the cumulative cross section, and only the
+ * segment containing *a_sampleCrossSection* is binary searched. For a single temperature, pass the same data for the second temperature and
+ * set *a_temperatureFraction1* to 1.
+ *
+ * A negative value is returned if no reaction is found or if the sampled reaction is at or below its threshold when interpolating between
+ * two temperatures. The caller must then use the linear search which skips such reactions.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_URR_index               [in]    The URR index of the protare.
+ * @param a_energy                  [in]    The energy of the projectile.
+ * @param a_sampleCrossSection      [in]    The random cross section target.
+ * @param a_heatedCrossSection1     [in]    The data for the lower temperature.
+ * @param a_energyIndex1            [in]    The lower energy index for *a_heatedCrossSection1*.
+ * @param a_energyFraction1         [in]    The energy fraction for *a_heatedCrossSection1*.
+ * @param a_temperatureFraction1    [in]    The weight of the lower temperature.
+ * @param a_heatedCrossSection2     [in]    The data for the upper temperature.
+ * @param a_energyIndex2            [in]    The lower energy index for *a_heatedCrossSection2*.
+ * @param a_energyFraction2         [in]    The energy fraction for *a_heatedCrossSection2*.
+ *
+ * @return                                  The index of the sampled reaction or -1.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReactionCumulative( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, double a_energy, 
+                double a_sampleCrossSection, HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection1, int a_energyIndex1, double a_energyFraction1, 
+                double a_temperatureFraction1, HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection2, int a_energyIndex2, double a_energyFraction2 ) const {
+
+    int numberOfReactions = a_heatedCrossSection1.numberOfReactions( );
+    double temperatureFraction2 = 1.0 - a_temperatureFraction1;
+    double weight11 = a_temperatureFraction1 * a_energyFraction1, weight12 = a_temperatureFraction1 * ( 1.0 - a_energyFraction1 );
+    double weight21 = temperatureFraction2 * a_energyFraction2, weight22 = temperatureFraction2 * ( 1.0 - a_energyFraction2 );
+    double const *cumulative11 = a_heatedCrossSection1.cumulativeReactionCrossSectionsAt( a_energyIndex1 );
+    double const *cumulative21 = a_heatedCrossSection2.cumulativeReactionCrossSectionsAt( a_energyIndex2 );
+
+    int numberOfURR_reactions = 0;
+    if( ( a_URR_index >= 0 ) && a_URR_protareInfos[a_URR_index].m_inURR ) numberOfURR_reactions = static_cast<int>( a_heatedCrossSection1.reactionsInURR_region( ).size( ) );
+
+    int lower = 0, sampled_reaction_index = -1;
+    double correction = 0.0;
+
+    for( int i1 = 0; i1 <= numberOfURR_reactions; ++i1 ) {
+        int upper = numberOfReactions - 1;
+
+        if( i1 < numberOfURR_reactions ) upper = a_heatedCrossSection1.reactionsInURR_region( )[i1] - 1;
+        if( ( upper >= lower ) && ( cumulativeReactionCrossSectionAt( cumulative11, cumulative21, weight11, weight12, weight21, weight22, numberOfReactions, upper ) 
+                + correction >= a_sampleCrossSection ) ) {
+            while( lower < upper ) {
+                int middle = ( lower + upper ) / 2;
+
+                if( cumulativeReactionCrossSectionAt( cumulative11, cumulative21, weight11, weight12, weight21, weight22, numberOfReactions, middle ) 
+                        + correction >= a_sampleCrossSection ) {
+                    upper = middle; }
+                else {
+                    lower = middle + 1;
+                }
+            }
+            sampled_reaction_index = lower;
+            break;
+        }
+
+        if( i1 < numberOfURR_reactions ) {
+            int reactionIndex = a_heatedCrossSection1.reactionsInURR_region( )[i1];
+
+            correction += a_temperatureFraction1 * ( a_heatedCrossSection1.reactionCrossSection2( reactionIndex, a_URR_protareInfos, a_URR_index, a_energy, a_energyIndex1, a_energyFraction1 )
+                    - a_heatedCrossSection1.reactionCrossSection2( reactionIndex, a_URR_protareInfos, -1, a_energy, a_energyIndex1, a_energyFraction1 ) );
+            if( temperatureFraction2 > 0.0 ) {
+                correction += temperatureFraction2 * ( a_heatedCrossSection2.reactionCrossSection2( reactionIndex, a_URR_protareInfos, a_URR_index, a_energy, a_energyIndex2, a_energyFraction2 )
+                        - a_heatedCrossSection2.reactionCrossSection2( reactionIndex, a_URR_protareInfos, -1, a_energy, a_energyIndex2, a_energyFraction2 ) );
+            }
+            lower = reactionIndex;
+        }
+    }
+
+    if( ( sampled_reaction_index >= 0 ) && ( temperatureFraction2 > 0.0 ) && ( m_thresholds[sampled_reaction_index] >= a_energy ) ) sampled_reaction_index = -1;
+
+    return( sampled_reaction_index );
+}
+
+/* *********************************************************************************************************//**
+ * Batch version of **crossSection** and **reactionCrossSection**. See Protare::crossSectionBatch for a description of the arguments.
+ * The particles are processed in chunks of MCGIDI_CrossSectionBatchChunkSize. For each chunk, all temperature and energy searches are done
+ * first and stored in local arrays. The total cross section interpolation loop that follows has no branches or function calls so that the
+ * compiler can vectorize it. The reaction cross sections are interpolated by calling **reactionCrossSection2** for each particle (it handles
+ * the packed table and each reaction's offset and threshold), so that loop only benefits from the searches having been done up front.
+ * If the protare is in its URR region or on-the-fly Doppler broadening is used, the single particle methods are called instead.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_URR_index               [in]    The URR index of the protare.
+ * @param a_number                  [in]    The number of particles.
+ * @param a_hashIndices             [in]    The cross section hash index of each particle.
+ * @param a_temperatures            [in]    The target temperature for each particle.
+ * @param a_energies                [in]    The projectile energy of each particle.
+ * @param a_crossSections           [out]   The total cross section for each particle.
+ * @param a_reactionCrossSections   [out]   If not *nullptr*, the reaction cross sections for each particle.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionsContinuousEnergy::crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_URR_index, int a_number, 
+                int const *a_hashIndices, double const *a_temperatures, double const *a_energies, double *a_crossSections, double *a_reactionCrossSections ) const {
+
+    int number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
+    int numberOfReactions = m_heatedCrossSections[0]->numberOfReactions( );
+
+    if( ( ( a_URR_index >= 0 ) && a_URR_protareInfos[a_URR_index].m_inURR ) || ( m_targetMassRatio > 0.0 ) ) {
+        for( int i1 = 0; i1 < a_number; ++i1 ) a_crossSections[i1] = crossSection( a_URR_protareInfos, a_URR_index, a_hashIndices[i1], a_temperatures[i1], a_energies[i1] );
+        if( a_reactionCrossSections != nullptr ) {
+            for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+                double *reactionCrossSections = &a_reactionCrossSections[static_cast<long>( reactionIndex ) * a_number];
+
+                for( int i1 = 0; i1 < a_number; ++i1 ) reactionCrossSections[i1] = reactionCrossSection( reactionIndex, a_URR_protareInfos, a_URR_index, 
+                        a_hashIndices[i1], a_temperatures[i1], a_energies[i1] );
+            }
+        }
+        return;
+    }
+
+    HeatedCrossSectionContinuousEnergy const *heatedCrossSections1[MCGIDI_CrossSectionBatchChunkSize];
+    HeatedCrossSectionContinuousEnergy const *heatedCrossSections2[MCGIDI_CrossSectionBatchChunkSize];
+    MCGIDI_StorageType const *totalCrossSections1[MCGIDI_CrossSectionBatchChunkSize];
+    MCGIDI_StorageType const *totalCrossSections2[MCGIDI_CrossSectionBatchChunkSize];
+    int energyIndices1[MCGIDI_CrossSectionBatchChunkSize], energyIndices2[MCGIDI_CrossSectionBatchChunkSize];
+    double energyFractions1[MCGIDI_CrossSectionBatchChunkSize], energyFractions2[MCGIDI_CrossSectionBatchChunkSize];
+    double temperatureFractions[MCGIDI_CrossSectionBatchChunkSize];
+
+    for( int start = 0; start < a_number; start += MCGIDI_CrossSectionBatchChunkSize ) {
+        int size = a_number - start;
+        if( size > MCGIDI_CrossSectionBatchChunkSize ) size = MCGIDI_CrossSectionBatchChunkSize;
+
+        for( int i1 = 0; i1 < size; ++i1 ) {                    // Searches.
+            double temperature = a_temperatures[start+i1];
+            double energy = a_energies[start+i1];
+            int hashIndex = a_hashIndices[start+i1];
+            int temperatureIndex1 = 0, temperatureIndex2 = 0;
+
+            temperatureFractions[i1] = 0.0;
+            if( temperature <= m_temperatures[0] ) { 
+                }
+            else if( temperature >= m_temperatures.back( ) ) {
+                temperatureIndex1 = temperatureIndex2 = number_of_temperatures - 1; }
+            else {
+                for( ; temperatureIndex2 < number_of_temperatures; ++temperatureIndex2 ) if( temperature < m_temperatures[temperatureIndex2] ) break;
+                temperatureIndex1 = temperatureIndex2 - 1;
+                temperatureFractions[i1] = ( temperature - m_temperatures[temperatureIndex1] ) / ( m_temperatures[temperatureIndex2] - m_temperatures[temperatureIndex1] );
+            }
+
+            heatedCrossSections1[i1] = m_heatedCrossSections[temperatureIndex1];
+            heatedCrossSections2[i1] = m_heatedCrossSections[temperatureIndex2];
+            totalCrossSections1[i1] = m_heatedCrossSections[temperatureIndex1]->totalCrossSection( ).begin( );
+            totalCrossSections2[i1] = m_heatedCrossSections[temperatureIndex2]->totalCrossSection( ).begin( );
+            energyIndices1[i1] = heatedCrossSections1[i1]->evaluationInfo( hashIndex, energy, &energyFractions1[i1] );
+            if( temperatureIndex1 == temperatureIndex2 ) {
+                energyIndices2[i1] = energyIndices1[i1];
+                energyFractions2[i1] = energyFractions1[i1]; }
+            else {
+                energyIndices2[i1] = heatedCrossSections2[i1]->evaluationInfo( hashIndex, energy, &energyFractions2[i1] );
+            }
+        }
+
+        double *crossSections = &a_crossSections[start];
+        for( int i1 = 0; i1 < size; ++i1 ) {                    // Interpolation, no branches.
+            MCGIDI_StorageType const *total1 = totalCrossSections1[i1];
+            MCGIDI_StorageType const *total2 = totalCrossSections2[i1];
+            double crossSection1 = energyFractions1[i1] * total1[energyIndices1[i1]] + ( 1.0 - energyFractions1[i1] ) * total1[energyIndices1[i1]+1];
+            double crossSection2 = energyFractions2[i1] * total2[energyIndices2[i1]] + ( 1.0 - energyFractions2[i1] ) * total2[energyIndices2[i1]+1];
+
+            crossSections[i1] = ( 1.0 - temperatureFractions[i1] ) * crossSection1 + temperatureFractions[i1] * crossSection2;
+        }
+
+        if( a_reactionCrossSections != nullptr ) {
+            for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+                double *reactionCrossSections = &a_reactionCrossSections[static_cast<long>( reactionIndex ) * a_number + start];
+
+                for( int i1 = 0; i1 < size; ++i1 ) {
+                    double energy = a_energies[start+i1];
+
+                    reactionCrossSections[i1] = 
+                        ( 1.0 - temperatureFractions[i1] ) * heatedCrossSections1[i1]->reactionCrossSection2( reactionIndex, a_URR_protareInfos, -1, energy, 
+                                energyIndices1[i1], energyFractions1[i1] )
+                        + temperatureFractions[i1] * heatedCrossSections2[i1]->reactionCrossSection2( reactionIndex, a_URR_protareInfos, -1, energy, 
+                                energyIndices2[i1], energyFractions2[i1] );
+                }
+            }
+        }
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the deposition energy for target temperature *a_temperature* and projectile multi-group *a_hashIndex*.
  *
@@ -873,19 +2059,25 @@ HOST_DEVICE int HeatedCrossSectionsContinuousEnergy::sampleReaction( URR_protare
 
 HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionEnergy( int a_hashIndex, double a_temperature, double a_energy ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double deposition_energy;
+    return( depositionEnergy( a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) { 
-        deposition_energy = m_heatedCrossSections[0]->depositionEnergy( a_hashIndex, a_energy ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        deposition_energy = m_heatedCrossSections.back( )->depositionEnergy( a_hashIndex, a_energy ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        deposition_energy = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->depositionEnergy( a_hashIndex, a_energy )
-                            + fraction * m_heatedCrossSections[i1]->depositionEnergy( a_hashIndex, a_energy );
-    }
+/* *********************************************************************************************************//**
+ * Returns the deposition energy using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                [in]    The energy of the projectile.
+ *
+ * @return                              The deposition energy.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionEnergy( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const {
+
+    double deposition_energy = m_heatedCrossSections[a_temperatureContext.index1( )]->depositionEnergy( a_hashIndex, a_energy );
+
+    if( a_temperatureContext.interpolate( ) ) deposition_energy = ( 1. - a_temperatureContext.fraction( ) ) * deposition_energy
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->depositionEnergy( a_hashIndex, a_energy );
 
     return( deposition_energy );
 }
@@ -898,21 +2090,27 @@ HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionEnergy( int a_
  * @param a_energy              [in]    The energy of the projectile.
  ***********************************************************************************************************/
 
-HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const {
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionMomentum( int a_hashIndex, double a_temperature, double a_energy ) const {
+
+    return( depositionMomentum( a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the deposition momentum using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                [in]    The energy of the projectile.
+ *
+ * @return                              The deposition momentum.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionMomentum( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double deposition_momentum;
+    double deposition_momentum = m_heatedCrossSections[a_temperatureContext.index1( )]->depositionMomentum( a_hashIndex, a_energy );
 
-    if( a_temperature <= m_temperatures[0] ) {
-        deposition_momentum = m_heatedCrossSections[0]->depositionMomentum( a_hashIndex, a_energy ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        deposition_momentum = m_heatedCrossSections.back( )->depositionMomentum( a_hashIndex, a_energy ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        deposition_momentum = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->depositionMomentum( a_hashIndex, a_energy )
-                            + fraction * m_heatedCrossSections[i1]->depositionMomentum( a_hashIndex, a_energy );
-    }
+    if( a_temperatureContext.interpolate( ) ) deposition_momentum = ( 1. - a_temperatureContext.fraction( ) ) * deposition_momentum
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->depositionMomentum( a_hashIndex, a_energy );
 
     return( deposition_momentum );
 }
@@ -927,19 +2125,25 @@ HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::depositionMomentum( int
 
 HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::productionEnergy( int a_hashIndex, double a_temperature, double a_energy ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double production_energy;
+    return( productionEnergy( a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        production_energy = m_heatedCrossSections[0]->productionEnergy( a_hashIndex, a_energy ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        production_energy = m_heatedCrossSections.back( )->productionEnergy( a_hashIndex, a_energy ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        production_energy = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->productionEnergy( a_hashIndex, a_energy )
-                            + fraction * m_heatedCrossSections[i1]->productionEnergy( a_hashIndex, a_energy );
-    }
+/* *********************************************************************************************************//**
+ * Returns the production energy using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                [in]    The energy of the projectile.
+ *
+ * @return                              The production energy.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::productionEnergy( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const {
+
+    double production_energy = m_heatedCrossSections[a_temperatureContext.index1( )]->productionEnergy( a_hashIndex, a_energy );
+
+    if( a_temperatureContext.interpolate( ) ) production_energy = ( 1. - a_temperatureContext.fraction( ) ) * production_energy
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->productionEnergy( a_hashIndex, a_energy );
 
     return( production_energy );
 }
@@ -955,21 +2159,29 @@ HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::productionEnergy( int a_
 
 HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::gain( int a_hashIndex, double a_temperature, double a_energy, int a_particleIndex ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double production_energy;
+    return( gain( a_hashIndex, TemperatureContext( m_temperatures, a_temperature ), a_energy, a_particleIndex ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        production_energy = m_heatedCrossSections[0]->gain( a_hashIndex, a_energy, a_particleIndex ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        production_energy = m_heatedCrossSections.back( )->gain( a_hashIndex, a_energy, a_particleIndex ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        production_energy = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->gain( a_hashIndex, a_energy, a_particleIndex )
-                            + fraction * m_heatedCrossSections[i1]->gain( a_hashIndex, a_energy, a_particleIndex );
-    }
+/* *********************************************************************************************************//**
+ * Returns the gain for the particle with index *a_particleIndex* using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The cross section hash index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy                [in]    The energy of the projectile.
+ * @param a_particleIndex         [in]    The index of the particle whose gain is requested.
+ *
+ * @return                              The gain.
+ ***********************************************************************************************************/
 
-    return( production_energy );
+HOST_DEVICE double HeatedCrossSectionsContinuousEnergy::gain( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy,
+                int a_particleIndex ) const {
+
+    double gain = m_heatedCrossSections[a_temperatureContext.index1( )]->gain( a_hashIndex, a_energy, a_particleIndex );
+
+    if( a_temperatureContext.interpolate( ) ) gain = ( 1. - a_temperatureContext.fraction( ) ) * gain
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->gain( a_hashIndex, a_energy, a_particleIndex );
+
+    return( gain );
 }
 
 /* *********************************************************************************************************//**
@@ -996,6 +2208,7 @@ HOST_DEVICE void HeatedCrossSectionsContinuousEnergy::serialize( DataBuffer &a_b
 
     DATA_MEMBER_VECTOR_DOUBLE( m_temperatures, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_thresholds, a_buffer, a_mode );
+    DATA_MEMBER_FLOAT( m_targetMassRatio, a_buffer, a_mode );
 
     MCGIDI_VectorSizeType vectorSize = m_heatedCrossSections.size( );
     int vectorSizeInt = (int) vectorSize;
@@ -1016,7 +2229,7 @@ HOST_DEVICE void HeatedCrossSectionsContinuousEnergy::serialize( DataBuffer &a_b
         if( a_mode == DataBuffer::Mode::Memory ) {
             a_buffer.incrementPlacement( sizeof( HeatedCrossSectionContinuousEnergy ) );
         }
-        m_heatedCrossSections[memberIndex]->serialize( a_buffer, a_mode );
+        m_heatedCrossSections[memberIndex]->serialize( a_buffer, a_mode, m_heatedCrossSections.begin( ) );
     }
 }
 
@@ -1044,6 +2257,22 @@ HOST MultiGroupGain::MultiGroupGain( int a_particleIndex, GIDI::Vector const &a_
 
 }
 
+/* *********************************************************************************************************//**
+ * Constructs the gain linearly interpolated between *a_multiGroupGain1* and *a_multiGroupGain2* which must be for the same particle.
+ *
+ * @param a_multiGroupGain1     [in]    The gain at the lower temperature.
+ * @param a_multiGroupGain2     [in]    The gain at the upper temperature.
+ * @param a_fraction            [in]    The interpolation weight of *a_multiGroupGain2*.
+ ***********************************************************************************************************/
+
+HOST MultiGroupGain::MultiGroupGain( MultiGroupGain const &a_multiGroupGain1, MultiGroupGain const &a_multiGroupGain2, double a_fraction ) :
+        m_particleIndex( a_multiGroupGain1.particleIndex( ) ),
+        m_userParticleIndex( a_multiGroupGain1.userParticleIndex( ) ) {
+
+    if( a_multiGroupGain1.particleIndex( ) != a_multiGroupGain2.particleIndex( ) ) THROW( "MultiGroupGain::MultiGroupGain: particle indices differ." );
+    interpolateMultiGroupVectors( a_multiGroupGain1.gain( ), a_multiGroupGain2.gain( ), a_fraction, m_gain );
+}
+
 /* *********************************************************************************************************//**
  * @param a_multiGroupGain      [in]    The **MultiGroupGain** whose contents are to be copied.
  ***********************************************************************************************************/
@@ -1115,6 +2344,26 @@ HOST HeatedReactionCrossSectionMultiGroup::HeatedReactionCrossSectionMultiGroup(
     }
 }
 
+/* *********************************************************************************************************//**
+ * Constructs the reaction cross section linearly interpolated between *a_reactionCrossSection1* and *a_reactionCrossSection2*.
+ * The two must have the same threshold group.
+ *
+ * @param a_reactionCrossSection1   [in]    The reaction cross section at the lower temperature.
+ * @param a_reactionCrossSection2   [in]    The reaction cross section at the upper temperature.
+ * @param a_fraction                [in]    The interpolation weight of *a_reactionCrossSection2*.
+ ***********************************************************************************************************/
+
+HOST HeatedReactionCrossSectionMultiGroup::HeatedReactionCrossSectionMultiGroup( HeatedReactionCrossSectionMultiGroup const &a_reactionCrossSection1, 
+                HeatedReactionCrossSectionMultiGroup const &a_reactionCrossSection2, double a_fraction ) :
+        m_threshold( a_reactionCrossSection1.threshold( ) ),
+        m_offset( a_reactionCrossSection1.offset( ) ),
+        m_augmentedThresholdCrossSection( ( 1.0 - a_fraction ) * a_reactionCrossSection1.augmentedThresholdCrossSection( ) 
+                + a_fraction * a_reactionCrossSection2.augmentedThresholdCrossSection( ) ) {
+
+    if( a_reactionCrossSection1.offset( ) != a_reactionCrossSection2.offset( ) ) THROW( "HeatedReactionCrossSectionMultiGroup::HeatedReactionCrossSectionMultiGroup: offsets differ." );
+    interpolateMultiGroupVectors( a_reactionCrossSection1.m_crossSection, a_reactionCrossSection2.m_crossSection, a_fraction, m_crossSection );
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
@@ -1160,7 +2409,8 @@ HOST HeatedCrossSectionMultiGroup::HeatedCrossSectionMultiGroup( GIDI::ProtareSi
                 GIDI::Transporting::Particles const &a_particles, std::vector<GIDI::Reaction const *> const &a_reactions, std::string const &a_label ) :
         m_totalCrossSection( ),
         m_augmentedCrossSection( ),
-        m_reactionCrossSections( ) {
+        m_reactionCrossSections( ),
+        m_cumulativeReactionCrossSections( ) {
 
     GIDI::Transporting::MG multi_group_settings( a_settings.projectileID( ), GIDI::Transporting::Mode::multiGroup, a_settings.delayedNeutrons( ) );
 
@@ -1198,6 +2448,8 @@ HOST HeatedCrossSectionMultiGroup::HeatedCrossSectionMultiGroup( GIDI::ProtareSi
     for( MCGIDI_VectorSizeType i1 = 0; i1 < m_reactionCrossSections.size( ); ++i1 )
         m_augmentedCrossSection[m_reactionCrossSections[i1]->offset( )] += m_reactionCrossSections[i1]->augmentedThresholdCrossSection( );
 
+    setCumulativeReactionCrossSections( );
+
     vector = a_protare.multiGroupDepositionEnergy( multi_group_settings, a_temperatureInfo, a_particles );
     vector = GIDI::collapse( vector, a_settings, a_particles, 0.0 );
     m_depositionEnergy = GIDI_VectorDoublesToMCGIDI_VectorDoubles( vector );
@@ -1222,6 +2474,45 @@ HOST HeatedCrossSectionMultiGroup::HeatedCrossSectionMultiGroup( GIDI::ProtareSi
     }
 }
 
+/* *********************************************************************************************************//**
+ * Constructs the multi-group data linearly interpolated between *a_heatedCrossSection1* and *a_heatedCrossSection2*, which must be for
+ * the same reactions and particles. This is the same interpolation done by the HeatedCrossSectionsMultiGroup methods that take a
+ * temperature, so that the result can be looked up with no interpolation.
+ *
+ * @param a_heatedCrossSection1     [in]    The data at the lower temperature.
+ * @param a_heatedCrossSection2     [in]    The data at the upper temperature.
+ * @param a_fraction                [in]    The interpolation weight of *a_heatedCrossSection2*.
+ ***********************************************************************************************************/
+
+HOST HeatedCrossSectionMultiGroup::HeatedCrossSectionMultiGroup( HeatedCrossSectionMultiGroup const &a_heatedCrossSection1, 
+                HeatedCrossSectionMultiGroup const &a_heatedCrossSection2, double a_fraction ) :
+        m_totalCrossSection( ),
+        m_augmentedCrossSection( ),
+        m_reactionCrossSections( ),
+        m_cumulativeReactionCrossSections( ) {
+
+    interpolateMultiGroupVectors( a_heatedCrossSection1.m_totalCrossSection, a_heatedCrossSection2.m_totalCrossSection, a_fraction, m_totalCrossSection );
+    interpolateMultiGroupVectors( a_heatedCrossSection1.m_augmentedCrossSection, a_heatedCrossSection2.m_augmentedCrossSection, a_fraction, m_augmentedCrossSection );
+    interpolateMultiGroupVectors( a_heatedCrossSection1.m_depositionEnergy, a_heatedCrossSection2.m_depositionEnergy, a_fraction, m_depositionEnergy );
+    interpolateMultiGroupVectors( a_heatedCrossSection1.m_depositionMomentum, a_heatedCrossSection2.m_depositionMomentum, a_fraction, m_depositionMomentum );
+    interpolateMultiGroupVectors( a_heatedCrossSection1.m_productionEnergy, a_heatedCrossSection2.m_productionEnergy, a_fraction, m_productionEnergy );
+
+    if( a_heatedCrossSection1.m_gains.size( ) != a_heatedCrossSection2.m_gains.size( ) ) THROW( "HeatedCrossSectionMultiGroup::HeatedCrossSectionMultiGroup: number of gains differ." );
+    m_gains.resize( a_heatedCrossSection1.m_gains.size( ) );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < m_gains.size( ); ++i1 ) {
+        m_gains[i1] = MultiGroupGain( a_heatedCrossSection1.m_gains[i1], a_heatedCrossSection2.m_gains[i1], a_fraction );
+    }
+
+    if( a_heatedCrossSection1.numberOfReactions( ) != a_heatedCrossSection2.numberOfReactions( ) ) 
+        THROW( "HeatedCrossSectionMultiGroup::HeatedCrossSectionMultiGroup: number of reactions differ." );
+    m_reactionCrossSections.resize( a_heatedCrossSection1.numberOfReactions( ) );
+    for( int i1 = 0; i1 < a_heatedCrossSection1.numberOfReactions( ); ++i1 ) {
+        m_reactionCrossSections[i1] = new HeatedReactionCrossSectionMultiGroup( *a_heatedCrossSection1[i1], *a_heatedCrossSection2[i1], a_fraction );
+    }
+
+    setCumulativeReactionCrossSections( );
+}
+
 /* *********************************************************************************************************//**
  ***********************************************************************************************************/
 
@@ -1230,6 +2521,27 @@ HOST_DEVICE HeatedCrossSectionMultiGroup::~HeatedCrossSectionMultiGroup( ) {
     for( Vector<HeatedReactionCrossSectionMultiGroup *>::const_iterator iter = m_reactionCrossSections.begin( ); iter < m_reactionCrossSections.end( ); ++iter ) delete *iter;
 }
 
+/* *********************************************************************************************************//**
+ * Sets *m_cumulativeReactionCrossSections* from the reaction sampling cross sections.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionMultiGroup::setCumulativeReactionCrossSections( ) {
+
+    int number_of_reactions = numberOfReactions( );
+    MCGIDI_VectorSizeType number_of_groups = m_totalCrossSection.size( );
+
+    m_cumulativeReactionCrossSections.resize( number_of_groups * number_of_reactions, 0.0 );
+    for( MCGIDI_VectorSizeType group_index = 0; group_index < number_of_groups; ++group_index ) {
+        double *cumulative_cross_sections = &m_cumulativeReactionCrossSections[group_index * number_of_reactions];
+        double cumulative_cross_section = 0.0;
+
+        for( int reaction_index = 0; reaction_index < number_of_reactions; ++reaction_index ) {
+            cumulative_cross_section += m_reactionCrossSections[reaction_index]->crossSection( group_index, true );
+            cumulative_cross_sections[reaction_index] = cumulative_cross_section;
+        }
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the multi-group cross section.
  *
@@ -1266,6 +2578,33 @@ HOST_DEVICE double HeatedCrossSectionMultiGroup::gain( int a_particleIndex, int
     return( 0.0 );
 }
 
+/* *********************************************************************************************************//**
+ * Adds the cross sections of all reactions at groups *a_groupBegin* up to but not including *a_groupEnd*, multiplied by *a_factor*, to
+ * *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at *a_reactionCrossSectionVectors* +
+ * *reactionIndex* * *a_numberAllocated*. The augmented threshold cross sections are not included.
+ *
+ * @param   a_factor                        [in]        The factor all cross sections are multiplied by.
+ * @param   a_groupBegin                    [in]        The first multi-group index to add.
+ * @param   a_groupEnd                      [in]        One past the last multi-group index to add.
+ * @param   a_numberAllocated               [in]        The length of each reaction's vector.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The reaction cross section vectors to add cross section data to.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionMultiGroup::addReactionCrossSectionVectors( double a_factor, int a_groupBegin, int a_groupEnd, int a_numberAllocated, 
+                double *a_reactionCrossSectionVectors ) const {
+
+    for( int reaction_index = 0; reaction_index < numberOfReactions( ); ++reaction_index ) {
+        HeatedReactionCrossSectionMultiGroup const &reaction = *m_reactionCrossSections[reaction_index];
+        Vector<double> const &cross_sections = reaction.crossSections( );
+        double *vector = &a_reactionCrossSectionVectors[reaction_index * a_numberAllocated];
+        int offset = reaction.offset( );
+        int begin = std::max( a_groupBegin, offset );
+        int end = std::min( a_groupEnd, offset + static_cast<int>( cross_sections.size( ) ) );
+
+        for( int group_index = begin; group_index < end; ++group_index ) vector[group_index] += a_factor * cross_sections[group_index - offset];
+    }
+}
+
 /* *********************************************************************************************************//**
  * Updates the m_userParticleIndex to *a_userParticleIndex* for all particles with PoPs index *a_particleIndex*.
  *
@@ -1293,6 +2632,7 @@ HOST_DEVICE void HeatedCrossSectionMultiGroup::serialize( DataBuffer &a_buffer,
     DATA_MEMBER_VECTOR_DOUBLE( m_depositionEnergy, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_depositionMomentum, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_productionEnergy, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_cumulativeReactionCrossSections, a_buffer, a_mode );
 
     MCGIDI_VectorSizeType vectorSize = m_reactionCrossSections.size( );
     int vectorSizeInt = (int) vectorSize;
@@ -1406,6 +2746,70 @@ HOST void HeatedCrossSectionsMultiGroup::update( GIDI::ProtareSingle const &a_pr
     m_projectileMultiGroupBoundariesCollapsed = a_setupInfo.m_protare.projectileMultiGroupBoundariesCollapsed( );
 }
 
+/* *********************************************************************************************************//**
+ * Stores the data interpolated to each temperature in *a_temperatures* so that later look ups at any of these temperatures are done with
+ * no interpolation. Temperatures that do not require interpolation (i.e., a temperature of the data or one outside their temperature range)
+ * are ignored. Any user temperatures from a prior call are removed.
+ *
+ * @param a_temperatures        [in]    The list of user temperatures.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionsMultiGroup::setUserTemperatures( std::vector<double> const &a_temperatures ) {
+
+    std::vector<double> temperatures( a_temperatures );
+    std::sort( temperatures.begin( ), temperatures.end( ) );
+    temperatures.erase( std::unique( temperatures.begin( ), temperatures.end( ) ), temperatures.end( ) );
+
+    std::vector<double> userTemperatures;
+    std::vector<HeatedCrossSectionMultiGroup *> heatedCrossSections;
+    for( std::vector<double>::const_iterator iter = temperatures.begin( ); iter != temperatures.end( ); ++iter ) {
+        TemperatureContext temperatureContext( m_temperatures, *iter );
+
+        if( !temperatureContext.interpolate( ) || ( temperatureContext.fraction( ) == 0.0 ) ) continue;
+        userTemperatures.push_back( *iter );
+        heatedCrossSections.push_back( new HeatedCrossSectionMultiGroup( *m_heatedCrossSections[temperatureContext.index1( )], 
+                *m_heatedCrossSections[temperatureContext.index2( )], temperatureContext.fraction( ) ) );
+    }
+
+    MCGIDI_VectorSizeType numberOfTemperatures = m_temperatures.size( );
+    for( MCGIDI_VectorSizeType i1 = numberOfTemperatures; i1 < m_heatedCrossSections.size( ); ++i1 ) delete m_heatedCrossSections[i1];
+
+    Vector<HeatedCrossSectionMultiGroup *> allHeatedCrossSections( numberOfTemperatures + heatedCrossSections.size( ) );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < numberOfTemperatures; ++i1 ) allHeatedCrossSections[i1] = m_heatedCrossSections[i1];
+    for( std::size_t i1 = 0; i1 < heatedCrossSections.size( ); ++i1 ) allHeatedCrossSections[numberOfTemperatures+i1] = heatedCrossSections[i1];
+    m_heatedCrossSections.swap( allHeatedCrossSections );
+
+    m_userTemperatures = userTemperatures;
+}
+
+/* *********************************************************************************************************//**
+ * Returns a TemperatureContext for target temperature *a_temperature*. If *a_temperature* is one of the user temperatures,
+ * the context refers to its stored data and no interpolation is done.
+ *
+ * @param a_temperature         [in]    The temperature of the target.
+ *
+ * @return                              The temperature indices and interpolation fraction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE TemperatureContext HeatedCrossSectionsMultiGroup::temperatureContext( double a_temperature ) const {
+
+    int lower = 0, upper = static_cast<int>( m_userTemperatures.size( ) );
+
+    while( lower < upper ) {
+        int middle = ( lower + upper ) / 2;
+
+        if( m_userTemperatures[middle] < a_temperature ) {
+            lower = middle + 1; }
+        else {
+            upper = middle;
+        }
+    }
+    if( ( lower < static_cast<int>( m_userTemperatures.size( ) ) ) && ( m_userTemperatures[lower] == a_temperature ) )
+        return( TemperatureContext( static_cast<int>( m_temperatures.size( ) ) + lower, a_temperature ) );
+
+    return( TemperatureContext( m_temperatures, a_temperature ) );
+}
+
 /* *********************************************************************************************************//**
  * Returns the total multi-group cross section for target temperature *a_temperature* and projectile multi-group *a_hashIndex*.
  *
@@ -1416,20 +2820,25 @@ HOST void HeatedCrossSectionsMultiGroup::update( GIDI::ProtareSingle const &a_pr
 
 HOST_DEVICE double HeatedCrossSectionsMultiGroup::crossSection( int a_hashIndex, double a_temperature, bool a_sampling ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double cross_section;
+    return( crossSection( a_hashIndex, temperatureContext( a_temperature ), a_sampling ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        cross_section = m_heatedCrossSections[0]->crossSection( a_hashIndex, a_sampling ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        cross_section = m_heatedCrossSections.back( )->crossSection( a_hashIndex, a_sampling ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
+/* *********************************************************************************************************//**
+ * Returns the total multi-group cross section using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The multi-group index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_sampling              [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ *
+ * @return                              The total multi-group cross section.
+ ***********************************************************************************************************/
 
-        cross_section = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->crossSection( a_hashIndex, a_sampling )
-                        + fraction * m_heatedCrossSections[i1]->crossSection( a_hashIndex, a_sampling );
-    }
+HOST_DEVICE double HeatedCrossSectionsMultiGroup::crossSection( int a_hashIndex, TemperatureContext const &a_temperatureContext, bool a_sampling ) const {
+
+    double cross_section = m_heatedCrossSections[a_temperatureContext.index1( )]->crossSection( a_hashIndex, a_sampling );
+
+    if( a_temperatureContext.interpolate( ) ) cross_section = ( 1. - a_temperatureContext.fraction( ) ) * cross_section
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->crossSection( a_hashIndex, a_sampling );
 
     return( cross_section );
 }
@@ -1446,25 +2855,11 @@ HOST_DEVICE double HeatedCrossSectionsMultiGroup::crossSection( int a_hashIndex,
 HOST_DEVICE void HeatedCrossSectionsMultiGroup::crossSectionVector( double a_temperature, double a_userFactor, int a_numberAllocated, 
         double *a_crossSectionVector ) const {
 
-    int number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    int index1 = 0, index2 = 0;
-    double fraction = 0.0;
-
-    if( a_temperature <= m_temperatures[0] ) { 
-        }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        index1 = index2 = number_of_temperatures - 1;
-        fraction = 1.0; }
-    else {
-        for( ; index2 < number_of_temperatures; ++index2 ) if( a_temperature < m_temperatures[index2] ) break;
-        index1 = index2 - 1;
-        fraction = ( a_temperature - m_temperatures[index1] ) / ( m_temperatures[index2] - m_temperatures[index1] );
-    }
-
-    Vector<double> &totalCrossSection1 = m_heatedCrossSections[index1]->totalCrossSection( );
-    Vector<double> &totalCrossSection2 = m_heatedCrossSections[index2]->totalCrossSection( );
+    TemperatureContext temperatureContext = HeatedCrossSectionsMultiGroup::temperatureContext( a_temperature );
+    Vector<double> &totalCrossSection1 = m_heatedCrossSections[temperatureContext.index1( )]->totalCrossSection( );
+    Vector<double> &totalCrossSection2 = m_heatedCrossSections[temperatureContext.index2( )]->totalCrossSection( );
     MCGIDI_VectorSizeType size = totalCrossSection1.size( );
-    double factor1 = a_userFactor * ( 1.0 - fraction ), factor2 = a_userFactor * fraction;
+    double factor1 = a_userFactor * ( 1.0 - temperatureContext.fraction( ) ), factor2 = a_userFactor * temperatureContext.fraction( );
 
     if( a_numberAllocated < totalCrossSection1.size( ) ) THROW( "HeatedCrossSectionsMultiGroup::crossSectionVector: a_numberAllocated too small." );
     for( MCGIDI_VectorSizeType i1 = 0; i1 < size; ++i1 ) {
@@ -1472,6 +2867,79 @@ HOST_DEVICE void HeatedCrossSectionsMultiGroup::crossSectionVector( double a_tem
     }
 }
 
+/* *********************************************************************************************************//**
+ * Adds the energy dependent, total cross section for each temperature in *a_temperatures* multiplied by *a_userFactor* to *a_crossSectionVectors*.
+ * The vector for the temperature at index *temperatureIndex* starts at *a_crossSectionVectors* + *temperatureIndex* * *a_numberAllocated*.
+ * The multi-group grid is split into *a_numberOfThreads* ranges which are filled in parallel.
+ *
+ * @param   a_numberOfTemperatures          [in]        The number of temperatures in *a_temperatures*.
+ * @param   a_temperatures                  [in]        The temperatures of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each temperature in *a_crossSectionVectors*.
+ * @param   a_crossSectionVectors           [in/out]    The energy dependent, total cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionsMultiGroup::crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const {
+
+    int size = static_cast<int>( m_heatedCrossSections[0]->totalCrossSection( ).size( ) );
+    std::vector<double const *> totalCrossSections1( a_numberOfTemperatures ), totalCrossSections2( a_numberOfTemperatures );
+    std::vector<double> factors1( a_numberOfTemperatures ), factors2( a_numberOfTemperatures );
+
+    if( a_numberAllocated < size ) THROW( "HeatedCrossSectionsMultiGroup::crossSectionVectors: a_numberAllocated too small." );
+    if( size == 0 ) return;
+    for( int i1 = 0; i1 < a_numberOfTemperatures; ++i1 ) {
+        TemperatureContext temperatureContext = HeatedCrossSectionsMultiGroup::temperatureContext( a_temperatures[i1] );
+
+        totalCrossSections1[i1] = &m_heatedCrossSections[temperatureContext.index1( )]->totalCrossSection( )[0];
+        totalCrossSections2[i1] = &m_heatedCrossSections[temperatureContext.index2( )]->totalCrossSection( )[0];
+        factors1[i1] = a_userFactor * ( 1.0 - temperatureContext.fraction( ) );
+        factors2[i1] = a_userFactor * temperatureContext.fraction( );
+    }
+
+    crossSectionVectorRanges( size, a_numberOfThreads, [&]( int a_begin, int a_end ) {
+        for( int i1 = 0; i1 < a_numberOfTemperatures; ++i1 ) {
+            double const *totalCrossSection1 = totalCrossSections1[i1];
+            double const *totalCrossSection2 = totalCrossSections2[i1];
+            double *crossSectionVector = &a_crossSectionVectors[i1 * a_numberAllocated];
+            double factor1 = factors1[i1], factor2 = factors2[i1];
+
+            for( int i2 = a_begin; i2 < a_end; ++i2 ) crossSectionVector[i2] += factor1 * totalCrossSection1[i2] + factor2 * totalCrossSection2[i2];
+        }
+    } );
+}
+
+/* *********************************************************************************************************//**
+ * Adds the energy dependent cross section of each reaction for temperature *a_temperature* multiplied by *a_userFactor* to
+ * *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at *a_reactionCrossSectionVectors* +
+ * *reactionIndex* * *a_numberAllocated*. The multi-group grid is split into *a_numberOfThreads* ranges which are filled in parallel.
+ *
+ * @param   a_temperature                   [in]        Specifies the temperature of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each reaction in *a_reactionCrossSectionVectors*.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The energy dependent, reaction cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void HeatedCrossSectionsMultiGroup::reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, 
+                double *a_reactionCrossSectionVectors, int a_numberOfThreads ) const {
+
+    TemperatureContext temperatureContext = HeatedCrossSectionsMultiGroup::temperatureContext( a_temperature );
+    HeatedCrossSectionMultiGroup const *heatedCrossSection1 = m_heatedCrossSections[temperatureContext.index1( )];
+    HeatedCrossSectionMultiGroup const *heatedCrossSection2 = m_heatedCrossSections[temperatureContext.index2( )];
+    int size = static_cast<int>( m_heatedCrossSections[temperatureContext.index1( )]->totalCrossSection( ).size( ) );
+    double factor1 = a_userFactor * ( 1.0 - temperatureContext.fraction( ) ), factor2 = a_userFactor * temperatureContext.fraction( );
+
+    if( a_numberAllocated < size ) THROW( "HeatedCrossSectionsMultiGroup::reactionCrossSectionVectors: a_numberAllocated too small." );
+
+    crossSectionVectorRanges( size, a_numberOfThreads, [&]( int a_begin, int a_end ) {
+        heatedCrossSection1->addReactionCrossSectionVectors( factor1, a_begin, a_end, a_numberAllocated, a_reactionCrossSectionVectors );
+        if( temperatureContext.interpolate( ) )
+            heatedCrossSection2->addReactionCrossSectionVectors( factor2, a_begin, a_end, a_numberAllocated, a_reactionCrossSectionVectors );
+    } );
+}
+
 /* *********************************************************************************************************//**
  * Returns the requested reaction's multi-group cross section for target temperature *a_temperature* and projectile multi-group *a_hashIndex*.
  *
@@ -1483,19 +2951,27 @@ HOST_DEVICE void HeatedCrossSectionsMultiGroup::crossSectionVector( double a_tem
 
 HOST_DEVICE double HeatedCrossSectionsMultiGroup::reactionCrossSection( int a_reactionIndex, int a_hashIndex, double a_temperature, bool a_sampling ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double cross_section;
+    return( reactionCrossSection( a_reactionIndex, a_hashIndex, temperatureContext( a_temperature ), a_sampling ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        cross_section = m_heatedCrossSections[0]->reactionCrossSection( a_reactionIndex, a_hashIndex, a_sampling ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        cross_section = m_heatedCrossSections.back( )->reactionCrossSection( a_reactionIndex, a_hashIndex, a_sampling ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        cross_section = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->reactionCrossSection( a_reactionIndex, a_hashIndex, a_sampling )
-                            + fraction * m_heatedCrossSections[i1]->reactionCrossSection( a_reactionIndex, a_hashIndex, a_sampling );
-    }
+/* *********************************************************************************************************//**
+ * Returns the multi-group cross section for the reaction at index *a_reactionIndex* using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_reactionIndex         [in]    The index of the reaction.
+ * @param a_hashIndex             [in]    The multi-group index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_sampling              [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ *
+ * @return                              The multi-group cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsMultiGroup::reactionCrossSection( int a_reactionIndex, int a_hashIndex,
+                TemperatureContext const &a_temperatureContext, bool a_sampling ) const {
+
+    double cross_section = m_heatedCrossSections[a_temperatureContext.index1( )]->reactionCrossSection( a_reactionIndex, a_hashIndex, a_sampling );
+
+    if( a_temperatureContext.interpolate( ) ) cross_section = ( 1. - a_temperatureContext.fraction( ) ) * cross_section
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->reactionCrossSection( a_reactionIndex, a_hashIndex, a_sampling );
 
     return( cross_section );
 }
@@ -1534,40 +3010,42 @@ HOST_DEVICE double HeatedCrossSectionsMultiGroup::reactionCrossSection( int a_re
 HOST_DEVICE int HeatedCrossSectionsMultiGroup::sampleReaction( int a_hashIndex, double a_temperature, double a_energy, double a_crossSection, 
                 double (*a_userrng)( void * ), void *a_rngState ) const {
 
-    int i1, sampled_reaction_index, temperatureIndex1, temperatureIndex2, numberOfTemperatures = static_cast<int>( m_temperatures.size( ) );
-    double sampleCrossSection = a_crossSection * a_userrng( a_rngState );
-
-    if( a_temperature <= m_temperatures[0] ) {
-        temperatureIndex1 = 0;
-        temperatureIndex2 = temperatureIndex1; }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        temperatureIndex1 = static_cast<int>( m_temperatures.size( ) ) - 1;
-        temperatureIndex2 = temperatureIndex1; }
-    else {
-        for( i1 = 0; i1 < numberOfTemperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        temperatureIndex1 = i1 - 1;
-        temperatureIndex2 = i1;
-    }
+    return( sampleReaction( a_hashIndex, temperatureContext( a_temperature ), a_energy, a_crossSection, a_userrng, a_rngState ) );
+}
 
-    int numberOfReactions = m_heatedCrossSections[0]->numberOfReactions( );
-    double crossSectionSum = 0;
-    HeatedCrossSectionMultiGroup &heatedCrossSection1 = *m_heatedCrossSections[temperatureIndex1];
+/* *********************************************************************************************************//**
+ * Returns the index of a sampled reaction using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex           [in]    The multi-group index.
+ * @param a_temperatureContext  [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_crossSection        [in]    The total cross section.
+ * @param a_userrng             [in]    A random number generator that takes the state *a_rngState* and returns a double in the range [0.0, 1.0).
+ * @param a_rngState            [in]    The current state for the random number generator.
+ *
+ * @return                              The index of the sampled reaction or MCGIDI_nullReaction.
+ ***********************************************************************************************************/
 
-    if( temperatureIndex1 == temperatureIndex2 ) {
-        for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
-            crossSectionSum += heatedCrossSection1.reactionCrossSection( sampled_reaction_index, a_hashIndex, true );
-            if( crossSectionSum >= sampleCrossSection ) break;
-        } }
-    else {
-        double temperatureFraction2 = ( a_temperature - m_temperatures[temperatureIndex1] ) / ( m_temperatures[temperatureIndex2] - m_temperatures[temperatureIndex1] );
-        double temperatureFraction1 = 1.0 - temperatureFraction2;
-        HeatedCrossSectionMultiGroup &heatedCrossSection2 = *m_heatedCrossSections[temperatureIndex2];
+HOST_DEVICE int HeatedCrossSectionsMultiGroup::sampleReaction( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy, 
+                double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const {
 
-        for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
-            if( m_thresholds[sampled_reaction_index] >= a_energy ) continue;
-            crossSectionSum += temperatureFraction1 * heatedCrossSection1.reactionCrossSection( sampled_reaction_index, a_hashIndex, true );
-            crossSectionSum += temperatureFraction2 * heatedCrossSection2.reactionCrossSection( sampled_reaction_index, a_hashIndex, true );
-            if( crossSectionSum >= sampleCrossSection ) break;
+    double sampleCrossSection = a_crossSection * a_userrng( a_rngState );
+    int numberOfReactions = m_heatedCrossSections[0]->numberOfReactions( );
+    double temperatureFraction2 = a_temperatureContext.fraction( );
+    double temperatureFraction1 = 1.0 - temperatureFraction2;
+    double const *cumulative1 = m_heatedCrossSections[a_temperatureContext.index1( )]->cumulativeReactionCrossSectionsAt( a_hashIndex );
+    double const *cumulative2 = m_heatedCrossSections[a_temperatureContext.index2( )]->cumulativeReactionCrossSectionsAt( a_hashIndex );
+
+// Binary search for the first reaction whose cumulative cross section is not less than sampleCrossSection. A reaction whose threshold is
+// above a_energy is rejected below, as its threshold is in group a_hashIndex.
+    int sampled_reaction_index = 0, upper = numberOfReactions;
+    while( sampled_reaction_index < upper ) {
+        int middle = ( sampled_reaction_index + upper ) / 2;
+
+        if( temperatureFraction1 * cumulative1[middle] + temperatureFraction2 * cumulative2[middle] >= sampleCrossSection ) {
+            upper = middle; }
+        else {
+            sampled_reaction_index = middle + 1;
         }
     }
 
@@ -1594,19 +3072,24 @@ HOST_DEVICE int HeatedCrossSectionsMultiGroup::sampleReaction( int a_hashIndex,
 
 HOST_DEVICE double HeatedCrossSectionsMultiGroup::depositionEnergy( int a_hashIndex, double a_temperature ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double deposition_energy;
+    return( depositionEnergy( a_hashIndex, temperatureContext( a_temperature ) ) );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the multi-group deposition energy using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The multi-group index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ *
+ * @return                              The multi-group deposition energy.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsMultiGroup::depositionEnergy( int a_hashIndex, TemperatureContext const &a_temperatureContext ) const {
 
-    if( a_temperature <= m_temperatures[0] ) {
-        deposition_energy = m_heatedCrossSections[0]->depositionEnergy( a_hashIndex ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        deposition_energy = m_heatedCrossSections.back( )->depositionEnergy( a_hashIndex ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        deposition_energy = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->depositionEnergy( a_hashIndex )
-                            + fraction * m_heatedCrossSections[i1]->depositionEnergy( a_hashIndex );
-    }
+    double deposition_energy = m_heatedCrossSections[a_temperatureContext.index1( )]->depositionEnergy( a_hashIndex );
+
+    if( a_temperatureContext.interpolate( ) ) deposition_energy = ( 1. - a_temperatureContext.fraction( ) ) * deposition_energy
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->depositionEnergy( a_hashIndex );
 
     return( deposition_energy );
 }
@@ -1622,19 +3105,24 @@ HOST_DEVICE double HeatedCrossSectionsMultiGroup::depositionEnergy( int a_hashIn
 
 HOST_DEVICE double HeatedCrossSectionsMultiGroup::depositionMomentum( int a_hashIndex, double a_temperature ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double deposition_momentum;
+    return( depositionMomentum( a_hashIndex, temperatureContext( a_temperature ) ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        deposition_momentum = m_heatedCrossSections[0]->depositionMomentum( a_hashIndex ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        deposition_momentum = m_heatedCrossSections.back( )->depositionMomentum( a_hashIndex ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
-        deposition_momentum = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->depositionMomentum( a_hashIndex )
-                            + fraction * m_heatedCrossSections[i1]->depositionMomentum( a_hashIndex );
-    }
+/* *********************************************************************************************************//**
+ * Returns the multi-group deposition momentum using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The multi-group index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ *
+ * @return                              The multi-group deposition momentum.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsMultiGroup::depositionMomentum( int a_hashIndex, TemperatureContext const &a_temperatureContext ) const {
+
+    double deposition_momentum = m_heatedCrossSections[a_temperatureContext.index1( )]->depositionMomentum( a_hashIndex );
+
+    if( a_temperatureContext.interpolate( ) ) deposition_momentum = ( 1. - a_temperatureContext.fraction( ) ) * deposition_momentum
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->depositionMomentum( a_hashIndex );
 
     return( deposition_momentum );
 }
@@ -1650,20 +3138,24 @@ HOST_DEVICE double HeatedCrossSectionsMultiGroup::depositionMomentum( int a_hash
 
 HOST_DEVICE double HeatedCrossSectionsMultiGroup::productionEnergy( int a_hashIndex, double a_temperature ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
-    double production_energy;
+    return( productionEnergy( a_hashIndex, temperatureContext( a_temperature ) ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        production_energy = m_heatedCrossSections[0]->productionEnergy( a_hashIndex ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        production_energy = m_heatedCrossSections.back( )->productionEnergy( a_hashIndex ); }
-    else {
-        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-        double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
+/* *********************************************************************************************************//**
+ * Returns the multi-group production energy using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The multi-group index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ *
+ * @return                              The multi-group production energy.
+ ***********************************************************************************************************/
 
-        production_energy = ( 1. - fraction ) * m_heatedCrossSections[i1-1]->productionEnergy( a_hashIndex )
-                            + fraction * m_heatedCrossSections[i1]->productionEnergy( a_hashIndex );
-    }
+HOST_DEVICE double HeatedCrossSectionsMultiGroup::productionEnergy( int a_hashIndex, TemperatureContext const &a_temperatureContext ) const {
+
+    double production_energy = m_heatedCrossSections[a_temperatureContext.index1( )]->productionEnergy( a_hashIndex );
+
+    if( a_temperatureContext.interpolate( ) ) production_energy = ( 1. - a_temperatureContext.fraction( ) ) * production_energy
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->productionEnergy( a_hashIndex );
 
     return( production_energy );
 }
@@ -1680,21 +3172,27 @@ HOST_DEVICE double HeatedCrossSectionsMultiGroup::productionEnergy( int a_hashIn
 
 HOST_DEVICE double HeatedCrossSectionsMultiGroup::gain( int a_hashIndex, double a_temperature, int a_particleIndex ) const {
 
-    int i1, number_of_temperatures = static_cast<int>( m_temperatures.size( ) );
+    return( gain( a_hashIndex, temperatureContext( a_temperature ), a_particleIndex ) );
+}
 
-    if( a_temperature <= m_temperatures[0] ) {
-        return( m_heatedCrossSections[0]->gain( a_particleIndex, a_hashIndex ) ); }
-    else if( a_temperature >= m_temperatures.back( ) ) {
-        return( m_heatedCrossSections.back( )->gain( a_particleIndex, a_hashIndex ) );
-    }
+/* *********************************************************************************************************//**
+ * Returns the multi-group gain for the particle with index *a_particleIndex* using the temperature interpolation data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex             [in]    The multi-group index.
+ * @param a_temperatureContext    [in]    The temperature indices and interpolation fraction for the target temperature.
+ * @param a_particleIndex         [in]    The index of the particle whose gain is requested.
+ *
+ * @return                              The multi-group gain.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double HeatedCrossSectionsMultiGroup::gain( int a_hashIndex, TemperatureContext const &a_temperatureContext, int a_particleIndex ) const {
 
-    for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < m_temperatures[i1] ) break;
-    double fraction = ( a_temperature - m_temperatures[i1-1] ) / ( m_temperatures[i1] - m_temperatures[i1-1] );
+    double gain = m_heatedCrossSections[a_temperatureContext.index1( )]->gain( a_particleIndex, a_hashIndex );
 
-    double gain1 = m_heatedCrossSections[i1-1]->gain( a_particleIndex, a_hashIndex );
-    double gain2 = m_heatedCrossSections[i1]->gain( a_particleIndex, a_hashIndex );
+    if( a_temperatureContext.interpolate( ) ) gain = ( 1. - a_temperatureContext.fraction( ) ) * gain
+            + a_temperatureContext.fraction( ) * m_heatedCrossSections[a_temperatureContext.index2( )]->gain( a_particleIndex, a_hashIndex );
 
-    return( ( 1. - fraction ) * gain1 + fraction * gain2 );
+    return( gain );
 }
 
 /* *********************************************************************************************************//**
@@ -1723,6 +3221,7 @@ HOST_DEVICE void HeatedCrossSectionsMultiGroup::serialize( DataBuffer &a_buffer,
     DATA_MEMBER_VECTOR_DOUBLE( m_thresholds, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_INT( m_multiGroupThresholdIndex, a_buffer, a_mode );
     DATA_MEMBER_VECTOR_DOUBLE( m_projectileMultiGroupBoundariesCollapsed, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_userTemperatures, a_buffer, a_mode );
 
     MCGIDI_VectorSizeType vectorSize = m_heatedCrossSections.size( );
     int vectorSizeInt = (int) vectorSize;
@@ -1781,4 +3280,119 @@ static void writeVector( FILE *a_file, std::string const &a_prefix, int a_offset
     fprintf( a_file, "\n" );
 }
 
+/* *********************************************************************************************************//**
+ * Splits the indices 0 up to but not including *a_size* into *a_numberOfThreads* contiguous ranges and calls *a_function* with the start
+ * and end of each range, in parallel when *a_numberOfThreads* is greater than 1. The threads are OpenMP threads if MCGIDI_CrossSectionVectorOpenMP
+ * is defined and std::thread's otherwise. If launching a thread or calling *a_function* on the calling thread throws, the threads already
+ * started are joined before the exception is rethrown.
+ *
+ * @param a_size                [in]    The number of indices.
+ * @param a_numberOfThreads     [in]    The number of threads to use.
+ * @param a_function            [in]    The function called as a_function( begin, end ) for each range.
+ ***********************************************************************************************************/
+
+template <typename FUNCTION> static void crossSectionVectorRanges( int a_size, int a_numberOfThreads, FUNCTION const &a_function ) {
+
+    if( a_numberOfThreads > a_size ) a_numberOfThreads = a_size;
+    if( a_numberOfThreads <= 1 ) {
+        a_function( 0, a_size );
+        return;
+    }
+
+#ifdef MCGIDI_CrossSectionVectorOpenMP
+    #pragma omp parallel for num_threads( a_numberOfThreads ) schedule( static )
+    for( int threadIndex = 0; threadIndex < a_numberOfThreads; ++threadIndex ) {
+        a_function( static_cast<int>( ( static_cast<long>( a_size ) * threadIndex ) / a_numberOfThreads ), 
+                static_cast<int>( ( static_cast<long>( a_size ) * ( threadIndex + 1 ) ) / a_numberOfThreads ) );
+    }
+#else
+    std::vector<std::thread> threads;
+    threads.reserve( a_numberOfThreads - 1 );
+
+    try {
+        for( int threadIndex = 1; threadIndex < a_numberOfThreads; ++threadIndex ) {
+            threads.push_back( std::thread( a_function, static_cast<int>( ( static_cast<long>( a_size ) * threadIndex ) / a_numberOfThreads ), 
+                    static_cast<int>( ( static_cast<long>( a_size ) * ( threadIndex + 1 ) ) / a_numberOfThreads ) ) );
+        }
+        a_function( 0, static_cast<int>( a_size / a_numberOfThreads ) ); }
+    catch (...) {
+        for( std::vector<std::thread>::iterator iter = threads.begin( ); iter != threads.end( ); ++iter ) iter->join( );
+        throw;
+    }
+    for( std::vector<std::thread>::iterator iter = threads.begin( ); iter != threads.end( ); ++iter ) iter->join( );
+#endif
+}
+
+/* *********************************************************************************************************//**
+ * Sets *a_vector* to the linear interpolation of *a_vector1* and *a_vector2*, which must have the same size.
+ *
+ * @param a_vector1             [in]    The lower temperature values.
+ * @param a_vector2             [in]    The upper temperature values.
+ * @param a_fraction            [in]    The interpolation weight of *a_vector2*.
+ * @param a_vector              [out]   The interpolated values.
+ ***********************************************************************************************************/
+
+static void interpolateMultiGroupVectors( Vector<double> const &a_vector1, Vector<double> const &a_vector2, double a_fraction, Vector<double> &a_vector ) {
+
+    if( a_vector1.size( ) != a_vector2.size( ) ) THROW( "interpolateMultiGroupVectors: vectors have different sizes." );
+
+    Vector<double> vector( a_vector1.size( ) );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < vector.size( ); ++i1 ) vector[i1] = ( 1.0 - a_fraction ) * a_vector1[i1] + a_fraction * a_vector2[i1];
+    a_vector.swap( vector );
+}
+
+/* *********************************************************************************************************//**
+ * Removes the values of *a_vector* whose energy index was removed by HeatedCrossSectionContinuousEnergy::thinEnergyGrid.
+ *
+ * @param a_vector              [in/out]    The vector to thin.
+ * @param a_offset              [in]        The energy index of the first value of *a_vector*.
+ * @param a_newIndices          [in]        For each energy index of the original grid, its index in the thinned grid or -1 if removed.
+ ***********************************************************************************************************/
+
+static void thinStorageVector( Vector<MCGIDI_StorageType> &a_vector, int a_offset, std::vector<int> const &a_newIndices ) {
+
+    MCGIDI_VectorSizeType size = 0;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < a_vector.size( ); ++i1 ) {
+        if( a_newIndices[a_offset+i1] >= 0 ) a_vector[size++] = a_vector[i1];
+    }
+
+    Vector<MCGIDI_StorageType> thinned( size );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < size; ++i1 ) thinned[i1] = a_vector[i1];
+    a_vector.swap( thinned );
+}
+
+/* *********************************************************************************************************//**
+ * Sets *a_fixedGridCrossSection* to *a_crossSection* linearly interpolated onto the fixed grid *a_fixedGridPoints*. Fixed grid points below the
+ * start of *a_crossSection* are set to 0. Fixed grid points outside the domain of the data are set to the end point values.
+ *
+ * @param a_energies                    [in]    The energy grid of the data.
+ * @param a_fixedGridPoints             [in]    The fixed grid.
+ * @param a_fixedGridIndices            [in]    For each fixed grid point, the lower index of *a_energies* that bounds it.
+ * @param a_crossSection                [in]    The cross section on *a_energies*.
+ * @param a_fixedGridCrossSection       [out]   The cross section on *a_fixedGridPoints*.
+ ***********************************************************************************************************/
+
+static void mapCrossSectionToFixedGrid( std::vector<double> const &a_energies, std::vector<double> const &a_fixedGridPoints, std::vector<int> const &a_fixedGridIndices,
+                GIDI::Functions::Ys1d const &a_crossSection, GIDI::Functions::Ys1d &a_fixedGridCrossSection ) {
+
+    int start = 0;
+
+    if( a_energies[a_crossSection.start( )] > a_fixedGridPoints[0] ) {
+        start = static_cast<int>( binarySearchVector( a_energies[a_crossSection.start( )], a_fixedGridPoints, true ) ) + 1;
+    }
+
+    for( int i1 = 0; i1 < start; ++i1 ) a_fixedGridCrossSection.set( i1, 0.0 );
+    for( int i1 = start; i1 < static_cast<int>( a_fixedGridPoints.size( ) ); ++i1 ) {
+        int index = a_fixedGridIndices[i1];
+        double fraction = ( a_fixedGridPoints[i1] - a_energies[index] ) / ( a_energies[index+1] - a_energies[index] );
+
+        if( fraction < 0.0 ) fraction = 0.0;                // Fixed grid point outside of the domain of the data.
+        if( fraction > 1.0 ) fraction = 1.0;
+
+        index -= a_crossSection.start( );
+        a_fixedGridCrossSection.set( i1, ( 1.0 - fraction ) * a_crossSection[index] + fraction * a_crossSection[index+1] );
+    }
+}
+
 }
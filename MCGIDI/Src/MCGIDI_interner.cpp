@@ -0,0 +1,147 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <string.h>
+
+#include "MCGIDI.hpp"
+
+namespace MCGIDI {
+
+/*! \class Interner
+ * This class removes duplicate floating point data from protares. Many functions and distributions (e.g., Xs_pdf_cdf1d,
+ * angular XYs2d tables, Watt and Maxwellian parameter functions) are bit-identical across the protares of a library.
+ * Interning a protare walks all of its data via its **serialize** method (i.e., DataBuffer::Mode::Intern) and passes each double
+ * and float vector to *this*. The first time a vector's data are seen, *this* takes ownership of them. When bit-identical data
+ * are already owned by *this*, the vector's data are freed and the vector shares the data owned by *this*.
+ *
+ * As the interned protares do not own their shared data, *this* must not be deleted before all protares interned by it.
+ * Interning should be done after a protare is fully setup (e.g., after calls to setUserParticleIndex) as shared data
+ * must not be modified. Serializing an interned protare still packs all of its data so an unpacked protare does not
+ * depend on *this*.
+ */
+
+/* *********************************************************************************************************//**
+ * Returns a hash of the bytes of the first *a_size* items of *a_data* (FNV-1a) mixed with *a_size*.
+ *
+ * @param a_data                [in]    The data to hash.
+ * @param a_size                [in]    The number of items of *a_data*.
+ ***********************************************************************************************************/
+
+template <typename T> static uint64_t internerContentHash( T const *a_data, MCGIDI_VectorSizeType a_size ) {
+
+    uint64_t hash = 14695981039346656037ULL ^ static_cast<uint64_t>( a_size );
+    unsigned char const *bytes = reinterpret_cast<unsigned char const *>( a_data );
+    std::size_t numberOfBytes = sizeof( T ) * static_cast<std::size_t>( a_size );
+
+    for( std::size_t index = 0; index < numberOfBytes; ++index ) {
+        hash ^= bytes[index];
+        hash *= 1099511628211ULL;
+    }
+
+    return( hash );
+}
+
+/* *********************************************************************************************************//**
+ ***********************************************************************************************************/
+
+HOST Interner::Interner( ) :
+        m_numberOfProtares( 0 ),
+        m_numberOfVectors( 0 ),
+        m_numberOfSharedVectors( 0 ),
+        m_memorySize( 0 ),
+        m_savedMemorySize( 0 ) {
+
+}
+
+/* *********************************************************************************************************//**
+ ***********************************************************************************************************/
+
+HOST Interner::~Interner( ) {
+
+    for( auto iter = m_doubleVectors.begin( ); iter != m_doubleVectors.end( ); ++iter ) delete *iter;
+    for( auto iter = m_floatVectors.begin( ); iter != m_floatVectors.end( ); ++iter ) delete *iter;
+}
+
+/* *********************************************************************************************************//**
+ * If the data of *a_vector* are bit-identical to data owned by *this*, the data of *a_vector* are freed and *a_vector* shares the
+ * data of *this*. Otherwise, *this* takes ownership of the data of *a_vector* which then shares them. Empty vectors and vectors
+ * that do not own their data are ignored.
+ *
+ * @param a_vector              [in]    The vector to intern.
+ * @param a_vectors             [in]    The list of distinct vectors owned by *this* for the type of *a_vector*.
+ * @param a_hashes              [in]    The map from content hash to indices in *a_vectors*.
+ ***********************************************************************************************************/
+
+template <typename T> HOST void Interner::internVector( Vector<T> &a_vector, std::vector<Vector<T> *> &a_vectors,
+                std::map<uint64_t, std::vector<std::size_t> > &a_hashes ) {
+
+    MCGIDI_VectorSizeType size = a_vector.size( );
+
+    if( ( size == 0 ) || !a_vector.owner( ) ) return;
+
+    ++m_numberOfVectors;
+    std::vector<std::size_t> &indices = a_hashes[internerContentHash( &a_vector[0], size )];
+    for( auto iter = indices.begin( ); iter != indices.end( ); ++iter ) {
+        Vector<T> const &vector = *a_vectors[*iter];
+
+        if( vector.size( ) != size ) continue;
+        if( memcmp( &vector[0], &a_vector[0], sizeof( T ) * static_cast<std::size_t>( size ) ) != 0 ) continue;
+
+        ++m_numberOfSharedVectors;
+        m_savedMemorySize += static_cast<long>( sizeof( T ) * a_vector.capacity( ) );
+        a_vector.share( vector );
+        return;
+    }
+
+    Vector<T> *vector = new Vector<T>( );
+    vector->swap( a_vector );
+    indices.push_back( a_vectors.size( ) );
+    a_vectors.push_back( vector );
+    m_memorySize += static_cast<long>( sizeof( T ) * vector->capacity( ) );
+    a_vector.share( *vector );
+}
+
+/* *********************************************************************************************************//**
+ * Interns the data of *a_vector*.
+ *
+ * @param a_vector              [in]    The vector to intern.
+ ***********************************************************************************************************/
+
+HOST void Interner::intern( Vector<double> &a_vector ) {
+
+    internVector( a_vector, m_doubleVectors, m_doubleHashes );
+}
+
+/* *********************************************************************************************************//**
+ * Interns the data of *a_vector*.
+ *
+ * @param a_vector              [in]    The vector to intern.
+ ***********************************************************************************************************/
+
+HOST void Interner::intern( Vector<float> &a_vector ) {
+
+    internVector( a_vector, m_floatVectors, m_floatHashes );
+}
+
+/* *********************************************************************************************************//**
+ * Interns all double and float vectors of *a_protare* (e.g., the data of all its functions and distributions).
+ *
+ * @param a_protare             [in]    The protare to intern.
+ ***********************************************************************************************************/
+
+HOST void Interner::intern( Protare *a_protare ) {
+
+    DataBuffer buffer;
+
+    buffer.m_interner = this;
+    a_protare->serialize( buffer, DataBuffer::Mode::Intern );
+    ++m_numberOfProtares;
+}
+
+}
@@ -0,0 +1,219 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+namespace MCGIDI {
+
+/*! \class Majorant
+ * This class stores a majorant of the macroscopic total cross section for delta-tracking (i.e., a value that is not less than
+ * the macroscopic total cross section of any material added to *this* at any temperature in the range requested when the material
+ * was added). The majorant is a constant per bin of a DomainHash so a lookup is one array access given the hash index. The majorant
+ * of a bin is the maximum of the data at the union grid points in or bounding the bin. As all cross sections are lin-lin between
+ * the points of their grids and lin in temperature between their tabulated temperatures, this is conservative. More bins give a
+ * tighter majorant.
+ *
+ * In the unresolved resonance region, each reaction cross section with URR probability tables is multiplied by the largest factor
+ * of its tables. For a TNSL protare, the cross section returned by the protare (i.e., TNSL below its maximum energy) is used. If on-the-fly
+ * Doppler broadening is enabled, the majorant is only conservative at the tabulated temperatures.
+ */
+
+/* *********************************************************************************************************//**
+ * Default constructor used when broadcasting a Majorant as needed by MPI or GPUs.
+ ***********************************************************************************************************/
+
+HOST_DEVICE Majorant::Majorant( ) :
+        m_domainHash( ),
+        m_crossSections( ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * @param a_domainHash          [in]    The hash whose bins define the grid of the majorant.
+ ***********************************************************************************************************/
+
+HOST Majorant::Majorant( DomainHash const &a_domainHash ) :
+        m_domainHash( a_domainHash ),
+        m_crossSections( a_domainHash.bins( ) + 2, 0.0 ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * Updates the majorant of each bin with the maximum of the lin-lin curve defined by *a_energies* and *a_crossSections* over the bin.
+ * Below the first and above the last energy, the curve is treated as constant.
+ *
+ * @param a_energies            [in]    The energy grid of the curve. Must be sorted in ascending order.
+ * @param a_crossSections       [in]    The cross section at each point of *a_energies*.
+ ***********************************************************************************************************/
+
+HOST void Majorant::addCurve( Vector<double> const &a_energies, std::vector<double> const &a_crossSections ) {
+
+    int numberOfEnergies = static_cast<int>( a_energies.size( ) );
+
+    if( numberOfEnergies == 0 ) return;
+
+    int lastHashIndex = m_domainHash.index( a_energies[0] );
+    for( int hashIndex = 0; hashIndex <= lastHashIndex; ++hashIndex ) {
+        if( a_crossSections[0] > m_crossSections[hashIndex] ) m_crossSections[hashIndex] = a_crossSections[0];
+    }
+
+    for( int energyIndex = 1; energyIndex < numberOfEnergies; ++energyIndex ) {
+        int hashIndex = m_domainHash.index( a_energies[energyIndex] );
+        double crossSection = std::max( a_crossSections[energyIndex-1], a_crossSections[energyIndex] );
+
+        for( int index = lastHashIndex; index <= hashIndex; ++index ) {
+            if( crossSection > m_crossSections[index] ) m_crossSections[index] = crossSection;
+        }
+        lastHashIndex = hashIndex;
+    }
+
+    for( int hashIndex = lastHashIndex; hashIndex < static_cast<int>( m_crossSections.size( ) ); ++hashIndex ) {
+        if( a_crossSections.back( ) > m_crossSections[hashIndex] ) m_crossSections[hashIndex] = a_crossSections.back( );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Updates *this* so that it majorizes the macroscopic total cross section of the material made of the nuclides *a_protares* with
+ * atom densities *a_atomDensities* for all temperatures from *a_temperatureMin* to *a_temperatureMax*.
+ *
+ * @param a_domainHash          [in]    The hash data used to construct *a_protares*.
+ * @param a_protares            [in]    The protare for each nuclide. All must have continuous energy cross sections.
+ * @param a_atomDensities       [in]    The atom density for each nuclide.
+ * @param a_temperatureMin      [in]    The minimum temperature of the material.
+ * @param a_temperatureMax      [in]    The maximum temperature of the material.
+ ***********************************************************************************************************/
+
+HOST void Majorant::addMaterial( DomainHash const &a_domainHash, Vector<Protare *> const &a_protares, Vector<double> const &a_atomDensities, 
+                double a_temperatureMin, double a_temperatureMax ) {
+
+    if( a_atomDensities.size( ) != a_protares.size( ) ) THROW( "Majorant::addMaterial: number of atom densities not equal to the number of protares." );
+    if( a_temperatureMin > a_temperatureMax ) THROW( "Majorant::addMaterial: minimum temperature greater than maximum temperature." );
+
+    std::vector<double> energies, temperatures;
+
+    temperatures.push_back( a_temperatureMin );
+    temperatures.push_back( a_temperatureMax );
+    for( MCGIDI_VectorSizeType nuclideIndex = 0; nuclideIndex < a_protares.size( ); ++nuclideIndex ) {
+        Protare const *protare = a_protares[nuclideIndex];
+
+        for( MCGIDI_VectorSizeType protareIndex = 0; protareIndex < protare->numberOfProtares( ); ++protareIndex ) {
+            ProtareSingle const *protareSingle = protare->protare( protareIndex );
+
+            if( !protareSingle->continuousEnergy( ) ) THROW( "Majorant::addMaterial: all protares must have continuous energy cross sections." );
+
+            HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = protareSingle->heatedCrossSections( );
+            for( int temperatureIndex = 0; temperatureIndex < static_cast<int>( heatedCrossSections.temperatures( ).size( ) ); ++temperatureIndex ) {
+                Vector<double> const &grid = heatedCrossSections.energies( temperatureIndex );
+                double temperature = heatedCrossSections.temperatures( )[temperatureIndex];
+
+                energies.insert( energies.end( ), grid.begin( ), grid.end( ) );
+                if( ( temperature > a_temperatureMin ) && ( temperature < a_temperatureMax ) ) temperatures.push_back( temperature );
+            }
+            if( protareSingle->hasURR_probabilityTables( ) ) {
+                energies.push_back( protareSingle->URR_domainMin( ) );
+                energies.push_back( protareSingle->URR_domainMax( ) );
+            }
+        }
+    }
+
+    std::sort( energies.begin( ), energies.end( ) );
+    energies.erase( std::unique( energies.begin( ), energies.end( ) ), energies.end( ) );
+    std::sort( temperatures.begin( ), temperatures.end( ) );
+    temperatures.erase( std::unique( temperatures.begin( ), temperatures.end( ) ), temperatures.end( ) );
+
+    Vector<double> grid( energies );
+    int numberOfEnergies = static_cast<int>( grid.size( ) );
+    std::vector<double> crossSections( numberOfEnergies );
+    URR_protareInfos URR_protare_infos;
+
+    URR_protare_infos.setupSmooth( a_protares );
+    for( std::size_t temperatureIndex = 0; temperatureIndex < temperatures.size( ); ++temperatureIndex ) {
+        double temperature = temperatures[temperatureIndex];
+
+        for( int energyIndex = 0; energyIndex < numberOfEnergies; ++energyIndex ) {
+            double energy = grid[energyIndex];
+            int hashIndex = a_domainHash.index( energy );
+            double crossSection = 0.0;
+
+            for( MCGIDI_VectorSizeType nuclideIndex = 0; nuclideIndex < a_protares.size( ); ++nuclideIndex ) {
+                Protare const *protare = a_protares[nuclideIndex];
+                double nuclideCrossSection = protare->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+
+                for( MCGIDI_VectorSizeType protareIndex = 0; protareIndex < protare->numberOfProtares( ); ++protareIndex ) {
+                    ProtareSingle const *protareSingle = protare->protare( protareIndex );
+
+                    if( !protareSingle->hasURR_probabilityTables( ) ) continue;
+                    if( ( energy < protareSingle->URR_domainMin( ) ) || ( energy > protareSingle->URR_domainMax( ) ) ) continue;
+
+                    for( int reactionIndex = 0; reactionIndex < static_cast<int>( protareSingle->numberOfReactions( ) ); ++reactionIndex ) {
+                        if( !protareSingle->reactionHasURR_probabilityTables( reactionIndex ) ) continue;
+
+                        double factor = protareSingle->heatedCrossSections( ).URR_maximumFactor( reactionIndex ) - 1.0;
+                        if( factor > 0.0 ) nuclideCrossSection += factor * protareSingle->reactionCrossSection( reactionIndex, URR_protare_infos, hashIndex, temperature, energy );
+                    }
+                }
+                crossSection += a_atomDensities[nuclideIndex] * nuclideCrossSection;
+            }
+            crossSections[energyIndex] = crossSection;
+        }
+        addCurve( grid, crossSections );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Updates *this* so that it majorizes the macroscopic total cross section of *a_material* at all its temperatures.
+ *
+ * @param a_material            [in]    The material.
+ ***********************************************************************************************************/
+
+HOST void Majorant::addMaterial( Material const &a_material ) {
+
+    Vector<double> const &energies = a_material.energies( );
+    int numberOfEnergies = static_cast<int>( energies.size( ) );
+    std::vector<double> crossSections( numberOfEnergies );
+
+    for( int temperatureIndex = 0; temperatureIndex < static_cast<int>( a_material.temperatures( ).size( ) ); ++temperatureIndex ) {
+        for( int energyIndex = 0; energyIndex < numberOfEnergies; ++energyIndex ) {
+            crossSections[energyIndex] = a_material.crossSectionAtIndex( temperatureIndex, energyIndex );
+        }
+        addCurve( energies, crossSections );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
+ * bytes, pack *this* or unpack *this* depending on *a_mode*.
+ *
+ * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
+ * @param a_mode                [in]    Specifies the action of this method.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void Majorant::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+
+    m_domainHash.serialize( a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_crossSections, a_buffer, a_mode );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the number of bytes used by *this* and its members.
+ *
+ * @return                              The number of bytes.
+ ***********************************************************************************************************/
+
+HOST_DEVICE long Majorant::memorySize( ) {
+
+    DataBuffer buf;
+    buf.m_placement = buf.m_placementStart + sizeOf( );
+    serialize( buf, DataBuffer::Mode::Memory );
+    return( buf.m_placement - buf.m_placementStart );
+}
+
+}
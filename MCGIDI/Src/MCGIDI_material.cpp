@@ -0,0 +1,247 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+namespace MCGIDI {
+
+/*! \class Material
+ * This class stores the macroscopic total cross section of a material (i.e., a list of nuclide protares and their atom densities)
+ * so that a transport code does not need to loop over the nuclides of a material on each collision. For each temperature
+ * in the list passed to the constructor, the cumulative sum over the nuclides of atom density times microscopic total cross section
+ * is tabulated on the union of the continuous energy grids of all nuclides for all of their temperatures. As every nuclide's cross
+ * section is lin-lin between the points of its grids, the tabulated data reproduce the per nuclide sum at each tabulated temperature.
+ * The macroscopic total cross section is the last cumulative value and the colliding nuclide is sampled by a binary search of the
+ * cumulative values. Data between two tabulated temperatures are interpolated linearly in temperature, as done by a Protare.
+ * URR probability tables are not applied (i.e., the smooth URR cross sections are used).
+ *
+ * The cumulative table has one value per nuclide, per union grid point and per temperature so its size can be large for materials
+ * with many nuclides. It is always stored as double, even if MCGIDI_FloatStorage is defined, because it is searched when sampling
+ * a nuclide and a float running sum would lose nuclides with small atom densities.
+ */
+
+/* *********************************************************************************************************//**
+ * Default constructor used when broadcasting a Material as needed by MPI or GPUs.
+ ***********************************************************************************************************/
+
+HOST_DEVICE Material::Material( ) :
+        m_numberOfNuclides( 0 ),
+        m_atomDensities( ),
+        m_temperatures( ),
+        m_hashIndices( ),
+        m_energies( ),
+        m_cumulativeCrossSections( ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * @param a_domainHash          [in]    The hash data used when looking up a cross section. Must be the same as used to construct *a_protares*.
+ * @param a_protares            [in]    The protare for each nuclide. All must have continuous energy cross sections.
+ * @param a_atomDensities       [in]    The atom density for each nuclide.
+ * @param a_temperatures        [in]    The temperatures to tabulate the macroscopic data at. Must be sorted in ascending order.
+ ***********************************************************************************************************/
+
+HOST Material::Material( DomainHash const &a_domainHash, Vector<Protare *> const &a_protares, Vector<double> const &a_atomDensities,
+                Vector<double> const &a_temperatures ) :
+        m_numberOfNuclides( static_cast<int>( a_protares.size( ) ) ),
+        m_atomDensities( a_atomDensities ),
+        m_temperatures( a_temperatures ),
+        m_hashIndices( ),
+        m_energies( ),
+        m_cumulativeCrossSections( ) {
+
+    if( m_numberOfNuclides == 0 ) THROW( "Material::Material: no nuclides." );
+    if( a_atomDensities.size( ) != a_protares.size( ) ) THROW( "Material::Material: number of atom densities not equal to the number of protares." );
+    if( a_temperatures.size( ) == 0 ) THROW( "Material::Material: no temperatures." );
+
+    std::vector<double> energies;
+
+    for( int nuclideIndex = 0; nuclideIndex < m_numberOfNuclides; ++nuclideIndex ) {
+        Protare const *protare = a_protares[nuclideIndex];
+
+        for( MCGIDI_VectorSizeType protareIndex = 0; protareIndex < protare->numberOfProtares( ); ++protareIndex ) {
+            ProtareSingle const *protareSingle = protare->protare( protareIndex );
+
+            if( !protareSingle->continuousEnergy( ) ) THROW( "Material::Material: all protares must have continuous energy cross sections." );
+
+            HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = protareSingle->heatedCrossSections( );
+            for( int temperatureIndex = 0; temperatureIndex < static_cast<int>( heatedCrossSections.temperatures( ).size( ) ); ++temperatureIndex ) {
+                Vector<double> const &grid = heatedCrossSections.energies( temperatureIndex );
+
+                energies.insert( energies.end( ), grid.begin( ), grid.end( ) );
+            }
+        }
+    }
+
+    std::sort( energies.begin( ), energies.end( ) );
+    energies.erase( std::unique( energies.begin( ), energies.end( ) ), energies.end( ) );
+
+    m_energies = energies;
+    m_hashIndices = a_domainHash.map( m_energies );
+
+    URR_protareInfos URR_protare_infos;
+    URR_protare_infos.setupSmooth( a_protares );
+    int numberOfEnergies = static_cast<int>( m_energies.size( ) );
+
+    m_cumulativeCrossSections.resize( static_cast<MCGIDI_VectorSizeType>( m_temperatures.size( ) ) * numberOfEnergies * m_numberOfNuclides );
+    for( MCGIDI_VectorSizeType temperatureIndex = 0; temperatureIndex < m_temperatures.size( ); ++temperatureIndex ) {
+        double temperature = m_temperatures[temperatureIndex];
+
+        for( int energyIndex = 0; energyIndex < numberOfEnergies; ++energyIndex ) {
+            double energy = m_energies[energyIndex];
+            int hashIndex = a_domainHash.index( energy );
+            double cumulative_cross_section = 0.0;
+            double *cumulativeCrossSections = &m_cumulativeCrossSections[( temperatureIndex * numberOfEnergies + energyIndex ) * m_numberOfNuclides];
+
+            for( int nuclideIndex = 0; nuclideIndex < m_numberOfNuclides; ++nuclideIndex ) {
+                cumulative_cross_section += m_atomDensities[nuclideIndex] * a_protares[nuclideIndex]->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+                cumulativeCrossSections[nuclideIndex] = cumulative_cross_section;
+            }
+        }
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Returns the lower index of *m_energies* that bounds *a_energy* and sets *a_energyFraction* to the weight of the data at
+ * the lower index. The search is the same as done by HeatedCrossSectionContinuousEnergy::evaluationInfo.
+ *
+ * @param a_hashIndex           [in]    The cross section hash index.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_energyFraction      [out]   The weight of the data at the returned index.
+ *
+ * @return                              The lower index of *m_energies*.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int Material::evaluationInfo( int a_hashIndex, double a_energy, double *a_energyFraction ) const {
+
+    int numberOfEnergies = static_cast<int>( m_energies.size( ) );
+
+    *a_energyFraction = 1.0;
+    if( a_energy <= m_energies[0] ) return( 0 );
+    if( a_energy >= m_energies.back( ) ) {
+        *a_energyFraction = 0.0;
+        return( numberOfEnergies - 2 );
+    }
+
+    int index1 = m_hashIndices[a_hashIndex];
+    int index2 = numberOfEnergies - 1;
+
+    if( ( a_hashIndex + 1 ) < m_hashIndices.size( ) ) index2 = m_hashIndices[a_hashIndex+1] + 1;
+    if( index2 == numberOfEnergies ) --index2;
+    if( index1 != index2 ) index1 = (int) binarySearchVectorBounded( a_energy, m_energies, index1, index2, false );
+
+    *a_energyFraction = ( m_energies[index1+1] - a_energy ) / ( m_energies[index1+1] - m_energies[index1] );
+    return( index1 );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the macroscopic total cross section of *this* (i.e., the sum over all nuclides of atom density times total cross section).
+ *
+ * @param a_hashIndex           [in]    The cross section hash index.
+ * @param a_temperature         [in]    The temperature of the material.
+ * @param a_energy              [in]    The energy of the projectile.
+ *
+ * @return                              The macroscopic total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double Material::crossSection( int a_hashIndex, double a_temperature, double a_energy ) const {
+
+    TemperatureContext temperatureContext( m_temperatures, a_temperature );
+    int numberOfEnergies = static_cast<int>( m_energies.size( ) ), last = m_numberOfNuclides - 1;
+    double energyFraction;
+    int energyIndex = evaluationInfo( a_hashIndex, a_energy, &energyFraction );
+
+    double const *cumulative1 = &m_cumulativeCrossSections[( temperatureContext.index1( ) * numberOfEnergies + energyIndex ) * m_numberOfNuclides];
+    double const *cumulative2 = &m_cumulativeCrossSections[( temperatureContext.index2( ) * numberOfEnergies + energyIndex ) * m_numberOfNuclides];
+    double crossSection1 = energyFraction * cumulative1[last] + ( 1.0 - energyFraction ) * cumulative1[last+m_numberOfNuclides];
+    double crossSection2 = energyFraction * cumulative2[last] + ( 1.0 - energyFraction ) * cumulative2[last+m_numberOfNuclides];
+
+    return( ( 1.0 - temperatureContext.fraction( ) ) * crossSection1 + temperatureContext.fraction( ) * crossSection2 );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the index of the sampled nuclide. The interpolated cumulative cross sections are binary searched for the first nuclide whose
+ * cumulative cross section is not less than a random fraction of *a_crossSection*.
+ *
+ * @param a_hashIndex           [in]    The cross section hash index.
+ * @param a_temperature         [in]    The temperature of the material.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_crossSection        [in]    Must be the value returned by **crossSection** for the same arguments.
+ * @param a_userrng             [in]    The random number generator.
+ * @param a_rngState            [in]    The state to pass to the random number generator.
+ *
+ * @return                              The index of the sampled nuclide.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int Material::sampleNuclide( int a_hashIndex, double a_temperature, double a_energy, double a_crossSection,
+                double (*a_userrng)( void * ), void *a_rngState ) const {
+
+    TemperatureContext temperatureContext( m_temperatures, a_temperature );
+    int numberOfEnergies = static_cast<int>( m_energies.size( ) );
+    double energyFraction;
+    int energyIndex = evaluationInfo( a_hashIndex, a_energy, &energyFraction );
+    double sampleCrossSection = a_userrng( a_rngState ) * a_crossSection;
+
+    double temperatureFraction2 = temperatureContext.fraction( ), temperatureFraction1 = 1.0 - temperatureFraction2;
+    double weight11 = temperatureFraction1 * energyFraction, weight12 = temperatureFraction1 * ( 1.0 - energyFraction );
+    double weight21 = temperatureFraction2 * energyFraction, weight22 = temperatureFraction2 * ( 1.0 - energyFraction );
+    double const *cumulative1 = &m_cumulativeCrossSections[( temperatureContext.index1( ) * numberOfEnergies + energyIndex ) * m_numberOfNuclides];
+    double const *cumulative2 = &m_cumulativeCrossSections[( temperatureContext.index2( ) * numberOfEnergies + energyIndex ) * m_numberOfNuclides];
+
+    int lower = 0, upper = m_numberOfNuclides - 1;
+    while( lower < upper ) {
+        int middle = ( lower + upper ) / 2;
+        double cumulativeCrossSection = weight11 * cumulative1[middle] + weight12 * cumulative1[middle+m_numberOfNuclides]
+                                      + weight21 * cumulative2[middle] + weight22 * cumulative2[middle+m_numberOfNuclides];
+
+        if( cumulativeCrossSection >= sampleCrossSection ) {
+            upper = middle; }
+        else {
+            lower = middle + 1;
+        }
+    }
+
+    return( lower );
+}
+
+/* *********************************************************************************************************//**
+ * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
+ * bytes, pack *this* or unpack *this* depending on *a_mode*.
+ *
+ * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
+ * @param a_mode                [in]    Specifies the action of this method.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void Material::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+
+    DATA_MEMBER_INT( m_numberOfNuclides, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_atomDensities, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_temperatures, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_hashIndices, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_energies, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_cumulativeCrossSections, a_buffer, a_mode );
+}
+
+/* *********************************************************************************************************//**
+ * Returns the number of bytes used by *this* and its members.
+ *
+ * @return                              The number of bytes.
+ ***********************************************************************************************************/
+
+HOST_DEVICE long Material::memorySize( ) {
+
+    DataBuffer buf;
+    buf.m_placement = buf.m_placementStart + sizeOf( );
+    serialize( buf, DataBuffer::Mode::Memory );
+    return( buf.m_placement - buf.m_placementStart );
+}
+
+}
@@ -58,6 +58,23 @@ HOST Vector<double> GIDI_VectorDoublesToMCGIDI_VectorDoubles( GIDI::Vector a_vec
     return( vector );
 }
 
+/* *********************************************************************************************************//**
+ * Copies the doubles in *a_vector* into a MCGIDI::Vector of type **MCGIDI_StorageType** (i.e., float if MCGIDI_FloatStorage is defined).
+ *
+ * @param           a_vector    [in]    The std::vector whose contents are coped to a MCGIGI::Vector.
+ *
+ * @return                              The MCGIGI::Vector.
+ ***********************************************************************************************************/
+
+HOST Vector<MCGIDI_StorageType> vectorDoublesToStorageVector( std::vector<double> const &a_vector ) {
+
+    Vector<MCGIDI_StorageType> vector( static_cast<MCGIDI_VectorSizeType>( a_vector.size( ) ) );
+
+    for( std::size_t i1 = 0; i1 < a_vector.size( ); ++i1 ) vector[i1] = static_cast<MCGIDI_StorageType>( a_vector[i1] );
+
+    return( vector );
+}
+
 /* *********************************************************************************************************//**
  * Adds the items in *a_productIndicesFrom* to the set *a_productIndicesTo*.
  *
@@ -224,7 +224,7 @@ HOST_DEVICE void OutputChannel::sampleProducts( Protare const *a_protare, double
         (*iter)->sampleProducts( a_protare, a_projectileEnergy, a_input, a_userrng, a_rngState, a_products );
 
     if( m_totalDelayedNeutronMultiplicity != nullptr ) {
-        double totalDelayedNeutronMultiplicity = m_totalDelayedNeutronMultiplicity->evaluate( a_projectileEnergy );
+        double totalDelayedNeutronMultiplicity = evaluateFunction1d( m_totalDelayedNeutronMultiplicity, a_projectileEnergy );
 
         if( a_userrng( a_rngState ) < totalDelayedNeutronMultiplicity ) {       // Assumes that totalDelayedNeutronMultiplicity < 1.0, which it is.
             double sum = 0.0;
@@ -234,9 +234,9 @@ HOST_DEVICE void OutputChannel::sampleProducts( Protare const *a_protare, double
                 DelayedNeutron const *delayedNeutron1( delayedNeutron( i1 ) );
                 Product const &product = delayedNeutron1->product( );
 
-                sum += product.multiplicity( )->evaluate( a_projectileEnergy );
+                sum += evaluateFunction1d( product.multiplicity( ), a_projectileEnergy );
                 if( sum >= totalDelayedNeutronMultiplicity ) {
-                    product.distribution( )->sample( a_projectileEnergy, a_input, a_userrng, a_rngState );
+                    Distributions::sampleDistribution( product.distribution( ), a_projectileEnergy, a_input, a_userrng, a_rngState );
                     a_input.m_delayedNeutronIndex = delayedNeutron1->delayedNeutronIndex( );
                     a_input.m_delayedNeutronDecayRate = delayedNeutron1->rate( );
                     a_products.add( a_projectileEnergy, product.index( ), product.userParticleIndex( ), product.mass( ), a_input, a_userrng, a_rngState, false );
@@ -166,7 +166,7 @@ HOST_DEVICE void Product::sampleProducts( Protare const *a_protare, double a_pro
             int _multiplicity = m_multiplicity->sampleBoundingInteger( a_projectileEnergy, a_userrng, a_rngState );
 
             for( ; _multiplicity > 0; --_multiplicity ) {
-                m_distribution->sample( a_projectileEnergy, a_input, a_userrng, a_rngState );
+                Distributions::sampleDistribution( m_distribution, a_projectileEnergy, a_input, a_userrng, a_rngState );
                 a_input.m_delayedNeutronIndex = -1;
                 a_input.m_delayedNeutronDecayRate = 0.0;
                 a_products.add( a_projectileEnergy, index( ), userParticleIndex( ), mass( ), a_input, a_userrng, a_rngState, index( ) == a_protare->photonIndex( ) );
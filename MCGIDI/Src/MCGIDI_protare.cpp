@@ -189,6 +189,40 @@ HOST void Protare::setUserParticleIndex( int a_particleIndex, int a_userParticle
     }
 }
 
+/* *********************************************************************************************************//**
+ * Fills *a_crossSections* with the total cross section for each of the *a_number* particles whose hash indices, target temperatures and
+ * projectile energies are given by *a_hashIndices*, *a_temperatures* and *a_energies*. If *a_reactionCrossSections* is not *nullptr*,
+ * it is filled with the cross section of every reaction. It must have length *a_number* times the number of reactions and is reaction major
+ * (i.e., the cross section for reaction *r* and particle *p* is at index *r* * *a_number* + *p*). The same URR information is used for
+ * all particles. This implementation simply calls the single particle methods; derived classes may override it with faster versions.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_number                  [in]    The number of particles.
+ * @param a_hashIndices             [in]    The cross section hash index of each particle.
+ * @param a_temperatures            [in]    The target temperature for each particle.
+ * @param a_energies                [in]    The projectile energy of each particle.
+ * @param a_crossSections           [out]   The total cross section for each particle.
+ * @param a_reactionCrossSections   [out]   If not *nullptr*, the reaction cross sections for each particle.
+ * @param a_sampling                [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ ***********************************************************************************************************/
+
+HOST void Protare::crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_number, int const *a_hashIndices, double const *a_temperatures, 
+                double const *a_energies, double *a_crossSections, double *a_reactionCrossSections, bool a_sampling ) const {
+
+    for( int i1 = 0; i1 < a_number; ++i1 ) a_crossSections[i1] = crossSection( a_URR_protareInfos, a_hashIndices[i1], a_temperatures[i1], a_energies[i1], a_sampling );
+
+    if( a_reactionCrossSections != nullptr ) {
+        int number_of_reactions = static_cast<int>( numberOfReactions( ) );
+
+        for( int reactionIndex = 0; reactionIndex < number_of_reactions; ++reactionIndex ) {
+            double *reactionCrossSections = &a_reactionCrossSections[static_cast<long>( reactionIndex ) * a_number];
+
+            for( int i1 = 0; i1 < a_number; ++i1 ) reactionCrossSections[i1] = reactionCrossSection( reactionIndex, a_URR_protareInfos, a_hashIndices[i1], 
+                    a_temperatures[i1], a_energies[i1], a_sampling );
+        }
+    }
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
@@ -271,6 +305,18 @@ HOST_DEVICE long Protare::memorySize( ) {
     return buf.m_placement - buf.m_placementStart;
 }
 
+/* *********************************************************************************************************//**
+ * This method counts the number of bytes of memory not allocated by *this* because identical data are shared (e.g., an
+ * energy grid shared by several temperatures). These bytes are not included in the value returned by **memorySize**.
+ ***********************************************************************************************************/
+HOST_DEVICE long Protare::sharedMemorySize( ) {
+
+    DataBuffer buf;
+    buf.m_placement = buf.m_placementStart + sizeOf();
+    serialize(buf, DataBuffer::Mode::Memory);
+    return( static_cast<long>( buf.m_sharedPlacementSize ) );
+}
+
 /*! \class ProtareSingle
  * Class representing a **GNDS** <**reactionSuite**> node with only data needed for Monte Carlo transport. The
  * data are also stored in a way that is better suited for Monte Carlo transport. For example, cross section data
@@ -353,7 +399,8 @@ HOST ProtareSingle::ProtareSingle( GIDI::ProtareSingle const &a_protare, PoPI::D
     default :
         THROW( "ProtareSingle::ProtareSingle: invalid lookupMode" );
     }
-    m_fixedGrid = a_allowFixedGrid && ( a_protare.projectile( ).ID( ) == PoPI::IDs::photon ) && ( a_settings.fixedGridPoints( ).size( ) > 0 );
+    m_fixedGrid = a_allowFixedGrid && ( ( a_protare.projectile( ).ID( ) == PoPI::IDs::photon ) || a_settings.fixedGridEqualLethargy( ) ) && 
+            ( a_settings.fixedGridPoints( ).size( ) > 0 );
 
     setupNuclideGammaBranchStateInfos( setupInfo, a_protare );
 
@@ -529,6 +576,18 @@ HOST void ProtareSingle::setUserParticleIndex( int a_particleIndex, int a_userPa
     for( auto iter = m_orphanProducts.begin( ); iter < m_orphanProducts.end( ); ++iter ) (*iter)->setUserParticleIndex( a_particleIndex, a_userParticleIndex );
 }
 
+/* *********************************************************************************************************//**
+ * Stores the multi-group data interpolated to each temperature in *a_temperatures* so that later look ups at these temperatures
+ * require no temperature interpolation. Does nothing for continuous energy data.
+ *
+ * @param a_temperatures        [in]    The list of user temperatures.
+ ***********************************************************************************************************/
+
+HOST void ProtareSingle::setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures ) {
+
+    if( !m_continuousEnergy ) m_heatedMultigroupCrossSections.setUserTemperatures( a_temperatures );
+}
+
 /* *********************************************************************************************************//**
  * Returns the pointer representing the protare (i.e., *this*) if *a_index* is 0 and nullptr otherwise.
  *
@@ -705,6 +764,54 @@ HOST_DEVICE void ProtareSingle::crossSectionVector( double a_temperature, double
     }
 }
 
+/* *********************************************************************************************************//**
+ * Adds the energy dependent, total cross section for each temperature in *a_temperatures* multiplied by *a_userFactor* to *a_crossSectionVectors*.
+ * The vector for the temperature at index *temperatureIndex* starts at *a_crossSectionVectors* + *temperatureIndex* * *a_numberAllocated*. This function only works for
+ * fixed-grid and multi-group data.
+ *
+ * @param   a_numberOfTemperatures      [in]        The number of temperatures in *a_temperatures*.
+ * @param   a_temperatures              [in]        The temperatures of the material.
+ * @param   a_userFactor                [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated           [in]        The length of memory allocated for each temperature in *a_crossSectionVectors*.
+ * @param   a_crossSectionVectors       [in/out]    The energy dependent, total cross sections to add cross section data to.
+ * @param   a_numberOfThreads           [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void ProtareSingle::crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const {
+
+    if( m_continuousEnergy ) {
+        if( !m_fixedGrid ) THROW( "ProtareSingle::crossSectionVectors: continuous energy cannot be supported." );
+        m_heatedCrossSections.crossSectionVectors( a_numberOfTemperatures, a_temperatures, a_userFactor, a_numberAllocated, a_crossSectionVectors, a_numberOfThreads ); }
+    else {
+        m_heatedMultigroupCrossSections.crossSectionVectors( a_numberOfTemperatures, a_temperatures, a_userFactor, a_numberAllocated, a_crossSectionVectors, a_numberOfThreads );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Adds the energy dependent cross section of each reaction for temperature *a_temperature* multiplied by *a_userFactor* to
+ * *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at *a_reactionCrossSectionVectors* +
+ * *reactionIndex* * *a_numberAllocated*, so *a_reactionCrossSectionVectors* must have **numberOfReactions( )** * *a_numberAllocated* elements. This function only works for fixed-grid
+ * and multi-group data.
+ *
+ * @param   a_temperature                   [in]        Specifies the temperature of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each reaction in *a_reactionCrossSectionVectors*.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The energy dependent, reaction cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void ProtareSingle::reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads ) const {
+
+    if( m_continuousEnergy ) {
+        if( !m_fixedGrid ) THROW( "ProtareSingle::reactionCrossSectionVectors: continuous energy cannot be supported." );
+        m_heatedCrossSections.reactionCrossSectionVectors( a_temperature, a_userFactor, a_numberAllocated, a_reactionCrossSectionVectors, a_numberOfThreads ); }
+    else {
+        m_heatedMultigroupCrossSections.reactionCrossSectionVectors( a_temperature, a_userFactor, a_numberAllocated, a_reactionCrossSectionVectors, a_numberOfThreads );
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the reaction's cross section for the reaction at index *a_reactionIndex*, for target temperature *a_temperature* and projectile energy *a_energy*. 
  * *a_sampling* is only used for multi-group cross section look up.
@@ -762,6 +869,30 @@ HOST_DEVICE int ProtareSingle::sampleReaction( URR_protareInfos const &a_URR_pro
     return( m_heatedMultigroupCrossSections.sampleReaction( a_hashIndex, a_temperature, a_energy, a_crossSection, a_userrng, a_rngState ) );
 }
 
+/* *********************************************************************************************************//**
+ * Batch version of **crossSection** and **reactionCrossSection**. See Protare::crossSectionBatch for a description of the arguments.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_number                  [in]    The number of particles.
+ * @param a_hashIndices             [in]    The cross section hash index of each particle.
+ * @param a_temperatures            [in]    The target temperature for each particle.
+ * @param a_energies                [in]    The projectile energy of each particle.
+ * @param a_crossSections           [out]   The total cross section for each particle.
+ * @param a_reactionCrossSections   [out]   If not *nullptr*, the reaction cross sections for each particle.
+ * @param a_sampling                [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ ***********************************************************************************************************/
+
+HOST void ProtareSingle::crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_number, int const *a_hashIndices, double const *a_temperatures, 
+                double const *a_energies, double *a_crossSections, double *a_reactionCrossSections, bool a_sampling ) const {
+
+    if( m_continuousEnergy ) {
+        m_heatedCrossSections.crossSectionBatch( a_URR_protareInfos, m_URR_index, a_number, a_hashIndices, a_temperatures, a_energies, 
+                a_crossSections, a_reactionCrossSections ); }
+    else {
+        Protare::crossSectionBatch( a_URR_protareInfos, a_number, a_hashIndices, a_temperatures, a_energies, a_crossSections, a_reactionCrossSections, a_sampling );
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the index of a sampled reaction for a target with termpature *a_temperature*, a projectile with energy *a_energy* and total cross section
  * *a_crossSection*. Random numbers are obtained via *a_userrng* and *a_rngState*.
@@ -827,6 +958,187 @@ HOST_DEVICE double ProtareSingle::gain( int a_hashIndex, double a_temperature, d
     return( m_heatedMultigroupCrossSections.gain( a_hashIndex, a_temperature, a_particleIndex ) );
 }
 
+/* *********************************************************************************************************//**
+ * Returns a TemperatureContext for target temperature *a_temperature* built from the temperatures of *this*. The returned instance
+ * can be passed to the methods below for as long as the target temperature does not change.
+ *
+ * @param a_temperature         [in]    The temperature of the target.
+ *
+ * @return                              The temperature indices and interpolation fraction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE TemperatureContext ProtareSingle::temperatureContext( double a_temperature ) const {
+
+    if( m_continuousEnergy ) return( TemperatureContext( m_heatedCrossSections.temperatures( ), a_temperature ) );
+
+    return( m_heatedMultigroupCrossSections.temperatureContext( a_temperature ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **crossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_URR_protareInfos    [in]    URR information.
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_sampling            [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                double a_energy, bool a_sampling ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.crossSection( a_URR_protareInfos, m_URR_index, a_hashIndex, a_temperatureContext, a_energy ) );
+
+    return( m_heatedMultigroupCrossSections.crossSection( a_hashIndex, a_temperatureContext, a_sampling ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **reactionCrossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_reactionIndex       [in]    The index of the reaction.
+ * @param a_URR_protareInfos    [in]    URR information.
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_sampling            [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, 
+                TemperatureContext const &a_temperatureContext, double a_energy, bool a_sampling ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.reactionCrossSection( a_reactionIndex, a_URR_protareInfos, m_URR_index, a_hashIndex, 
+            a_temperatureContext, a_energy ) );
+
+    return( m_heatedMultigroupCrossSections.reactionCrossSection( a_reactionIndex, a_hashIndex, a_temperatureContext, a_sampling ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **sampleReaction** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_URR_protareInfos    [in]    URR information.
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_crossSection        [in]    The total cross section.
+ * @param a_userrng             [in]    A random number generator that takes the state *a_rngState* and returns a double in the range [0.0, 1.0).
+ * @param a_rngState            [in]    The current state for the random number generator.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int ProtareSingle::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.sampleReaction( a_URR_protareInfos, m_URR_index, a_hashIndex, a_temperatureContext, a_energy, 
+            a_crossSection, a_userrng, a_rngState ) );
+
+    return( m_heatedMultigroupCrossSections.sampleReaction( a_hashIndex, a_temperatureContext, a_energy, a_crossSection, a_userrng, a_rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **crossSection** method with argument *a_temperatureContext* but, for continuous energy data, the energy search starts
+ * from the index stored in *a_energyIndexHint*. For multi-group data, *a_hashIndex* is the group index and the hint is not used
+ * (see MultiGroupHash::index).
+ *
+ * @param a_URR_protareInfos    [in]    URR information.
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energyIndexHint     [in]    The particle's last energy indices for *this*. Updated on return.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_sampling            [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                EnergyIndexHint &a_energyIndexHint, double a_energy, bool a_sampling ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.crossSection( a_URR_protareInfos, m_URR_index, a_hashIndex, a_temperatureContext, 
+            a_energyIndexHint, a_energy ) );
+
+    return( m_heatedMultigroupCrossSections.crossSection( a_hashIndex, a_temperatureContext, a_sampling ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **sampleReaction** method with argument *a_temperatureContext* but, for continuous energy data, the energy search starts
+ * from the index stored in *a_energyIndexHint*.
+ *
+ * @param a_URR_protareInfos    [in]    URR information.
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energyIndexHint     [in]    The particle's last energy indices for *this*. Updated on return.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_crossSection        [in]    The total cross section.
+ * @param a_userrng             [in]    A random number generator that takes the state *a_rngState* and returns a double in the range [0.0, 1.0).
+ * @param a_rngState            [in]    The current state for the random number generator.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int ProtareSingle::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const &a_temperatureContext, 
+                EnergyIndexHint &a_energyIndexHint, double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.sampleReaction( a_URR_protareInfos, m_URR_index, a_hashIndex, a_temperatureContext, 
+            a_energyIndexHint, a_energy, a_crossSection, a_userrng, a_rngState ) );
+
+    return( m_heatedMultigroupCrossSections.sampleReaction( a_hashIndex, a_temperatureContext, a_energy, a_crossSection, a_userrng, a_rngState ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **depositionEnergy** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::depositionEnergy( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.depositionEnergy( a_hashIndex, a_temperatureContext, a_energy ) );
+
+    return( m_heatedMultigroupCrossSections.depositionEnergy( a_hashIndex, a_temperatureContext ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **depositionMomentum** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::depositionMomentum( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.depositionMomentum( a_hashIndex, a_temperatureContext, a_energy ) );
+
+    return( m_heatedMultigroupCrossSections.depositionMomentum( a_hashIndex, a_temperatureContext ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **productionEnergy** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::productionEnergy( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.productionEnergy( a_hashIndex, a_temperatureContext, a_energy ) );
+
+    return( m_heatedMultigroupCrossSections.productionEnergy( a_hashIndex, a_temperatureContext ) );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **gain** method with argument *a_temperature* but uses the temperature data in *a_temperatureContext*.
+ *
+ * @param a_hashIndex           [in]    Specifies the continuous energy or multi-group index.
+ * @param a_temperatureContext  [in]    The value returned by **temperatureContext** for the target temperature.
+ * @param a_energy              [in]    The energy of the projectile.
+ * @param a_particleIndex       [in]    The index of the particle whose gain is to be returned.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareSingle::gain( int a_hashIndex, TemperatureContext const &a_temperatureContext, double a_energy, int a_particleIndex ) const {
+
+    if( m_continuousEnergy ) return( m_heatedCrossSections.gain( a_hashIndex, a_temperatureContext, a_energy, a_particleIndex ) );
+
+    return( m_heatedMultigroupCrossSections.gain( a_hashIndex, a_temperatureContext, a_particleIndex ) );
+}
+
 /* *********************************************************************************************************//**
  * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
  * bytes, pack *this* or unpack *this* depending on *a_mode*.
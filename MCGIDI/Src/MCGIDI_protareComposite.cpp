@@ -28,7 +28,8 @@ HOST_DEVICE ProtareComposite::ProtareComposite( ) :
         m_numberOfReactions( 0 ),
         m_numberOfOrphanProducts( 0 ),
         m_minimumEnergy( 0.0 ),
-        m_maximumEnergy( 0.0 ) {
+        m_maximumEnergy( 0.0 ),
+        m_unionizedGrid( ) {
 
 }
 
@@ -49,7 +50,8 @@ HOST ProtareComposite::ProtareComposite( GIDI::ProtareComposite const &a_protare
                 std::set<int> const &a_reactionsToExclude, int a_reactionsToExcludeOffset, bool a_allowFixedGrid ) :
         Protare( ProtareType::composite, a_protare, a_pops, a_settings ),
         m_numberOfReactions( 0 ),
-        m_numberOfOrphanProducts( 0 ) {
+        m_numberOfOrphanProducts( 0 ),
+        m_unionizedGrid( ) {
 
     std::vector<GIDI::Protare *> &protares = static_cast<std::vector<GIDI::Protare *> &>( const_cast<GIDI::ProtareComposite &>( a_protare ).protares( ) );
     std::size_t length = static_cast<std::size_t>( protares.size( ) );
@@ -80,6 +82,13 @@ HOST ProtareComposite::ProtareComposite( GIDI::ProtareComposite const &a_protare
     }
 
     productIndices( product_indices, product_indices_transportable );
+
+    if( a_settings.wantUnionizedGrid( ) ) {
+        bool continuousEnergy = true;
+
+        for( std::size_t i1 = 0; i1 < length; ++i1 ) continuousEnergy = continuousEnergy && m_protares[i1]->continuousEnergy( );
+        if( continuousEnergy ) m_unionizedGrid = UnionizedGrid( a_domainHash, m_protares );
+    }
 }
 
 /* *********************************************************************************************************//**
@@ -104,6 +113,18 @@ HOST void ProtareComposite::setUserParticleIndex( int a_particleIndex, int a_use
     for( auto iter = m_protares.begin( ); iter != m_protares.end( ); ++iter ) (*iter)->setUserParticleIndex( a_particleIndex, a_userParticleIndex );
 }
 
+/* *********************************************************************************************************//**
+ * Stores the multi-group data interpolated to each temperature in *a_temperatures* so that later look ups at these temperatures
+ * require no temperature interpolation.
+ *
+ * @param a_temperatures        [in]    The list of user temperatures.
+ ***********************************************************************************************************/
+
+HOST void ProtareComposite::setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures ) {
+
+    for( auto iter = m_protares.begin( ); iter != m_protares.end( ); ++iter ) (*iter)->setMultiGroupUserTemperatures( a_temperatures );
+}
+
 /* *********************************************************************************************************//**
  * Returns the pointer representing the (a_index - 1)th **ProtareSingle**.
  *
@@ -355,6 +376,14 @@ HOST_DEVICE double ProtareComposite::crossSection( URR_protareInfos const &a_URR
     std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
     double cross_section = 0.0;
 
+    if( m_unionizedGrid.isActive( ) ) {
+        int union_index = m_unionizedGrid.evaluationIndex( a_hashIndex, a_energy );
+
+        for( std::size_t i1 = 0; i1 < length; ++i1 ) cross_section += m_protares[i1]->unionizedCrossSection( a_URR_protareInfos, 
+                m_unionizedGrid.gridIndices( union_index, static_cast<int>( i1 ) ), a_temperature, a_energy, a_sampling );
+        return( cross_section );
+    }
+
     for( std::size_t i1 = 0; i1 < length; ++i1 ) cross_section += m_protares[i1]->crossSection( a_URR_protareInfos, a_hashIndex, a_temperature, a_energy, a_sampling );
 
     return( cross_section );
@@ -376,6 +405,51 @@ HOST_DEVICE void ProtareComposite::crossSectionVector( double a_temperature, dou
     for( std::size_t i1 = 0; i1 < length; ++i1 ) m_protares[i1]->crossSectionVector( a_temperature, a_userFactor, a_numberAllocated, a_crossSectionVector );
 }
 
+/* *********************************************************************************************************//**
+ * Adds the energy dependent, total cross section for each temperature in *a_temperatures* multiplied by *a_userFactor* to *a_crossSectionVectors*.
+ * The vector for the temperature at index *temperatureIndex* starts at *a_crossSectionVectors* + *temperatureIndex* * *a_numberAllocated*.
+ *
+ * @param   a_numberOfTemperatures      [in]        The number of temperatures in *a_temperatures*.
+ * @param   a_temperatures              [in]        The temperatures of the material.
+ * @param   a_userFactor                [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated           [in]        The length of memory allocated for each temperature in *a_crossSectionVectors*.
+ * @param   a_crossSectionVectors       [in/out]    The energy dependent, total cross sections to add cross section data to.
+ * @param   a_numberOfThreads           [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void ProtareComposite::crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) {
+        m_protares[i1]->crossSectionVectors( a_numberOfTemperatures, a_temperatures, a_userFactor, a_numberAllocated, a_crossSectionVectors, a_numberOfThreads );
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Adds the energy dependent cross section of each reaction for temperature *a_temperature* multiplied by *a_userFactor* to
+ * *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at *a_reactionCrossSectionVectors* +
+ * *reactionIndex* * *a_numberAllocated*, so *a_reactionCrossSectionVectors* must have **numberOfReactions( )** * *a_numberAllocated* elements.
+ *
+ * @param   a_temperature                   [in]        Specifies the temperature of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each reaction in *a_reactionCrossSectionVectors*.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The energy dependent, reaction cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void ProtareComposite::reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) {
+        m_protares[i1]->reactionCrossSectionVectors( a_temperature, a_userFactor, a_numberAllocated, a_reactionCrossSectionVectors, a_numberOfThreads );
+        a_reactionCrossSectionVectors += m_protares[i1]->numberOfReactions( ) * a_numberAllocated;
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the cross section for reaction at index *a_reactionIndex*.
  *
@@ -457,9 +531,19 @@ HOST_DEVICE int ProtareComposite::sampleReaction( URR_protareInfos const &a_URR_
     int reaction_index = 0;
     double cross_section_sum = 0.0;
     double cross_section_rng = a_userrng( a_rngState ) * a_crossSection;
+    int union_index = -1;
+
+    if( m_unionizedGrid.isActive( ) ) union_index = m_unionizedGrid.evaluationIndex( a_hashIndex, a_energy );
 
     for( std::size_t i1 = 0; i1 < length; ++i1 ) {
-        double cross_section = m_protares[i1]->crossSection( a_URR_protareInfos, a_hashIndex, a_temperature, a_energy, true );
+        double cross_section;
+
+        if( union_index < 0 ) {
+            cross_section = m_protares[i1]->crossSection( a_URR_protareInfos, a_hashIndex, a_temperature, a_energy, true ); }
+        else {
+            cross_section = m_protares[i1]->unionizedCrossSection( a_URR_protareInfos, m_unionizedGrid.gridIndices( union_index, static_cast<int>( i1 ) ), 
+                    a_temperature, a_energy, true );
+        }
 
         cross_section_sum += cross_section;
         if( cross_section_sum > cross_section_rng ) {
@@ -475,6 +559,169 @@ HOST_DEVICE int ProtareComposite::sampleReaction( URR_protareInfos const &a_URR_
     return( reaction_index );
 }
 
+/* *********************************************************************************************************//**
+ * Sets *a_temperatureContexts*[i1] to the TemperatureContext of the protare at index i1 for target temperature *a_temperature*, as each
+ * protare of *this* can have its own list of temperatures. *a_temperatureContexts* must have **numberOfProtares( )** elements.
+ *
+ * @param   a_temperature           [in]    The target temperature.
+ * @param   a_temperatureContexts   [out]   The temperature context of each protare.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void ProtareComposite::temperatureContexts( double a_temperature, TemperatureContext *a_temperatureContexts ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) a_temperatureContexts[i1] = m_protares[i1]->temperatureContext( a_temperature );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **crossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContexts*.
+ * 
+ * @param   a_URR_protareInfos      [in]    URR information.
+ * @param   a_hashIndex             [in]    The cross section hash index.
+ * @param   a_temperatureContexts   [in]    The temperature contexts filled by **temperatureContexts**.
+ * @param   a_energy                [in]    The projectile energy.
+ * @param   a_sampling              [in]    Only used for multi-group cross sections. When sampling, the cross section in the group where threshold 
+ *                                          is present the cross section is augmented.
+ *
+ * @return                                  The total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareComposite::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+    double cross_section = 0.0;
+
+    if( m_unionizedGrid.isActive( ) ) {
+        int union_index = m_unionizedGrid.evaluationIndex( a_hashIndex, a_energy );
+
+        for( std::size_t i1 = 0; i1 < length; ++i1 ) cross_section += m_protares[i1]->unionizedCrossSection( a_URR_protareInfos, 
+                m_unionizedGrid.gridIndices( union_index, static_cast<int>( i1 ) ), a_temperatureContexts[i1], a_energy, a_sampling );
+        return( cross_section );
+    }
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) cross_section += m_protares[i1]->crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[i1], a_energy, a_sampling );
+
+    return( cross_section );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **reactionCrossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContexts*.
+ *
+ * @param   a_reactionIndex         [in]    The index of the reaction.
+ * @param   a_URR_protareInfos      [in]    URR information.
+ * @param   a_hashIndex             [in]    The cross section hash index.
+ * @param   a_temperatureContexts   [in]    The temperature contexts filled by **temperatureContexts**.
+ * @param   a_energy                [in]    The projectile energy.
+ * @param   a_sampling              [in]    Only used for multi-group cross sections. When sampling, the cross section in the group where threshold 
+ *                                          is present the cross section is augmented.
+ *
+ * @return                                  The reaction's cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareComposite::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, 
+                TemperatureContext const *a_temperatureContexts, double a_energy, bool a_sampling ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+    double cross_section = 0.0;
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) {
+        int numberOfReactions = m_protares[i1]->numberOfReactions( );
+
+        if( a_reactionIndex < numberOfReactions ) {
+            cross_section = m_protares[i1]->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_hashIndex, a_temperatureContexts[i1], a_energy, a_sampling );
+            break;
+        }
+        a_reactionIndex -= numberOfReactions;
+    }
+
+    return( cross_section );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **sampleReaction** method with argument *a_temperature* but uses the temperature data in *a_temperatureContexts*.
+ *
+ * @param   a_URR_protareInfos      [in]    URR information.
+ * @param   a_hashIndex             [in]    The cross section hash index.
+ * @param   a_temperatureContexts   [in]    The temperature contexts filled by **temperatureContexts**.
+ * @param   a_energy                [in]    The projectile energy.
+ * @param   a_crossSection          [in]    The total cross section at the target temperature and *a_energy*.
+ * @param   a_userrng               [in]    The random number gnerator.
+ * @param   a_rngState              [in]    The state for the random number gnerator.
+ *
+ * @return                                  The index of the sampled reaction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int ProtareComposite::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+    int reaction_index = 0;
+    double cross_section_sum = 0.0;
+    double cross_section_rng = a_userrng( a_rngState ) * a_crossSection;
+    int union_index = -1;
+
+    if( m_unionizedGrid.isActive( ) ) union_index = m_unionizedGrid.evaluationIndex( a_hashIndex, a_energy );
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) {
+        double cross_section;
+
+        if( union_index < 0 ) {
+            cross_section = m_protares[i1]->crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[i1], a_energy, true ); }
+        else {
+            cross_section = m_protares[i1]->unionizedCrossSection( a_URR_protareInfos, m_unionizedGrid.gridIndices( union_index, static_cast<int>( i1 ) ), 
+                    a_temperatureContexts[i1], a_energy, true );
+        }
+
+        cross_section_sum += cross_section;
+        if( cross_section_sum > cross_section_rng ) {
+            int reaction_index2 = m_protares[i1]->sampleReaction( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[i1], a_energy, cross_section, 
+                    a_userrng, a_rngState );
+
+            reaction_index += reaction_index2;
+            if( reaction_index2  == MCGIDI_nullReaction ) reaction_index = MCGIDI_nullReaction;
+            break;
+        }
+        reaction_index += m_protares[i1]->numberOfReactions( );
+    }
+
+    return( reaction_index );
+}
+
+/* *********************************************************************************************************//**
+ * Batch version of **crossSection** and **reactionCrossSection**. See Protare::crossSectionBatch for a description of the arguments.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_number                  [in]    The number of particles.
+ * @param a_hashIndices             [in]    The cross section hash index of each particle.
+ * @param a_temperatures            [in]    The target temperature for each particle.
+ * @param a_energies                [in]    The projectile energy of each particle.
+ * @param a_crossSections           [out]   The total cross section for each particle.
+ * @param a_reactionCrossSections   [out]   If not *nullptr*, the reaction cross sections for each particle.
+ * @param a_sampling                [in]    Used for multi-group look up. If *true*, use augmented cross sections.
+ ***********************************************************************************************************/
+
+HOST void ProtareComposite::crossSectionBatch( URR_protareInfos const &a_URR_protareInfos, int a_number, int const *a_hashIndices, double const *a_temperatures, 
+                double const *a_energies, double *a_crossSections, double *a_reactionCrossSections, bool a_sampling ) const {
+
+    std::size_t length = static_cast<std::size_t>( m_protares.size( ) );
+    std::vector<double> cross_sections( a_number );
+    long reaction_offset = 0;
+
+    for( int i1 = 0; i1 < a_number; ++i1 ) a_crossSections[i1] = 0.0;
+
+    for( std::size_t i1 = 0; i1 < length; ++i1 ) {
+        double *reaction_cross_sections = nullptr;
+
+        if( a_reactionCrossSections != nullptr ) reaction_cross_sections = &a_reactionCrossSections[reaction_offset * a_number];
+        m_protares[i1]->crossSectionBatch( a_URR_protareInfos, a_number, a_hashIndices, a_temperatures, a_energies, cross_sections.data( ), 
+                reaction_cross_sections, a_sampling );
+        for( int i2 = 0; i2 < a_number; ++i2 ) a_crossSections[i2] += cross_sections[i2];
+        reaction_offset += static_cast<long>( m_protares[i1]->numberOfReactions( ) );
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the total deposition energy.
  *
@@ -574,6 +821,7 @@ HOST_DEVICE void ProtareComposite::serialize( DataBuffer &a_buffer, DataBuffer::
     DATA_MEMBER_INT( m_numberOfOrphanProducts, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_minimumEnergy, a_buffer, a_mode );
     DATA_MEMBER_FLOAT( m_maximumEnergy, a_buffer, a_mode );
+    m_unionizedGrid.serialize( a_buffer, a_mode );
 
     DATA_MEMBER_INT( vectorSizeInt, *workingBuffer, a_mode );
     vectorSize = static_cast<MCGIDI_VectorSizeType>( vectorSizeInt );
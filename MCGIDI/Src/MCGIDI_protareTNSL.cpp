@@ -111,6 +111,20 @@ HOST void ProtareTNSL::setUserParticleIndex( int a_particleIndex, int a_userPart
     m_protareWithoutElastic->setUserParticleIndex( a_particleIndex, a_userParticleIndex );
 }
 
+/* *********************************************************************************************************//**
+ * Stores the multi-group data interpolated to each temperature in *a_temperatures* so that later look ups at these temperatures
+ * require no temperature interpolation.
+ *
+ * @param a_temperatures        [in]    The list of user temperatures.
+ ***********************************************************************************************************/
+
+HOST void ProtareTNSL::setMultiGroupUserTemperatures( std::vector<double> const &a_temperatures ) {
+
+    m_protareWithElastic->setMultiGroupUserTemperatures( a_temperatures );
+    m_TNSL->setMultiGroupUserTemperatures( a_temperatures );
+    m_protareWithoutElastic->setMultiGroupUserTemperatures( a_temperatures );
+}
+
 /* *********************************************************************************************************//**
  * Returns the pointer representing the (a_index - 1)th **ProtareSingle**.
  *
@@ -258,6 +272,61 @@ HOST_DEVICE void ProtareTNSL::crossSectionVector( double a_temperature, double a
     }
 }
 
+/* *********************************************************************************************************//**
+ * Adds the energy dependent, total cross section for each temperature in *a_temperatures* multiplied by *a_userFactor* to *a_crossSectionVectors*.
+ * The vector for the temperature at index *temperatureIndex* starts at *a_crossSectionVectors* + *temperatureIndex* * *a_numberAllocated*. As with **crossSectionVector**, the TNSL data are used
+ * for temperatures not above the maximum TNSL temperature.
+ *
+ * @param   a_numberOfTemperatures      [in]        The number of temperatures in *a_temperatures*.
+ * @param   a_temperatures              [in]        The temperatures of the material.
+ * @param   a_userFactor                [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated           [in]        The length of memory allocated for each temperature in *a_crossSectionVectors*.
+ * @param   a_crossSectionVectors       [in/out]    The energy dependent, total cross sections to add cross section data to.
+ * @param   a_numberOfThreads           [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void ProtareTNSL::crossSectionVectors( int a_numberOfTemperatures, double const *a_temperatures, double a_userFactor, int a_numberAllocated, 
+                double *a_crossSectionVectors, int a_numberOfThreads ) const {
+
+    for( int i1 = 0; i1 < a_numberOfTemperatures; ++i1 ) {
+        double *crossSectionVector = &a_crossSectionVectors[i1 * a_numberAllocated];
+
+        if( a_temperatures[i1] <= m_TNSL_maximumTemperature ) {
+            m_TNSL->crossSectionVectors( 1, &a_temperatures[i1], a_userFactor, a_numberAllocated, crossSectionVector, a_numberOfThreads );
+            m_protareWithoutElastic->crossSectionVectors( 1, &a_temperatures[i1], a_userFactor, a_numberAllocated, crossSectionVector, a_numberOfThreads ); }
+        else {
+            m_protareWithElastic->crossSectionVectors( 1, &a_temperatures[i1], a_userFactor, a_numberAllocated, crossSectionVector, a_numberOfThreads );
+        }
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Adds the energy dependent cross section of each reaction for temperature *a_temperature* multiplied by *a_userFactor* to
+ * *a_reactionCrossSectionVectors*. The vector for the reaction at index *reactionIndex* starts at *a_reactionCrossSectionVectors* +
+ * *reactionIndex* * *a_numberAllocated*, so *a_reactionCrossSectionVectors* must have **numberOfReactions( )** * *a_numberAllocated* elements. As with **crossSectionVector**, the TNSL data are used
+ * if *a_temperature* is not above the maximum TNSL temperature, in which case the vector of the elastic reaction of the standard protare is not changed.
+ *
+ * @param   a_temperature                   [in]        Specifies the temperature of the material.
+ * @param   a_userFactor                    [in]        User factor which all cross sections are multiplied by.
+ * @param   a_numberAllocated               [in]        The length of memory allocated for each reaction in *a_reactionCrossSectionVectors*.
+ * @param   a_reactionCrossSectionVectors   [in/out]    The energy dependent, reaction cross sections to add cross section data to.
+ * @param   a_numberOfThreads               [in]        The number of threads to use.
+ ***********************************************************************************************************/
+
+HOST void ProtareTNSL::reactionCrossSectionVectors( double a_temperature, double a_userFactor, int a_numberAllocated, double *a_reactionCrossSectionVectors, 
+                int a_numberOfThreads ) const {
+
+    double *standardReactionCrossSectionVectors = &a_reactionCrossSectionVectors[m_numberOfTNSLReactions * a_numberAllocated];
+
+    if( a_temperature <= m_TNSL_maximumTemperature ) {
+        m_TNSL->reactionCrossSectionVectors( a_temperature, a_userFactor, a_numberAllocated, a_reactionCrossSectionVectors, a_numberOfThreads );
+        m_protareWithoutElastic->reactionCrossSectionVectors( a_temperature, a_userFactor, a_numberAllocated, 
+                &standardReactionCrossSectionVectors[a_numberAllocated], a_numberOfThreads ); }
+    else {
+        m_protareWithElastic->reactionCrossSectionVectors( a_temperature, a_userFactor, a_numberAllocated, standardReactionCrossSectionVectors, a_numberOfThreads );
+    }
+}
+
 /* *********************************************************************************************************//**
  * Returns the cross section for reaction at index *a_reactionIndex*, for target at temperature *a_temperature* and projectile of energy *a_energy*.
  *
@@ -354,6 +423,118 @@ HOST_DEVICE int ProtareTNSL::sampleReaction( URR_protareInfos const &a_URR_prota
     return( reactionIndex );
 }
 
+/* *********************************************************************************************************//**
+ * Sets the two TemperatureContext's of *this* for target temperature *a_temperature*. As with **protare**, index 0 is for the standard protare
+ * (also used for the standard protare without elastic, as it has the same temperatures) and index 1 is for the TNSL protare.
+ *
+ * @param a_temperature             [in]    The target temperature.
+ * @param a_temperatureContexts     [out]   The temperature contexts. Must have 2 elements.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void ProtareTNSL::temperatureContexts( double a_temperature, TemperatureContext *a_temperatureContexts ) const {
+
+    a_temperatureContexts[0] = m_protareWithElastic->temperatureContext( a_temperature );
+    a_temperatureContexts[1] = m_TNSL->temperatureContext( a_temperature );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **crossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContexts*.
+ * 
+ * @param   a_URR_protareInfos      [in]    URR information.
+ * @param   a_hashIndex             [in]    The cross section hash index.
+ * @param   a_temperatureContexts   [in]    The temperature contexts filled by **temperatureContexts**.
+ * @param   a_energy                [in]    The projectile energy.
+ * @param   a_sampling              [in]    Only used for multi-group cross sections. When sampling, the cross section in the group where threshold 
+ *                                          is present the cross section is augmented.
+ *
+ * @return                                  The total cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareTNSL::crossSection( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, bool a_sampling ) const {
+
+    double crossSection1 = 0.0;
+
+    if( ( a_energy < m_TNSL_maximumEnergy ) && ( a_temperatureContexts[0].temperature( ) <= m_TNSL_maximumTemperature ) ) {
+        crossSection1 = m_TNSL->crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[1], a_energy, a_sampling ) +
+                        m_protareWithoutElastic->crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_sampling ); }
+    else {
+        crossSection1 = m_protareWithElastic->crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_sampling );
+    }
+
+    return( crossSection1 );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **reactionCrossSection** method with argument *a_temperature* but uses the temperature data in *a_temperatureContexts*.
+ *
+ * @param   a_reactionIndex         [in]    The index of the reaction.
+ * @param   a_URR_protareInfos      [in]    URR information.
+ * @param   a_hashIndex             [in]    The cross section hash index.
+ * @param   a_temperatureContexts   [in]    The temperature contexts filled by **temperatureContexts**.
+ * @param   a_energy                [in]    The projectile energy.
+ * @param   a_sampling              [in]    Only used for multi-group cross sections. When sampling, the cross section in the group where threshold 
+ *                                          is present the cross section is augmented.
+ *
+ * @return                                  The reaction's cross section.
+ ***********************************************************************************************************/
+
+HOST_DEVICE double ProtareTNSL::reactionCrossSection( int a_reactionIndex, URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, 
+                TemperatureContext const *a_temperatureContexts, double a_energy, bool a_sampling ) const {
+
+    int index = a_reactionIndex - m_numberOfTNSLReactions;
+    double crossSection1 = 0.0;
+
+    if( ( a_energy < m_TNSL_maximumEnergy ) && ( a_temperatureContexts[0].temperature( ) <= m_TNSL_maximumTemperature ) ) {
+        if( index < 0 ) {
+            crossSection1 = m_TNSL->reactionCrossSection( a_reactionIndex, a_URR_protareInfos, a_hashIndex, a_temperatureContexts[1], a_energy, a_sampling ); }
+        else {
+            if( index > 0 ) crossSection1 = m_protareWithElastic->reactionCrossSection( index, a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_sampling );
+        } }
+    else {
+        if( index >= 0 ) crossSection1 = m_protareWithElastic->reactionCrossSection( index, a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_sampling );
+    }
+
+    return( crossSection1 );
+}
+
+/* *********************************************************************************************************//**
+ * Same as the **sampleReaction** method with argument *a_temperature* but uses the temperature data in *a_temperatureContexts*.
+ *
+ * @param a_URR_protareInfos        [in]    URR information.
+ * @param a_hashIndex               [in]    The cross section hash index.
+ * @param a_temperatureContexts     [in]    The temperature contexts filled by **temperatureContexts**.
+ * @param a_energy                  [in]    The projectile energy.
+ * @param a_crossSection            [in]    The total cross section at the target temperature and *a_energy*.
+ * @param a_userrng                 [in]    The random number gnerator.
+ * @param a_rngState                [in]    The state for the random number gnerator.
+ *
+ * @return                                  The index of the sampled reaction.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int ProtareTNSL::sampleReaction( URR_protareInfos const &a_URR_protareInfos, int a_hashIndex, TemperatureContext const *a_temperatureContexts, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) const {
+
+    int reactionIndex = 0;
+
+    if( ( a_energy < m_TNSL_maximumEnergy ) && ( a_temperatureContexts[0].temperature( ) <= m_TNSL_maximumTemperature ) ) {
+        double TNSL_crossSection = m_TNSL->crossSection( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[1], a_energy, true );
+
+        if( TNSL_crossSection > a_userrng( a_rngState ) * a_crossSection ) {
+            reactionIndex = m_TNSL->sampleReaction( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[1], a_energy, TNSL_crossSection, a_userrng, a_rngState ); }
+        else { 
+            reactionIndex = m_protareWithoutElastic->sampleReaction( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_crossSection - TNSL_crossSection, 
+                    a_userrng, a_rngState );
+            if( reactionIndex != MCGIDI_nullReaction ) reactionIndex += m_numberOfTNSLReactions + 1;
+        } }
+    else {
+        reactionIndex = m_protareWithElastic->sampleReaction( a_URR_protareInfos, a_hashIndex, a_temperatureContexts[0], a_energy, a_crossSection, a_userrng, a_rngState );
+        if( reactionIndex != MCGIDI_nullReaction ) reactionIndex += m_numberOfTNSLReactions;
+    }
+
+    return( reactionIndex );
+}
+
 /* *********************************************************************************************************//**
  * Returns the total deposition energy.
  *
@@ -144,6 +144,14 @@ HOST_DEVICE void ProductHandler::add( double a_projectileEnergy, int a_productIn
     push_back( product );
 }
 
+/*! \class ProductBankHandler
+ * This class stores sampled products into caller provided arrays, one array per product member (i.e., a structure of arrays), so that
+ * event based codes can use the products without copying them. The arrays are never allocated, reallocated or freed by *this*.
+ * Products added once the capacity is reached are not stored but counted, and the count is returned by **numberOfOverflows**.
+ * As only the caller calls **clear**, the products of several collisions can be accumulated into the arrays. The optional arrays
+ * can be *nullptr* in which case their product member is not stored.
+ */
+
 }           // End of namespace Sampling.
 
 }           // End of namespace MCGIDI.
@@ -165,21 +165,28 @@ class StdVectorProductHandler : public ProductHandler {
 
     private:
         std::size_t m_size;
+        std::size_t m_numberOfOverflows;            /**< The number of products not stored as the list was full. */
         Product m_products[1024];
 
     public:
-        HOST_DEVICE StdVectorProductHandler( ) : m_size( 0 ) { }
+        HOST_DEVICE StdVectorProductHandler( ) : m_size( 0 ), m_numberOfOverflows( 0 ) { }
         HOST_DEVICE ~StdVectorProductHandler( ) { }
 
         HOST_DEVICE virtual std::size_t size( ) { return( m_size ); }
+        HOST_DEVICE std::size_t numberOfOverflows( ) const { return( m_numberOfOverflows ); }       /**< Returns the value of the **m_numberOfOverflows**. */
         HOST_DEVICE Product &operator[]( long a_index ) { return( m_products[a_index] ); }
         HOST_DEVICE void push_back( Product &a_product ) {
             if( m_size < MCGIDI_CUDACC_numberOfProducts ) {
                 m_products[m_size] = a_product;
-                ++m_size;
+                ++m_size; }
+            else {
+                ++m_numberOfOverflows;
             }
         }
-        HOST_DEVICE void clear( ) { m_size = 0; }
+        HOST_DEVICE void clear( ) {
+            m_size = 0;
+            m_numberOfOverflows = 0;
+        }
 };
 
 #else
@@ -225,6 +232,72 @@ class MCGIDIVectorProductHandler : public ProductHandler {
         HOST_DEVICE void clear( ) { m_products.clear( ); }
 };
 
+/*
+============================================================
+=================== ProductBankHandler =====================
+============================================================
+*/
+class ProductBankHandler : public ProductHandler {
+
+    private:
+        std::size_t m_capacity;                     /**< The number of products the arrays can hold. */
+        std::size_t m_size;                         /**< The number of products stored. */
+        std::size_t m_numberOfOverflows;            /**< The number of products not stored as the arrays were full. */
+        int *m_productIndices;                      /**< The product indices. */
+        int *m_userProductIndices;                  /**< The user product indices. */
+        double *m_kineticEnergies;                  /**< The kinetic energies. */
+        double *m_px_vx;                            /**< The velocities or momenta along the x-axis. */
+        double *m_py_vy;                            /**< The velocities or momenta along the y-axis. */
+        double *m_pz_vz;                            /**< The velocities or momenta along the z-axis. */
+        double *m_productMasses;                    /**< The product masses. Optional. */
+        int *m_delayedNeutronIndices;               /**< The delayed neutron indices. Optional. */
+        double *m_birthTimeSecs;                    /**< The birth times. Optional. */
+
+    public:
+        HOST_DEVICE ProductBankHandler( std::size_t a_capacity, int *a_productIndices, int *a_userProductIndices, double *a_kineticEnergies, 
+                        double *a_px_vx, double *a_py_vy, double *a_pz_vz, double *a_productMasses = nullptr, int *a_delayedNeutronIndices = nullptr, 
+                        double *a_birthTimeSecs = nullptr ) :
+                m_capacity( a_capacity ),
+                m_size( 0 ),
+                m_numberOfOverflows( 0 ),
+                m_productIndices( a_productIndices ),
+                m_userProductIndices( a_userProductIndices ),
+                m_kineticEnergies( a_kineticEnergies ),
+                m_px_vx( a_px_vx ),
+                m_py_vy( a_py_vy ),
+                m_pz_vz( a_pz_vz ),
+                m_productMasses( a_productMasses ),
+                m_delayedNeutronIndices( a_delayedNeutronIndices ),
+                m_birthTimeSecs( a_birthTimeSecs ) {
+        }
+        HOST_DEVICE ~ProductBankHandler( ) {}
+
+        HOST_DEVICE virtual std::size_t size( ) { return( m_size ); }
+        HOST_DEVICE std::size_t capacity( ) const { return( m_capacity ); }                         /**< Returns the value of the **m_capacity**. */
+        HOST_DEVICE std::size_t numberOfOverflows( ) const { return( m_numberOfOverflows ); }       /**< Returns the value of the **m_numberOfOverflows**. */
+        HOST_DEVICE bool overflowed( ) const { return( m_numberOfOverflows > 0 ); }                 /**< Returns *true* if any product was not stored. */
+        HOST_DEVICE void push_back( Product &a_product ) {
+            if( m_size == m_capacity ) {
+                ++m_numberOfOverflows;
+                return;
+            }
+            m_productIndices[m_size] = a_product.m_productIndex;
+            m_userProductIndices[m_size] = a_product.m_userProductIndex;
+            m_kineticEnergies[m_size] = a_product.m_kineticEnergy;
+            m_px_vx[m_size] = a_product.m_px_vx;
+            m_py_vy[m_size] = a_product.m_py_vy;
+            m_pz_vz[m_size] = a_product.m_pz_vz;
+            if( m_productMasses != nullptr ) m_productMasses[m_size] = a_product.m_productMass;
+            if( m_delayedNeutronIndices != nullptr ) m_delayedNeutronIndices[m_size] = a_product.m_delayedNeutronIndex;
+            if( m_birthTimeSecs != nullptr ) m_birthTimeSecs[m_size] = a_product.m_birthTimeSec;
+            ++m_size;
+        }
+        HOST_DEVICE void clear( ) {
+            m_size = 0;
+            m_numberOfOverflows = 0;
+        }
+};
+
 }       // End of namespace Sampling.
 
 }       // End of namespace MCGIDI.
@@ -34,7 +34,17 @@ MC::MC( PoPI::Database const &a_pops, std::string const &a_projectileID, GIDI::S
         m_upscatterModel( Sampling::Upscatter::Model::none ),
         m_upscatterModelALabel( "" ),
         m_want_URR_probabilityTables( false ),
-        m_wantTerrellPromptNeutronDistribution( false ) {
+        m_wantTerrellPromptNeutronDistribution( false ),
+        m_fixedGridEqualLethargy( false ),
+        m_wantUnionizedGrid( false ),
+        m_wantPackedReactionCrossSections( false ),
+        m_wantCumulativeReactionCrossSections( false ),
+        m_wantOnTheFlyDopplerBroadening( false ),
+        m_gridThinningTolerance( 0.0 ),
+        m_wantStochasticInterpolation( false ),
+        m_wantAliasTables( false ),
+        m_guideTableFactor( 0.0 ),
+        m_spectrumTableTolerance( 0.0 ) {
 
 }
 /*
@@ -67,6 +77,47 @@ void MC::distributionLookupMode( LookupMode::Distribution a_distributionLookupMo
 /*
 =========================================================
 */
+void MC::equalLethargyFixedGrid( double a_energyMin, double a_energyMax, int a_numberOfPoints ) {
+
+    if( a_energyMin <= 0.0 ) THROW( "Equal-lethargy fixed grid minimum energy must be positive." );
+    if( a_energyMax <= a_energyMin ) THROW( "Equal-lethargy fixed grid maximum energy must be greater than its minimum energy." );
+    if( a_numberOfPoints < 2 ) THROW( "Equal-lethargy fixed grid must have at least 2 points." );
+
+    double logEnergyMin = log( a_energyMin ), lethargyStep = ( log( a_energyMax ) - logEnergyMin ) / ( a_numberOfPoints - 1 );
+
+    m_fixedGridPoints.resize( a_numberOfPoints );
+    m_fixedGridPoints[0] = a_energyMin;
+    for( int i1 = 1; i1 < a_numberOfPoints - 1; ++i1 ) m_fixedGridPoints[i1] = exp( logEnergyMin + i1 * lethargyStep );
+    m_fixedGridPoints.back( ) = a_energyMax;
+    m_fixedGridEqualLethargy = true;
+}
+/*
+=========================================================
+*/
+void MC::gridThinningTolerance( double a_gridThinningTolerance ) {
+
+    if( a_gridThinningTolerance < 0.0 ) THROW( "Grid thinning tolerance must not be negative." );
+    m_gridThinningTolerance = a_gridThinningTolerance;
+}
+/*
+=========================================================
+*/
+void MC::guideTableFactor( double a_guideTableFactor ) {
+
+    if( a_guideTableFactor < 0.0 ) THROW( "Guide table factor must not be negative." );
+    m_guideTableFactor = a_guideTableFactor;
+}
+/*
+=========================================================
+*/
+void MC::spectrumTableTolerance( double a_spectrumTableTolerance ) {
+
+    if( a_spectrumTableTolerance < 0.0 ) THROW( "Spectrum table tolerance must not be negative." );
+    m_spectrumTableTolerance = a_spectrumTableTolerance;
+}
+/*
+=========================================================
+*/
 void MC::setUpscatterModelA( std::string const &a_upscatterModelALabel ) {
 
     m_upscatterModel = Sampling::Upscatter::Model::A;
@@ -0,0 +1,64 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include "MCGIDI.hpp"
+
+namespace MCGIDI {
+
+/*! \class TemperatureContext
+ * This class stores the indices of the two temperatures of a protare that bound a target temperature and the interpolation fraction
+ * between them. As the temperature of a cell is normally fixed for a whole step, a caller can build one instance per protare and cell
+ * and pass it to all lookups (e.g., cross section, reaction sampling, deposition and gain) instead of having each lookup search the
+ * protare's temperatures.
+ */
+
+/* *********************************************************************************************************//**
+ * @param a_temperatures        [in]    The list of temperatures of a protare. Must be sorted in ascending order.
+ * @param a_temperature         [in]    The target temperature.
+ ***********************************************************************************************************/
+
+HOST_DEVICE TemperatureContext::TemperatureContext( Vector<double> const &a_temperatures, double a_temperature ) :
+        m_index1( 0 ),
+        m_index2( 0 ),
+        m_fraction( 0.0 ),
+        m_temperature( a_temperature ) {
+
+    set( a_temperatures, a_temperature );
+}
+
+/* *********************************************************************************************************//**
+ * Sets the members of *this* for target temperature *a_temperature*. If *a_temperature* is outside the domain of *a_temperatures*,
+ * the closest temperature is used with no interpolation.
+ *
+ * @param a_temperatures        [in]    The list of temperatures of a protare. Must be sorted in ascending order.
+ * @param a_temperature         [in]    The target temperature.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void TemperatureContext::set( Vector<double> const &a_temperatures, double a_temperature ) {
+
+    int i1, number_of_temperatures = static_cast<int>( a_temperatures.size( ) );
+
+    m_temperature = a_temperature;
+    m_fraction = 0.0;
+    if( a_temperature <= a_temperatures[0] ) {
+        m_index1 = 0;
+        m_index2 = 0; }
+    else if( a_temperature >= a_temperatures.back( ) ) {
+        m_index1 = number_of_temperatures - 1;
+        m_index2 = m_index1; }
+    else {
+        for( i1 = 0; i1 < number_of_temperatures; ++i1 ) if( a_temperature < a_temperatures[i1] ) break;
+        m_index1 = i1 - 1;
+        m_index2 = i1;
+        m_fraction = ( a_temperature - a_temperatures[m_index1] ) / ( a_temperatures[m_index2] - a_temperatures[m_index1] );
+        if( m_fraction == 0.0 ) m_index2 = m_index1;                // a_temperature is a temperature of the data so no interpolation is needed.
+    }
+}
+
+}
@@ -0,0 +1,139 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+namespace MCGIDI {
+
+/*! \class UnionizedGrid
+ * This class stores the union of the continuous energy grids of a list of protares (e.g., the protares of a ProtareComposite)
+ * for all of their temperatures. For each point of the union grid, the lower index into each protare/temperature grid is stored
+ * so that a single search of the union grid gives the bounding index of every protare. This trades memory (one int per union point
+ * per protare/temperature grid) for lookup speed.
+ */
+
+/* *********************************************************************************************************//**
+ * Default constructor used when broadcasting a Protare as needed by MPI or GPUs.
+ ***********************************************************************************************************/
+
+HOST_DEVICE UnionizedGrid::UnionizedGrid( ) :
+        m_hashIndices( ),
+        m_energies( ),
+        m_numberOfGrids( 0 ),
+        m_gridOffsets( ),
+        m_gridIndices( ) {
+
+}
+
+/* *********************************************************************************************************//**
+ * @param a_domainHash          [in]    The hash data used when looking up a cross section. Must be the same as used to construct *a_protares*.
+ * @param a_protares            [in]    The list of protares whose energy grids are unionized. All must have continuous energy cross sections.
+ ***********************************************************************************************************/
+
+HOST UnionizedGrid::UnionizedGrid( DomainHash const &a_domainHash, Vector<ProtareSingle *> const &a_protares ) :
+        m_hashIndices( ),
+        m_energies( ),
+        m_numberOfGrids( 0 ),
+        m_gridOffsets( ),
+        m_gridIndices( ) {
+
+    std::vector<double> energies;
+
+    m_gridOffsets.resize( a_protares.size( ) );
+    for( MCGIDI_VectorSizeType protareIndex = 0; protareIndex < a_protares.size( ); ++protareIndex ) {
+        ProtareSingle const *protare = a_protares[protareIndex];
+
+        if( !protare->continuousEnergy( ) ) THROW( "UnionizedGrid::UnionizedGrid: all protares must have continuous energy cross sections." );
+
+        HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = protare->heatedCrossSections( );
+        int numberOfTemperatures = static_cast<int>( heatedCrossSections.temperatures( ).size( ) );
+
+        m_gridOffsets[protareIndex] = m_numberOfGrids;
+        m_numberOfGrids += numberOfTemperatures;
+        for( int temperatureIndex = 0; temperatureIndex < numberOfTemperatures; ++temperatureIndex ) {
+            Vector<double> const &grid = heatedCrossSections.energies( temperatureIndex );
+
+            energies.insert( energies.end( ), grid.begin( ), grid.end( ) );
+        }
+    }
+
+    std::sort( energies.begin( ), energies.end( ) );
+    energies.erase( std::unique( energies.begin( ), energies.end( ) ), energies.end( ) );
+
+    m_energies = energies;
+    m_hashIndices = a_domainHash.map( m_energies );
+
+    MCGIDI_VectorSizeType numberOfEnergies = m_energies.size( );
+    m_gridIndices.resize( numberOfEnergies * m_numberOfGrids );
+
+    int gridIndex = 0;
+    for( MCGIDI_VectorSizeType protareIndex = 0; protareIndex < a_protares.size( ); ++protareIndex ) {
+        HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = a_protares[protareIndex]->heatedCrossSections( );
+        int numberOfTemperatures = static_cast<int>( heatedCrossSections.temperatures( ).size( ) );
+
+        for( int temperatureIndex = 0; temperatureIndex < numberOfTemperatures; ++temperatureIndex, ++gridIndex ) {
+            Vector<double> const &grid = heatedCrossSections.energies( temperatureIndex );
+            int lastIndex = static_cast<int>( grid.size( ) ) - 2;
+            int index = 0;
+
+            for( MCGIDI_VectorSizeType energyIndex = 0; energyIndex < numberOfEnergies; ++energyIndex ) {
+                while( ( index <= lastIndex ) && ( grid[index+1] <= m_energies[energyIndex] ) ) ++index;
+                m_gridIndices[energyIndex * m_numberOfGrids + gridIndex] = ( index > lastIndex ) ? lastIndex : index;
+            }
+        }
+    }
+}
+
+/* *********************************************************************************************************//**
+ * Returns the lower index of *m_energies* that bounds *a_energy*. The search is the same as done by
+ * HeatedCrossSectionContinuousEnergy::evaluationInfo. The returned index is always a valid row for **gridIndices**.
+ *
+ * @param a_hashIndex           [in]    The cross section hash index.
+ * @param a_energy              [in]    The energy of the projectile.
+ *
+ * @return                              The lower index of *m_energies*.
+ ***********************************************************************************************************/
+
+HOST_DEVICE int UnionizedGrid::evaluationIndex( int a_hashIndex, double a_energy ) const {
+
+    int numberOfEnergies = static_cast<int>( m_energies.size( ) );
+
+    if( a_energy <= m_energies[0] ) return( 0 );
+    if( a_energy >= m_energies.back( ) ) return( numberOfEnergies - 1 );
+
+    int index1 = m_hashIndices[a_hashIndex];
+    int index2 = numberOfEnergies - 1;
+
+    if( ( a_hashIndex + 1 ) < m_hashIndices.size( ) ) index2 = m_hashIndices[a_hashIndex+1] + 1;
+    if( index2 == numberOfEnergies ) --index2;
+    if( index1 != index2 ) index1 = (int) binarySearchVectorBounded( a_energy, m_energies, index1, index2, false );
+
+    return( index1 );
+}
+
+/* *********************************************************************************************************//**
+ * This method serializes *this* for broadcasting as needed for MPI and GPUs. The method can count the number of required
+ * bytes, pack *this* or unpack *this* depending on *a_mode*.
+ *
+ * @param a_buffer              [in]    The buffer to read or write data to depending on *a_mode*.
+ * @param a_mode                [in]    Specifies the action of this method.
+ ***********************************************************************************************************/
+
+HOST_DEVICE void UnionizedGrid::serialize( DataBuffer &a_buffer, DataBuffer::Mode a_mode ) {
+
+    DATA_MEMBER_VECTOR_INT( m_hashIndices, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_DOUBLE( m_energies, a_buffer, a_mode );
+    DATA_MEMBER_INT( m_numberOfGrids, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_gridOffsets, a_buffer, a_mode );
+    DATA_MEMBER_VECTOR_INT( m_gridIndices, a_buffer, a_mode );
+}
+
+}
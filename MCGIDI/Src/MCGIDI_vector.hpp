@@ -25,6 +25,16 @@
 
 typedef int MCGIDI_VectorSizeType;
 
+// If MCGIDI_FloatStorage is defined, continuous energy cross section values and pdf tables are stored as float while all arithmetic
+// is still done in double. Energy grids, cdfs, cumulative cross section tables and multi-group data are always stored as double.
+#ifdef MCGIDI_FloatStorage
+    typedef float MCGIDI_StorageType;
+    #define MCGIDI_StorageEpsilon 1e-5
+#else
+    typedef double MCGIDI_StorageType;
+    #define MCGIDI_StorageEpsilon 1e-8
+#endif
+
 #define MCGIDI_SWAP(a,b,type) {type ttttttttt=a;a=b;b=ttttttttt;}
 
 #if defined(__CUDACC__) && !defined(__CUDA_ARCH__)
@@ -50,13 +60,14 @@ class Vector
    MCGIDI_VectorSizeType _capacity;
    MCGIDI_VectorSizeType _size;
    bool _mem_type;
+   bool _owner;                 // If false, _data belongs to another Vector (see share) and is not freed by *this*.
 
  public:
    typedef T* iterator;
    typedef T* const_iterator;
 
-   HOST_DEVICE Vector()        : _data(0), _capacity(0), _size(0), _mem_type(CPU_MEM) {};
-   HOST_DEVICE Vector( MCGIDI_VectorSizeType s, bool mem_flag = CPU_MEM ) : _data(0), _capacity(s), _size(s), _mem_type(mem_flag)
+   HOST_DEVICE Vector()        : _data(0), _capacity(0), _size(0), _mem_type(CPU_MEM), _owner(true) {};
+   HOST_DEVICE Vector( MCGIDI_VectorSizeType s, bool mem_flag = CPU_MEM ) : _data(0), _capacity(s), _size(s), _mem_type(mem_flag), _owner(true)
    {
        
       if( s == 0 ){ _data = nullptr; return;}	
@@ -76,7 +87,7 @@ class Vector
                 break;
         }
    }
-   HOST_DEVICE Vector( MCGIDI_VectorSizeType s, const T& d, bool mem_flag = CPU_MEM ) : _data(0), _capacity(s), _size(s), _mem_type(mem_flag)
+   HOST_DEVICE Vector( MCGIDI_VectorSizeType s, const T& d, bool mem_flag = CPU_MEM ) : _data(0), _capacity(s), _size(s), _mem_type(mem_flag), _owner(true)
    { 
       if( s == 0 ){ _data = nullptr; return;}	
         switch ( (int) _mem_type){
@@ -99,7 +110,7 @@ class Vector
    }
 
    HOST_DEVICE Vector(const Vector<T>& aa )
-        : _data(0), _capacity(aa._capacity), _size(aa._size), _mem_type(aa._mem_type)
+        : _data(0), _capacity(aa._capacity), _size(aa._size), _mem_type(aa._mem_type), _owner(true)
    {
       if( _capacity == 0 ){ _data = nullptr; return; }
 
@@ -124,7 +135,7 @@ class Vector
    }
 
    HOST Vector(const std::vector<T>& aa )
-        : _data(0), _capacity(aa.size()), _size(aa.size()), _mem_type(CPU_MEM)
+        : _data(0), _capacity(aa.size()), _size(aa.size()), _mem_type(CPU_MEM), _owner(true)
    {
       if( _capacity == 0 ){ _data = nullptr; return;}	
 
@@ -149,6 +160,7 @@ class Vector
    }
    
    HOST_DEVICE ~Vector() { 
+        if( !_owner ) return;
         switch ( (int) _mem_type){
             case CPU_MEM:
                 delete[] _data; 
@@ -181,6 +193,25 @@ class Vector
       MCGIDI_SWAP(_capacity, other._capacity, MCGIDI_VectorSizeType);
       MCGIDI_SWAP(_size,     other._size,     MCGIDI_VectorSizeType);
       MCGIDI_SWAP(_mem_type, other._mem_type, bool);
+      MCGIDI_SWAP(_owner,    other._owner,    bool);
+   }
+
+   /// Frees the data of *this* and makes *this* use the data of *aa* without owning them. The data of *aa* must not be resized
+   /// or freed while shared.
+   HOST_DEVICE void share( const Vector<T>& aa )
+   {
+      Vector<T> temp;
+      this->swap(temp);
+      _data = aa._data;
+      _capacity = aa._capacity;
+      _size = aa._size;
+      _mem_type = aa._mem_type;
+      _owner = false;
+   }
+
+   HOST_DEVICE bool owner() const
+   {
+      return _owner;
    }
    
    /// Implement assignment using copy-swap idiom
@@ -9,6 +9,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include <iostream>
 #include <iomanip>
@@ -93,6 +94,54 @@ double float64RNG64( void *a_dummy ) {
     state = a_factor * state + b_addend;
     return( stateToDoubleFactor * state );
 }
+/*
+=========================================================
+*/
+double MCGIDI_test_chiSquarePerDOF( std::vector<double> const &a_counts1, std::vector<double> const &a_counts2, int &a_dof ) {
+/*
+*   Returns the two-sample chi-square per degree of freedom of the histograms *a_counts1* and *a_counts2*, which may have
+*   different totals. Bins empty in both histograms are skipped. The number of degrees of freedom is returned in *a_dof*,
+*   and is 0 if either histogram is empty.
+*/
+
+    double sum1 = 0.0, sum2 = 0.0, chiSquare = 0.0;
+
+    for( std::size_t i1 = 0; i1 < a_counts1.size( ); ++i1 ) {
+        sum1 += a_counts1[i1];
+        sum2 += a_counts2[i1];
+    }
+
+    a_dof = 0;
+    if( ( sum1 == 0.0 ) || ( sum2 == 0.0 ) ) return( 0.0 );
+
+    double factor1 = sqrt( sum2 / sum1 ), factor2 = sqrt( sum1 / sum2 );
+    a_dof = -1;
+    for( std::size_t i1 = 0; i1 < a_counts1.size( ); ++i1 ) {
+        double total = a_counts1[i1] + a_counts2[i1];
+
+        if( total == 0.0 ) continue;
+        double difference = factor1 * a_counts1[i1] - factor2 * a_counts2[i1];
+        chiSquare += difference * difference / total;
+        ++a_dof;
+    }
+
+    if( a_dof <= 0 ) {
+        a_dof = 0;
+        return( 0.0 );
+    }
+    return( chiSquare / a_dof );
+}
+/*
+=========================================================
+*/
+bool MCGIDI_test_chiSquareFlagged( double a_chiSquarePerDOF, int a_dof ) {
+/*
+*   Returns true if *a_chiSquarePerDOF* exceeds its expected value of 1 by more than 5 standard deviations (i.e., 5 * sqrt( 2 / dof )).
+*/
+
+    if( a_dof <= 0 ) return( false );
+    return( a_chiSquarePerDOF > 1.0 + 5.0 * sqrt( 2.0 / a_dof ) );
+}
 
 /*
 =========================================================
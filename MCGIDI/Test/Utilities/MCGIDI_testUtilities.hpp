@@ -61,5 +61,7 @@ std::string doubleToString2( char const *format, double value );
 std::string longToString2( char const *format, long value );
 void MCGIDI_test_rngSetup( unsigned long long a_seed );
 double float64RNG64( void *a_dummy );
+double MCGIDI_test_chiSquarePerDOF( std::vector<double> const &a_counts1, std::vector<double> const &a_counts2, int &a_dof );
+bool MCGIDI_test_chiSquareFlagged( double a_chiSquarePerDOF, int a_dof );
 
 #endif          // MCGIDI_testUtilities_hpp_included
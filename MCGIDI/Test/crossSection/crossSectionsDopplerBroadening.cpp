@@ -0,0 +1,179 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static char const *description = "Compares on-the-fly Doppler broadened cross sections to the tabulated heated cross sections. At the lowest\n"
+    "temperature no broadening is done and the cross sections must be identical. At each higher stored temperature the broadened total cross\n"
+    "section must be within tolerance of the tabulated one, the broadened reaction cross sections must sum to the broadened total, and reaction\n"
+    "tallies must pass a two-sample chi-square test. Exits with a failure status if any check fails.";
+
+#define maximumRelativeDifference 5e-2
+#define meanRelativeDifference 5e-3
+#define reactionSumRelativeDifference 1e-6
+
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareBroadened, MCGIDI::DomainHash const &a_domainHash, double a_temperature,
+                bool a_identical, long a_numberOfSamples );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "crossSectionsDopplerBroadening", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of reaction samples per temperature and energy." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 10 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare, *MCProtareBroadened;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        MC.wantOnTheFlyDopplerBroadening( true );
+        MCProtareBroadened = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) {
+        errCount += compare( MCProtare, MCProtareBroadened, domainHash, temperatures[i1].temperature( ).value( ), i1 == 0, numberOfSamples );
+    }
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareBroadened;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareBroadened, MCGIDI::DomainHash const &a_domainHash, double a_temperature,
+                bool a_identical, long a_numberOfSamples ) {
+
+    int errCount = 0, numberOfReactions = (int) a_protare->numberOfReactions( ), numberOfFlagged = 0;
+    long count = 0;
+    double maximum = 0.0, maximumEnergy = 0.0, sum = 0.0;
+    void *rngState = nullptr;
+    unsigned long long seed = 1;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 2 );
+    protares[0] = a_protare;
+    protares[1] = a_protareBroadened;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    std::vector<double> counts( numberOfReactions + 1 ), countsBroadened( numberOfReactions + 1 );
+    for( double energy = 1e-11; energy < 20.0; energy *= 1.05 ) {
+        int hashIndex = a_domainHash.index( energy );
+        double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy );
+        double crossSectionBroadened = a_protareBroadened->crossSection( URR_protare_infos, hashIndex, a_temperature, energy );
+
+        if( crossSection <= 0.0 ) continue;
+        double difference = fabs( crossSectionBroadened - crossSection ) / crossSection;
+
+        if( a_identical && ( difference > 1e-12 ) ) {
+            std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", energy ) << "  unbroadened cross sections differ: "
+                    << doubleToString2( "%23.15e", crossSection ) << "  " << doubleToString2( "%23.15e", crossSectionBroadened ) << std::endl;
+            ++errCount;
+        }
+        sum += difference;
+        ++count;
+        if( difference > maximum ) {
+            maximum = difference;
+            maximumEnergy = energy;
+        }
+
+        double reactionSum = 0.0;
+        for( int i1 = 0; i1 < numberOfReactions; ++i1 ) {
+            reactionSum += a_protareBroadened->reactionCrossSection( i1, URR_protare_infos, hashIndex, a_temperature, energy );
+        }
+        if( fabs( reactionSum - crossSectionBroadened ) > reactionSumRelativeDifference * crossSectionBroadened ) {
+            std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", energy ) << "  broadened reaction sum = "
+                    << doubleToString2( "%23.15e", reactionSum ) << "  broadened total = " << doubleToString2( "%23.15e", crossSectionBroadened ) << std::endl;
+            ++errCount;
+        }
+
+        if( count % 40 != 0 ) continue;
+
+        double crossSectionSampling = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy, true );
+        double crossSectionSamplingBroadened = a_protareBroadened->crossSection( URR_protare_infos, hashIndex, a_temperature, energy, true );
+        int dof;
+
+        std::fill( counts.begin( ), counts.end( ), 0.0 );
+        std::fill( countsBroadened.begin( ), countsBroadened.end( ), 0.0 );
+        MCGIDI_test_rngSetup( seed );
+        for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+            int reactionIndex = a_protare->sampleReaction( URR_protare_infos, hashIndex, a_temperature, energy, crossSectionSampling, float64RNG64, rngState );
+            if( ( reactionIndex < 0 ) || ( reactionIndex > numberOfReactions ) ) reactionIndex = numberOfReactions;
+            ++counts[reactionIndex];
+        }
+        for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+            int reactionIndex = a_protareBroadened->sampleReaction( URR_protare_infos, hashIndex, a_temperature, energy, crossSectionSamplingBroadened, 
+                    float64RNG64, rngState );
+            if( ( reactionIndex < 0 ) || ( reactionIndex > numberOfReactions ) ) reactionIndex = numberOfReactions;
+            ++countsBroadened[reactionIndex];
+        }
+        if( MCGIDI_test_chiSquareFlagged( MCGIDI_test_chiSquarePerDOF( counts, countsBroadened, dof ), dof ) ) {
+            std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", energy ) << "  reaction tallies differ" << std::endl;
+            ++numberOfFlagged;
+        }
+    }
+    errCount += numberOfFlagged;
+
+    double mean = count > 0 ? sum / count : 0.0;
+    std::cout << "temperature = " << doubleToString2( "%13.6e", a_temperature ) << "  maximum relative difference = " << doubleToString2( "%10.3e", maximum )
+            << " (at " << doubleToString2( "%10.3e", maximumEnergy ) << ")  mean = " << doubleToString2( "%10.3e", mean ) << std::endl;
+    if( ( maximum > maximumRelativeDifference ) || ( mean > meanRelativeDifference ) ) {
+        std::cout << "    ERROR: broadened total cross section outside tolerance" << std::endl;
+        ++errCount;
+    }
+
+    return( errCount );
+}
@@ -0,0 +1,197 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static char const *description = "Builds a protare on an equal-lethargy fixed grid and checks that the closed form index lookup of\n"
+    "HeatedCrossSectionContinuousEnergy::evaluationInfo returns a bracketing index and the correct fraction. It checks this at, just below\n"
+    "and just above every grid point, and at random energies. It also checks that the total and reaction cross sections at each grid point\n"
+    "equal those of the protare on its evaluated grid. Exits with a failure status if any check fails.";
+
+#define numberOfRandomEnergies 100000
+
+static int checkIndices( MCGIDI::HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection, MCGIDI::DomainHash const &a_domainHash );
+static int checkIndex( MCGIDI::HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection, MCGIDI::DomainHash const &a_domainHash, double a_energy );
+static int checkCrossSections( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareLethargy, MCGIDI::DomainHash const &a_domainHash, 
+                double a_temperature, MCGIDI::Vector<double> const &a_grid );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "crossSectionsEqualLethargy", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of points in the equal-lethargy grid." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    int numberOfPoints = (int) argv_options.find( "-n" )->asLong( argv, 10 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare, *MCProtareLethargy;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        MC.equalLethargyFixedGrid( 1e-11, 20.0, numberOfPoints );
+        MCProtareLethargy = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    MCGIDI::HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = MCProtareLethargy->protare( 0 )->heatedCrossSections( );
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) {
+        MCGIDI::HeatedCrossSectionContinuousEnergy const &heatedCrossSection = *heatedCrossSections.heatedCrossSections( )[i1];
+        int temperatureErrCount = 0;
+
+        if( (int) heatedCrossSection.energies( ).size( ) != numberOfPoints ) {
+            std::cout << "    ERROR: grid has " << heatedCrossSection.energies( ).size( ) << " points, expected " << numberOfPoints << std::endl;
+            ++temperatureErrCount;
+        }
+        temperatureErrCount += checkIndices( heatedCrossSection, domainHash );
+        temperatureErrCount += checkCrossSections( MCProtare, MCProtareLethargy, domainHash, temperatures[i1].temperature( ).value( ), heatedCrossSection.energies( ) );
+        std::cout << "temperature = " << doubleToString2( "%13.6e", temperatures[i1].temperature( ).value( ) ) << "  errors = " << temperatureErrCount << std::endl;
+        errCount += temperatureErrCount;
+    }
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareLethargy;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int checkIndices( MCGIDI::HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection, MCGIDI::DomainHash const &a_domainHash ) {
+
+    int errCount = 0;
+    MCGIDI::Vector<double> const &energies = a_heatedCrossSection.energies( );
+    double logEnergyMin = log( energies[0] ), logEnergyWidth = log( energies.back( ) ) - logEnergyMin;
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < energies.size( ); ++i1 ) {
+        errCount += checkIndex( a_heatedCrossSection, a_domainHash, nextafter( energies[i1], 0.0 ) );
+        errCount += checkIndex( a_heatedCrossSection, a_domainHash, energies[i1] );
+        errCount += checkIndex( a_heatedCrossSection, a_domainHash, nextafter( energies[i1], 2.0 * energies[i1] ) );
+    }
+
+    MCGIDI_test_rngSetup( 1 );
+    for( long i1 = 0; i1 < numberOfRandomEnergies; ++i1 ) {
+        errCount += checkIndex( a_heatedCrossSection, a_domainHash, exp( logEnergyMin + logEnergyWidth * float64RNG64( nullptr ) ) );
+    }
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static int checkIndex( MCGIDI::HeatedCrossSectionContinuousEnergy const &a_heatedCrossSection, MCGIDI::DomainHash const &a_domainHash, double a_energy ) {
+
+    MCGIDI::Vector<double> const &energies = a_heatedCrossSection.energies( );
+    double energyFraction;
+    int index = a_heatedCrossSection.evaluationInfo( a_domainHash.index( a_energy ), a_energy, &energyFraction );
+
+    if( ( index < 0 ) || ( index > (int) energies.size( ) - 2 ) ) {
+        std::cout << "    ERROR: energy = " << doubleToString2( "%23.15e", a_energy ) << "  index = " << index << " out of range" << std::endl;
+        return( 1 );
+    }
+    if( ( a_energy <= energies[0] ) || ( a_energy >= energies.back( ) ) ) return( 0 );           // Clamped to the end points.
+
+    if( ( a_energy < energies[index] ) || ( a_energy > energies[index+1] ) ) {
+        std::cout << "    ERROR: energy = " << doubleToString2( "%23.15e", a_energy ) << "  not in [ " << doubleToString2( "%23.15e", energies[index] ) 
+                << ", " << doubleToString2( "%23.15e", energies[index+1] ) << " ] for index " << index << std::endl;
+        return( 1 );
+    }
+
+    double expectedFraction = ( energies[index+1] - a_energy ) / ( energies[index+1] - energies[index] );
+    if( fabs( energyFraction - expectedFraction ) > 1e-12 ) {
+        std::cout << "    ERROR: energy = " << doubleToString2( "%23.15e", a_energy ) << "  fraction = " << doubleToString2( "%23.15e", energyFraction ) 
+                << "  expected = " << doubleToString2( "%23.15e", expectedFraction ) << std::endl;
+        return( 1 );
+    }
+
+    return( 0 );
+}
+/*
+=========================================================
+*/
+static int checkCrossSections( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareLethargy, MCGIDI::DomainHash const &a_domainHash, 
+                double a_temperature, MCGIDI::Vector<double> const &a_grid ) {
+
+    int errCount = 0;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    double energyMin = a_protare->minimumEnergy( ), energyMax = a_protare->maximumEnergy( );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 2 );
+    protares[0] = a_protare;
+    protares[1] = a_protareLethargy;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < a_grid.size( ); ++i1 ) {
+        double energy = a_grid[i1];
+        int hashIndex = a_domainHash.index( energy );
+
+        if( ( energy < energyMin ) || ( energy > energyMax ) ) continue;            // Fixed grid values are clamped outside the evaluated domain.
+        for( int i2 = -1; i2 < numberOfReactions; ++i2 ) {
+            double crossSection, crossSectionLethargy;
+
+            if( i2 < 0 ) {
+                crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy );
+                crossSectionLethargy = a_protareLethargy->crossSection( URR_protare_infos, hashIndex, a_temperature, energy ); }
+            else {
+                crossSection = a_protare->reactionCrossSection( i2, URR_protare_infos, hashIndex, a_temperature, energy );
+                crossSectionLethargy = a_protareLethargy->reactionCrossSection( i2, URR_protare_infos, hashIndex, a_temperature, energy );
+            }
+
+            if( fabs( crossSection - crossSectionLethargy ) > MCGIDI_StorageEpsilon * fabs( crossSection ) ) {
+                std::cout << "    ERROR: energy = " << doubleToString2( "%23.15e", energy ) << "  reaction index = " << i2 << "  cross section = " 
+                        << doubleToString2( "%23.15e", crossSection ) << "  equal-lethargy = " << doubleToString2( "%23.15e", crossSectionLethargy ) << std::endl;
+                ++errCount;
+            }
+        }
+    }
+
+    return( errCount );
+}
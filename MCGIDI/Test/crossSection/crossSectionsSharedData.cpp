@@ -0,0 +1,177 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static char const *description = "Compares a multi-temperature protare, whose energy grids and reaction cross sections identical across\n"
+    "temperatures are shared, to protares built from each temperature alone, which share nothing. At every point of each temperature's\n"
+    "energy grid, the total and reaction cross sections must be identical and reactions sampled with the same random numbers must be\n"
+    "the same. Shared data must also come from a lower temperature. Exits with a failure status if any check fails.";
+
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareSingle, MCGIDI::DomainHash const &a_domainHash,
+                int a_temperatureIndex, double a_temperature, unsigned long long a_seed );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    unsigned long long seed = 1;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "crossSectionsSharedData", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+
+    MCGIDI::Protare *MCProtare;
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    MCGIDI::Vector<MCGIDI::HeatedCrossSectionContinuousEnergy *> const &heatedCrossSections = MCProtare->protare( 0 )->heatedCrossSections( ).heatedCrossSections( );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < heatedCrossSections.size( ); ++i1 ) {
+        MCGIDI::HeatedCrossSectionContinuousEnergy const *heatedCrossSection = heatedCrossSections[i1];
+        int numberOfSharedReactions = 0;
+
+        if( heatedCrossSection->energyGridSource( ) >= i1 ) {
+            std::cout << "temperature index " << i1 << " has energy grid source " << heatedCrossSection->energyGridSource( ) << "  **" << std::endl;
+            ++errCount;
+        }
+        for( int i2 = 0; i2 < heatedCrossSection->numberOfReactions( ); ++i2 ) {
+            int source = heatedCrossSection->reactionCrossSection( i2 )->crossSectionSource( );
+
+            if( source < 0 ) continue;
+            ++numberOfSharedReactions;
+            if( source >= i1 ) {
+                std::cout << "temperature index " << i1 << " reaction " << i2 << " has cross section source " << source << "  **" << std::endl;
+                ++errCount;
+            }
+        }
+        std::cout << "temperature index " << i1 << ": energy grid source = " << heatedCrossSection->energyGridSource( )
+                << "  shared reactions = " << numberOfSharedReactions << " of " << heatedCrossSection->numberOfReactions( ) << std::endl;
+    }
+
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) {
+        GIDI::Styles::TemperatureInfos singleTemperature( 1, temperatures[i1] );
+        MCGIDI::Protare *MCProtareSingle;
+
+        try {
+            MCProtareSingle = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, singleTemperature, reactionsToExclude ); }
+        catch (char const *str) {
+            std::cout << str << std::endl;
+            exit( EXIT_FAILURE );
+        }
+
+        errCount += compare( MCProtare, MCProtareSingle, domainHash, (int) i1, temperatures[i1].temperature( ).value( ), seed );
+
+        delete MCProtareSingle;
+    }
+
+    delete protare;
+
+    delete MCProtare;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareSingle, MCGIDI::DomainHash const &a_domainHash,
+                int a_temperatureIndex, double a_temperature, unsigned long long a_seed ) {
+
+    int errCount = 0;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    void *rngState = nullptr;
+    long numberOfCrossSectionDifferences = 0, mismatches = 0;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+    protares[0] = a_protareSingle;
+    MCGIDI::URR_protareInfos URR_protare_infosSingle( protares );
+
+    MCGIDI::Vector<double> const &energies = a_protare->protare( 0 )->heatedCrossSections( ).heatedCrossSections( )[a_temperatureIndex]->energies( );
+    MCGIDI::Vector<double> const &energiesSingle = a_protareSingle->protare( 0 )->heatedCrossSections( ).heatedCrossSections( )[0]->energies( );
+
+    std::cout << "temperature = " << doubleToString2( "%13.6e", a_temperature ) << "  number of energies = " << energies.size( ) << std::endl;
+    if( energies.size( ) != energiesSingle.size( ) ) {
+        std::cout << "    energy grid sizes differ: " << energies.size( ) << " and " << energiesSingle.size( ) << "  **" << std::endl;
+        return( 1 );
+    }
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < energies.size( ); ++i1 ) {
+        double energy = energies[i1];
+        int hashIndex = a_domainHash.index( energy );
+
+        if( energy != energiesSingle[i1] ) ++numberOfCrossSectionDifferences;
+        if( a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy ) !=
+                a_protareSingle->crossSection( URR_protare_infosSingle, hashIndex, a_temperature, energy ) ) ++numberOfCrossSectionDifferences;
+        for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+            if( a_protare->reactionCrossSection( reactionIndex, URR_protare_infos, hashIndex, a_temperature, energy ) !=
+                    a_protareSingle->reactionCrossSection( reactionIndex, URR_protare_infosSingle, hashIndex, a_temperature, energy ) )
+                ++numberOfCrossSectionDifferences;
+        }
+
+        double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy, true );
+        if( crossSection == 0.0 ) continue;
+
+        MCGIDI_test_rngSetup( a_seed + i1 );
+        int reactionIndex = a_protare->sampleReaction( URR_protare_infos, hashIndex, a_temperature, energy, crossSection, float64RNG64, rngState );
+        MCGIDI_test_rngSetup( a_seed + i1 );
+        int reactionIndexSingle = a_protareSingle->sampleReaction( URR_protare_infosSingle, hashIndex, a_temperature, energy, crossSection,
+                float64RNG64, rngState );
+        if( reactionIndex != reactionIndexSingle ) ++mismatches;
+    }
+
+    if( ( numberOfCrossSectionDifferences > 0 ) || ( mismatches > 0 ) ) {
+        std::cout << "    cross section differences = " << numberOfCrossSectionDifferences << "  sampling mismatches = " << mismatches << "  **" << std::endl;
+        ++errCount;
+    }
+
+    return( errCount );
+}
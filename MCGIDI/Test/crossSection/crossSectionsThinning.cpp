@@ -0,0 +1,149 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static char const *description = "For several grid thinning tolerances, compares a protare with thinned continuous energy grids to the unthinned\n"
+    "one. At every point of each unthinned temperature grid, the thinned total and reaction cross sections must be within the tolerance, in\n"
+    "the relative sense used by ptwXY_thin. As the difference is linear between unthinned points, this bounds it everywhere. Each thinned grid\n"
+    "must also have no more points than the unthinned one. Exits with a failure status if any check fails.";
+
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareThinned, MCGIDI::DomainHash const &a_domainHash, 
+                GIDI::Styles::TemperatureInfos const &a_temperatures, double a_tolerance );
+static bool outsideTolerance( double a_crossSection, double a_crossSectionThinned, double a_tolerance );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    int errCount = 0;
+    double tolerances[] = { 1e-4, 1e-3, 1e-2 };
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "crossSectionsThinning", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+
+    for( std::size_t i1 = 0; i1 < sizeof( tolerances ) / sizeof( tolerances[0] ); ++i1 ) {
+        MC.gridThinningTolerance( tolerances[i1] );
+        MCGIDI::Protare *MCProtareThinned = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+
+        errCount += compare( MCProtare, MCProtareThinned, domainHash, temperatures, tolerances[i1] );
+        delete MCProtareThinned;
+    }
+
+    delete protare;
+
+    delete MCProtare;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareThinned, MCGIDI::DomainHash const &a_domainHash, 
+                GIDI::Styles::TemperatureInfos const &a_temperatures, double a_tolerance ) {
+
+    int errCount = 0;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    MCGIDI::HeatedCrossSectionsContinuousEnergy const &heatedCrossSections = a_protare->protare( 0 )->heatedCrossSections( );
+    MCGIDI::HeatedCrossSectionsContinuousEnergy const &heatedCrossSectionsThinned = a_protareThinned->protare( 0 )->heatedCrossSections( );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 2 );
+    protares[0] = a_protare;
+    protares[1] = a_protareThinned;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    for( std::size_t i1 = 0; i1 < a_temperatures.size( ); ++i1 ) {
+        double temperature = a_temperatures[i1].temperature( ).value( );
+        MCGIDI::Vector<double> const &energies = heatedCrossSections.energies( (int) i1 );
+        int temperatureErrCount = 0;
+
+        std::cout << "tolerance = " << doubleToString2( "%8.1e", a_tolerance ) << "  temperature = " << doubleToString2( "%13.6e", temperature )
+                << "  points = " << energies.size( ) << "  thinned points = " << heatedCrossSectionsThinned.energies( (int) i1 ).size( ) << std::endl;
+        if( heatedCrossSectionsThinned.energies( (int) i1 ).size( ) > energies.size( ) ) {
+            std::cout << "    ERROR: thinned grid is larger than unthinned grid" << std::endl;
+            ++temperatureErrCount;
+        }
+
+        for( MCGIDI_VectorSizeType i2 = 0; i2 < energies.size( ); ++i2 ) {
+            double energy = energies[i2];
+            int hashIndex = a_domainHash.index( energy );
+            double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+            double crossSectionThinned = a_protareThinned->crossSection( URR_protare_infos, hashIndex, temperature, energy );
+
+            if( outsideTolerance( crossSection, crossSectionThinned, a_tolerance ) ) {
+                std::cout << "    ERROR: energy = " << doubleToString2( "%23.15e", energy ) << "  total cross section = " 
+                        << doubleToString2( "%23.15e", crossSection ) << "  thinned = " << doubleToString2( "%23.15e", crossSectionThinned ) << std::endl;
+                ++temperatureErrCount;
+            }
+
+            for( int i3 = 0; i3 < numberOfReactions; ++i3 ) {
+                double reactionCrossSection = a_protare->reactionCrossSection( i3, URR_protare_infos, hashIndex, temperature, energy );
+                double reactionCrossSectionThinned = a_protareThinned->reactionCrossSection( i3, URR_protare_infos, hashIndex, temperature, energy );
+
+                if( outsideTolerance( reactionCrossSection, reactionCrossSectionThinned, a_tolerance ) ) {
+                    std::cout << "    ERROR: energy = " << doubleToString2( "%23.15e", energy ) << "  reaction " << i3 << " cross section = " 
+                            << doubleToString2( "%23.15e", reactionCrossSection ) << "  thinned = " << doubleToString2( "%23.15e", reactionCrossSectionThinned ) 
+                            << std::endl;
+                    ++temperatureErrCount;
+                }
+            }
+        }
+        errCount += temperatureErrCount;
+    }
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static bool outsideTolerance( double a_crossSection, double a_crossSectionThinned, double a_tolerance ) {
+
+    double difference = fabs( a_crossSectionThinned - a_crossSection );
+
+    return( difference > 0.5 * a_tolerance * ( fabs( a_crossSection ) + fabs( a_crossSectionThinned ) ) + MCGIDI_StorageEpsilon * fabs( a_crossSection ) );
+}
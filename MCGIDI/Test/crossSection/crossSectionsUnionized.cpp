@@ -0,0 +1,197 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static char const *description = "Compares a ProtareComposite built with the unionized energy grid to one built without it. At each stored\n"
+    "temperature, midway between the first two and over a log grid of energies plus each constituent's grid points, the total (sampling and\n"
+    "non-sampling) and reaction cross sections must agree, and reaction sampling with the same random number sequence must pick the same\n"
+    "reactions. Exits with a failure status if any check fails. If projectile is a photon, see options *-a* and *-n*.";
+
+#define numberOfSamples 1000
+
+static int compare( MCGIDI::Protare *a_protare1, MCGIDI::Protare *a_protare2, MCGIDI::DomainHash const &a_domainHash, double a_temperature, 
+                double a_energy );
+static bool crossSectionsDiffer( double a_crossSection1, double a_crossSection2 );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    std::set<int> reactionsToExclude;
+    GIDI::Construction::PhotoMode photo_mode = GIDI::Construction::PhotoMode::nuclearOnly;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "crossSectionsUnionized", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--pid", true, "The PoPs id of the projectile." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-a", false, "Include photo-atomic protare if relevant. If present, disables photo-nuclear unless *-n* present." ) );
+    argv_options.add( argvOption2( "-n", false, "Include photo-nuclear protare if relevant. This is the default unless *-a* present." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/Data/MG_MC/all.map" );
+    std::string projectileID = argv_options.find( "--pid" )->zeroOrOneOption( argv, PoPI::IDs::photon );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+
+    if( argv_options.find( "-a" )->present( ) ) {
+        photo_mode = GIDI::Construction::PhotoMode::atomicOnly;
+        if( argv_options.find( "-n" )->present( ) ) photo_mode = GIDI::Construction::PhotoMode::nuclearAndAtomic;
+    }
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, photo_mode );
+        protare = map.protare( construction, pops, projectileID, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, projectileID, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare, *MCProtareUnionized;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        MC.wantUnionizedGrid( true );
+        MCProtareUnionized = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    if( MCProtareUnionized->protareType( ) != MCGIDI::ProtareType::composite ) {
+        std::cout << "ERROR: protare is not a ProtareComposite." << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    if( !static_cast<MCGIDI::ProtareComposite *>( MCProtareUnionized )->unionizedGrid( ).isActive( ) ) {
+        std::cout << "ERROR: unionized grid not built." << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    std::vector<double> sampleTemperatures;
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) sampleTemperatures.push_back( temperatures[i1].temperature( ).value( ) );
+    if( temperatures.size( ) > 1 ) sampleTemperatures.push_back( 0.5 * ( sampleTemperatures[0] + sampleTemperatures[1] ) );
+
+    std::vector<double> energies;
+    for( double energy = 1e-11; energy < 100.0; energy *= 1.2 ) energies.push_back( energy );
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < MCProtare->numberOfProtares( ); ++i1 ) {
+        MCGIDI::Vector<double> const &grid = MCProtare->protare( i1 )->heatedCrossSections( ).energies( 0 );
+
+        for( MCGIDI_VectorSizeType i2 = 0; i2 < grid.size( ); i2 += 7 ) {
+            energies.push_back( grid[i2] );
+            if( i2 + 1 < grid.size( ) ) energies.push_back( 0.5 * ( grid[i2] + grid[i2+1] ) );
+        }
+    }
+
+    for( std::size_t i1 = 0; i1 < sampleTemperatures.size( ); ++i1 ) {
+        int temperatureErrCount = 0;
+
+        for( std::size_t i2 = 0; i2 < energies.size( ); ++i2 ) {
+            temperatureErrCount += compare( MCProtare, MCProtareUnionized, domainHash, sampleTemperatures[i1], energies[i2] );
+        }
+        std::cout << "temperature = " << doubleToString2( "%13.6e", sampleTemperatures[i1] ) << "  number of energies = " << energies.size( )
+                << "  errors = " << temperatureErrCount << std::endl;
+        errCount += temperatureErrCount;
+    }
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareUnionized;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int compare( MCGIDI::Protare *a_protare1, MCGIDI::Protare *a_protare2, MCGIDI::DomainHash const &a_domainHash, double a_temperature, 
+                double a_energy ) {
+
+    int errCount = 0;
+    int hashIndex = a_domainHash.index( a_energy );
+    void *rngState = nullptr;
+    unsigned long long seed = 1;
+    long mismatches = 0;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares1( 1 ), protares2( 1 );
+    protares1[0] = a_protare1;
+    protares2[0] = a_protare2;
+    MCGIDI::URR_protareInfos URR_protare_infos1( protares1 ), URR_protare_infos2( protares2 );
+
+    for( int sampling = 0; sampling < 2; ++sampling ) {
+        double crossSection1 = a_protare1->crossSection( URR_protare_infos1, hashIndex, a_temperature, a_energy, sampling == 1 );
+        double crossSection2 = a_protare2->crossSection( URR_protare_infos2, hashIndex, a_temperature, a_energy, sampling == 1 );
+
+        if( crossSectionsDiffer( crossSection1, crossSection2 ) ) {
+            std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", a_energy ) << "  sampling = " << sampling << "  cross sections differ: " 
+                    << doubleToString2( "%23.15e", crossSection1 ) << "  " << doubleToString2( "%23.15e", crossSection2 ) << std::endl;
+            ++errCount;
+        }
+    }
+
+    for( std::size_t i1 = 0; i1 < a_protare1->numberOfReactions( ); ++i1 ) {
+        double reactionCrossSection1 = a_protare1->reactionCrossSection( i1, URR_protare_infos1, hashIndex, a_temperature, a_energy );
+        double reactionCrossSection2 = a_protare2->reactionCrossSection( i1, URR_protare_infos2, hashIndex, a_temperature, a_energy );
+
+        if( crossSectionsDiffer( reactionCrossSection1, reactionCrossSection2 ) ) {
+            std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", a_energy ) << "  reaction " << i1 << " cross sections differ: " 
+                    << doubleToString2( "%23.15e", reactionCrossSection1 ) << "  " << doubleToString2( "%23.15e", reactionCrossSection2 ) << std::endl;
+            ++errCount;
+        }
+    }
+
+    double crossSection = a_protare1->crossSection( URR_protare_infos1, hashIndex, a_temperature, a_energy, true );
+    if( crossSection == 0.0 ) return( errCount );
+
+    std::vector<int> sampled( numberOfSamples );
+    MCGIDI_test_rngSetup( seed );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        sampled[i1] = a_protare1->sampleReaction( URR_protare_infos1, hashIndex, a_temperature, a_energy, crossSection, float64RNG64, rngState );
+    }
+    MCGIDI_test_rngSetup( seed );
+    for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+        if( a_protare2->sampleReaction( URR_protare_infos2, hashIndex, a_temperature, a_energy, crossSection, float64RNG64, rngState ) != sampled[i1] ) ++mismatches;
+    }
+    if( mismatches > 0 ) {
+        std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", a_energy ) << "  sampled reaction mismatches = " << mismatches << std::endl;
+        ++errCount;
+    }
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static bool crossSectionsDiffer( double a_crossSection1, double a_crossSection2 ) {
+
+    return( fabs( a_crossSection1 - a_crossSection2 ) > 1e-12 * std::max( fabs( a_crossSection1 ), fabs( a_crossSection2 ) ) );
+}
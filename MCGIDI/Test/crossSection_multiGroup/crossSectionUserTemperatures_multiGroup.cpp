@@ -0,0 +1,252 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "Compares the multi-group data of a protare with tables stored at a list of user temperatures to the same protare\n"
+    "without them, which interpolates between the tabulated temperatures on each lookup. The user temperature list also contains a\n"
+    "tabulated temperature and one above the data, which must not be stored. At each stored user temperature and every group, the total,\n"
+    "reaction, deposition, production and gain data must agree to round-off and the sampled reaction tallies must pass a two-sample\n"
+    "chi-square test. Exits with a failure status if any check fails.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static MCGIDI::Protare *getMCProtare( GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Transporting::Particles const &a_particles, MCGIDI::DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfos const &a_temperatures );
+static int compareValue( char const *a_name, double a_value, double a_userValue );
+static int compareSampling( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_userProtare, int a_hashIndex, double a_temperature, double a_energy,
+                long a_numberOfSamples, unsigned long long a_seed );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    int neutronIndex = pops[PoPI::IDs::neutron];
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "crossSectionUserTemperatures_multiGroup", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of reaction samples per user temperature and group." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 10 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    if( temperatures.size( ) < 2 ) {
+        std::cout << "Protare must have at least two temperatures." << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    std::string label( temperatures[0].heatedMultiGroup( ) );
+
+    GIDI::Transporting::Groups_from_bdfls groups_from_bdfls( "../../../GIDI/Test/bdfls" );
+    GIDI::Transporting::Fluxes_from_bdfls fluxes_from_bdfls( "../../../GIDI/Test/bdfls", 0.0 );
+
+    GIDI::Transporting::MultiGroup multi_group = groups_from_bdfls.viaLabel( "LLNL_gid_4" );
+    GIDI::Transporting::Particle projectile( PoPI::IDs::neutron, multi_group );
+    projectile.appendFlux( fluxes_from_bdfls.getViaFID( 1 ) );
+    particles.add( projectile );
+    particles.process( *protare, label );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.crossSectionLookupMode( MCGIDI::Transporting::LookupMode::Data1d::multiGroup );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+
+    MCGIDI::Protare *MCProtare = getMCProtare( *protare, pops, MC, particles, domainHash, temperatures );
+    MCGIDI::Protare *MCProtareUser = getMCProtare( *protare, pops, MC, particles, domainHash, temperatures );
+
+    std::vector<double> expectedUserTemperatures;
+    for( std::size_t i1 = 0; i1 < temperatures.size( ) - 1; ++i1 ) {
+        double temperature1 = temperatures[i1].temperature( ).value( ), temperature2 = temperatures[i1+1].temperature( ).value( );
+
+        expectedUserTemperatures.push_back( 0.75 * temperature1 + 0.25 * temperature2 );
+        expectedUserTemperatures.push_back( 0.5 * ( temperature1 + temperature2 ) );
+    }
+
+    std::vector<double> userTemperatures( expectedUserTemperatures.rbegin( ), expectedUserTemperatures.rend( ) );
+    userTemperatures.push_back( temperatures[0].temperature( ).value( ) );                      // Tabulated, must be ignored.
+    userTemperatures.push_back( 2.0 * temperatures.back( ).temperature( ).value( ) );          // Outside the data, must be ignored.
+    MCProtareUser->setMultiGroupUserTemperatures( userTemperatures );
+
+    MCGIDI::Vector<double> const &storedUserTemperatures = MCProtareUser->protare( 0 )->heatedMultigroupCrossSections( ).userTemperatures( );
+    std::cout << "number of user temperatures = " << storedUserTemperatures.size( ) << std::endl;
+    if( (std::size_t) storedUserTemperatures.size( ) != expectedUserTemperatures.size( ) ) {
+        std::cout << "    expected " << expectedUserTemperatures.size( ) << " user temperatures  **" << std::endl;
+        ++errCount; }
+    else {
+        for( std::size_t i1 = 0; i1 < expectedUserTemperatures.size( ); ++i1 ) {
+            if( storedUserTemperatures[i1] != expectedUserTemperatures[i1] ) {
+                std::cout << "    user temperature " << doubleToString2( "%13.6e", storedUserTemperatures[i1] ) << " expected "
+                        << doubleToString2( "%13.6e", expectedUserTemperatures[i1] ) << "  **" << std::endl;
+                ++errCount;
+            }
+        }
+    }
+
+    MCGIDI::MultiGroupHash multiGroupHash( *protare, temperatures[0] );
+    MCGIDI::Vector<double> const &boundaries = multiGroupHash.boundaries( );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+    protares[0] = MCProtareUser;
+    MCGIDI::URR_protareInfos URR_protare_infosUser( protares );
+
+    for( std::size_t i1 = 0; i1 < expectedUserTemperatures.size( ); ++i1 ) {
+        double temperature = expectedUserTemperatures[i1];
+
+        std::cout << "temperature = " << doubleToString2( "%13.6e", temperature ) << std::endl;
+        for( MCGIDI_VectorSizeType i2 = 0; i2 < boundaries.size( ) - 1; ++i2 ) {
+            if( boundaries[i2] >= 20.0 ) break;
+            double energy = sqrt( boundaries[i2] * boundaries[i2+1] );
+            int hashIndex = multiGroupHash.index( energy );
+            int groupErrCount = 0;
+
+            for( int sampling = 0; sampling < 2; ++sampling ) {
+                groupErrCount += compareValue( "crossSection", MCProtare->crossSection( URR_protare_infos, hashIndex, temperature, energy, sampling != 0 ),
+                        MCProtareUser->crossSection( URR_protare_infosUser, hashIndex, temperature, energy, sampling != 0 ) );
+            }
+            for( std::size_t reactionIndex = 0; reactionIndex < MCProtare->numberOfReactions( ); ++reactionIndex ) {
+                groupErrCount += compareValue( "reactionCrossSection",
+                        MCProtare->reactionCrossSection( (int) reactionIndex, URR_protare_infos, hashIndex, temperature, energy ),
+                        MCProtareUser->reactionCrossSection( (int) reactionIndex, URR_protare_infosUser, hashIndex, temperature, energy ) );
+            }
+            groupErrCount += compareValue( "depositionEnergy", MCProtare->depositionEnergy( hashIndex, temperature, energy ),
+                    MCProtareUser->depositionEnergy( hashIndex, temperature, energy ) );
+            groupErrCount += compareValue( "depositionMomentum", MCProtare->depositionMomentum( hashIndex, temperature, energy ),
+                    MCProtareUser->depositionMomentum( hashIndex, temperature, energy ) );
+            groupErrCount += compareValue( "productionEnergy", MCProtare->productionEnergy( hashIndex, temperature, energy ),
+                    MCProtareUser->productionEnergy( hashIndex, temperature, energy ) );
+            groupErrCount += compareValue( "gain", MCProtare->gain( hashIndex, temperature, energy, neutronIndex ),
+                    MCProtareUser->gain( hashIndex, temperature, energy, neutronIndex ) );
+            if( groupErrCount > 0 ) std::cout << "    at group = " << hashIndex << "  energy = " << doubleToString2( "%13.6e", energy ) << std::endl;
+            errCount += groupErrCount;
+
+            errCount += compareSampling( MCProtare, MCProtareUser, hashIndex, temperature, energy, numberOfSamples, seed );
+        }
+    }
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareUser;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static MCGIDI::Protare *getMCProtare( GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Transporting::Particles const &a_particles, MCGIDI::DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfos const &a_temperatures ) {
+
+    std::set<int> reactionsToExclude;
+    MCGIDI::Protare *MCProtare = nullptr;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( a_protare, a_pops, a_MC, a_particles, a_domainHash, a_temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    return( MCProtare );
+}
+/*
+=========================================================
+*/
+static int compareValue( char const *a_name, double a_value, double a_userValue ) {
+
+    double tolerance = 1e-12 + MCGIDI_StorageEpsilon;
+
+    if( fabs( a_value - a_userValue ) <= tolerance * 0.5 * ( fabs( a_value ) + fabs( a_userValue ) ) ) return( 0 );
+
+    std::cout << "    " << a_name << " = " << doubleToString2( "%20.12e", a_value ) << "  user temperature table = "
+            << doubleToString2( "%20.12e", a_userValue ) << "  **" << std::endl;
+
+    return( 1 );
+}
+/*
+=========================================================
+*/
+static int compareSampling( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_userProtare, int a_hashIndex, double a_temperature, double a_energy,
+                long a_numberOfSamples, unsigned long long a_seed ) {
+
+    int errCount = 0, dof;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    void *rngState = nullptr;
+    long mismatches = 0;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+    protares[0] = a_userProtare;
+    MCGIDI::URR_protareInfos URR_protare_infosUser( protares );
+
+    double crossSection = a_protare->crossSection( URR_protare_infos, a_hashIndex, a_temperature, a_energy, true );
+    double userCrossSection = a_userProtare->crossSection( URR_protare_infosUser, a_hashIndex, a_temperature, a_energy, true );
+    if( crossSection == 0.0 ) return( errCount );
+
+    std::vector<int> sampled( a_numberOfSamples );
+    std::vector<double> counts1( numberOfReactions + 1, 0.0 ), counts2( numberOfReactions + 1, 0.0 );       // Last for the null reaction.
+
+    MCGIDI_test_rngSetup( a_seed );
+    for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+        sampled[i1] = a_protare->sampleReaction( URR_protare_infos, a_hashIndex, a_temperature, a_energy, crossSection, float64RNG64, rngState );
+        if( ( sampled[i1] < 0 ) || ( sampled[i1] > numberOfReactions ) ) sampled[i1] = numberOfReactions;
+        ++counts1[sampled[i1]];
+    }
+
+    MCGIDI_test_rngSetup( a_seed );
+    for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+        int reactionIndex = a_userProtare->sampleReaction( URR_protare_infosUser, a_hashIndex, a_temperature, a_energy, userCrossSection, float64RNG64, rngState );
+
+        if( ( reactionIndex < 0 ) || ( reactionIndex > numberOfReactions ) ) reactionIndex = numberOfReactions;
+        ++counts2[reactionIndex];
+        if( reactionIndex != sampled[i1] ) ++mismatches;
+    }
+
+    double chiSquare = MCGIDI_test_chiSquarePerDOF( counts1, counts2, dof );
+    bool flagged = MCGIDI_test_chiSquareFlagged( chiSquare, dof );
+
+    if( flagged ) {
+        std::cout << "    energy = " << doubleToString2( "%13.6e", a_energy ) << "  group = " << a_hashIndex << "  mismatches = " << mismatches
+                << "  chi^2/dof = " << doubleToString2( "%8.3f", chiSquare ) << " (" << dof << ")  **" << std::endl;
+        ++errCount;
+    }
+
+    return( errCount );
+}
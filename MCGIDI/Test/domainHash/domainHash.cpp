@@ -8,12 +8,19 @@
 */
 
 #include <stdlib.h>
+#include <math.h>
 #include <iostream>
+#include <algorithm>
 
 #include "MCGIDI.hpp"
 
 static int check( std::vector<double> &domain );
 static int check2( int bins, double domainMin, double domainMax, std::vector<double> &domain );
+static int checkExponentBits( int bins, double domainMin, double domainMax );
+static long exponentBitsKey( double value, int mantissaBits );
+static int checkEqualPoints( int bins, double domainMin, double domainMax, std::vector<double> const &grid );
+static int checkEdge( MCGIDI::DomainHash const &domainHash, int bin, double edge );
+static int checkSerialize( MCGIDI::DomainHash const &domainHash );
 /*
 =========================================================
 */
@@ -76,6 +83,29 @@ int main( int argc, char **argv ) {
     domain1.erase( domain1.begin( ) );
     errCount += check( domain1 );
 
+    errCount += checkExponentBits(  3, 1.0, 100.0 );
+    errCount += checkExponentBits( 10, 1e-11, 20.0 );
+    errCount += checkExponentBits( 64, 1.0, 128.0 );
+    errCount += checkExponentBits( 40, 0.75, 3.0 );
+
+    std::vector<double> grid;
+    for( double value = 1e-3; value < 1e3; value *= 1.5 ) grid.push_back( value );
+    grid.push_back( grid[10] );                                 // Duplicate points must not change the bins.
+    grid.push_back( grid[20] );
+    errCount += checkEqualPoints(  5, 1e-2, 1e2, grid );
+    errCount += checkEqualPoints(  8, 1e-2, 1e2, grid );
+    errCount += checkEqualPoints( 40, 1e-2, 1e2, grid );        // More bins than points, so the number of bins is reduced.
+
+    try {
+        MCGIDI::DomainHash domainHash( MCGIDI::DomainHashMode::equalPoints, 10, 1.0, 100.0 );
+        std::cout << "  DomainHashMode::equalPoints without a grid did not throw" << std::endl;
+        ++errCount; }
+    catch (char const *str) {
+        std::cout << std::endl << "  DomainHashMode::equalPoints without a grid threw: " << str << std::endl;
+    }
+
+    std::cout << "errCount = " << errCount << std::endl;
+
     exit( errCount );
 }
 /*
@@ -137,3 +167,179 @@ static int check2( int bins, double domainMin, double domainMax, std::vector<dou
 
     return( errCount );
 }
+/*
+=========================================================
+*/
+static int checkExponentBits( int bins, double domainMin, double domainMax ) {
+
+    int errCount = 0;
+
+    std::cout << std::endl << "  DomainHashMode::exponentBits: requested bins = " << bins << std::endl;
+
+    MCGIDI::DomainHash domainHash( MCGIDI::DomainHashMode::exponentBits, bins, domainMin, domainMax );
+    domainHash.print( true );
+
+    if( domainHash.bins( ) < bins ) {
+        std::cout << "  too few bins" << std::endl;
+        ++errCount;
+    }
+
+    int mantissaBits = domainHash.mantissaBits( );
+    long keyMin = exponentBitsKey( domainMin, mantissaBits );
+
+    if( domainHash.index( 0.5 * domainMin ) != 0 ) ++errCount;
+    if( domainHash.index( nextafter( domainMin, 0.0 ) ) != 0 ) ++errCount;
+    if( domainHash.index( domainMin ) != 1 ) ++errCount;
+    if( domainHash.index( domainMax ) != domainHash.bins( ) ) ++errCount;
+    if( domainHash.index( nextafter( domainMax, 2.0 * domainMax ) ) != domainHash.bins( ) + 1 ) ++errCount;
+    if( domainHash.index( 2.0 * domainMax ) != domainHash.bins( ) + 1 ) ++errCount;
+
+    int lastIndex = 0;
+    for( double value = domainMin; value <= domainMax; value *= 1.01 ) {            // Compare to an index computed with frexp.
+        int index = domainHash.index( value );
+
+        if( index < lastIndex ) ++errCount;
+        if( index != exponentBitsKey( value, mantissaBits ) - keyMin + 1 ) {
+            std::cout << "  bad index " << index << " for value " << value << std::endl;
+            ++errCount;
+        }
+        lastIndex = index;
+    }
+
+    for( double value = ldexp( 1.0, ilogb( domainMin ) ); value <= domainMax; value *= 2.0 ) {      // Exact powers of two start a bin.
+        if( value <= domainMin ) continue;
+        int index = domainHash.index( value );
+
+        std::cout << "  power of two " << value << "  index = " << index << std::endl;
+        if( index != exponentBitsKey( value, mantissaBits ) - keyMin + 1 ) ++errCount;
+        errCount += checkEdge( domainHash, index - 1, value );
+    }
+
+    long numberOfMantissaBins = 1L << mantissaBits;
+    for( int bin = 1; bin < domainHash.bins( ); ++bin ) {                           // Every bin edge from the key of the bin.
+        long key = keyMin + bin;
+        double edge = ldexp( 1.0 + (double) ( key % numberOfMantissaBins ) / numberOfMantissaBins, (int) ( key / numberOfMantissaBins ) - 1023 );
+
+        errCount += checkEdge( domainHash, bin, edge );
+    }
+
+    errCount += checkSerialize( domainHash );
+
+    std::cout << "  errors = " << errCount << std::endl;
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static long exponentBitsKey( double value, int mantissaBits ) {
+
+    int exponent;
+    double mantissa = frexp( value, &exponent );                                    // value = mantissa * 2^exponent with mantissa in [0.5, 1).
+    long numberOfMantissaBins = 1L << mantissaBits;
+
+    return( ( exponent + 1022 ) * numberOfMantissaBins + (long) floor( ( 2.0 * mantissa - 1.0 ) * numberOfMantissaBins ) );
+}
+/*
+=========================================================
+*/
+static int checkEqualPoints( int bins, double domainMin, double domainMax, std::vector<double> const &grid ) {
+
+    int errCount = 0;
+
+    std::cout << std::endl << "  DomainHashMode::equalPoints: requested bins = " << bins << "  grid size = " << grid.size( ) << std::endl;
+
+    MCGIDI::DomainHash domainHash( bins, domainMin, domainMax, grid );
+    domainHash.print( true );
+
+    MCGIDI::Vector<double> const &boundaries = domainHash.boundaries( );
+    if( boundaries.size( ) != static_cast<MCGIDI_VectorSizeType>( domainHash.bins( ) + 1 ) ) ++errCount;
+    if( boundaries[0] != domainMin ) ++errCount;
+    if( boundaries.back( ) != domainMax ) ++errCount;
+    for( MCGIDI_VectorSizeType i1 = 1; i1 < boundaries.size( ); ++i1 ) {
+        if( boundaries[i1] <= boundaries[i1-1] ) ++errCount;
+    }
+
+    if( domainHash.index( nextafter( domainMin, 0.0 ) ) != 0 ) ++errCount;
+    if( domainHash.index( domainMin ) != 1 ) ++errCount;
+    if( domainHash.index( domainMax ) != domainHash.bins( ) ) ++errCount;
+    if( domainHash.index( nextafter( domainMax, 2.0 * domainMax ) ) != domainHash.bins( ) + 1 ) ++errCount;
+
+    for( int bin = 1; bin < domainHash.bins( ); ++bin ) errCount += checkEdge( domainHash, bin, boundaries[bin] );
+
+    std::vector<int> counts( domainHash.bins( ) + 2, 0 );
+    std::vector<double> sortedGrid( grid );
+    std::sort( sortedGrid.begin( ), sortedGrid.end( ) );
+    sortedGrid.erase( std::unique( sortedGrid.begin( ), sortedGrid.end( ) ), sortedGrid.end( ) );
+    for( std::size_t i1 = 0; i1 < sortedGrid.size( ); ++i1 ) {
+        if( ( sortedGrid[i1] > domainMin ) && ( sortedGrid[i1] < domainMax ) ) ++counts[domainHash.index( sortedGrid[i1] )];
+    }
+    int minimumCount = counts[1], maximumCount = counts[1];
+    std::cout << "  points per bin =";
+    for( int bin = 1; bin <= domainHash.bins( ); ++bin ) {
+        std::cout << " " << counts[bin];
+        if( counts[bin] < minimumCount ) minimumCount = counts[bin];
+        if( counts[bin] > maximumCount ) maximumCount = counts[bin];
+    }
+    std::cout << std::endl;
+    if( maximumCount - minimumCount > 1 ) ++errCount;
+
+    errCount += checkSerialize( domainHash );
+
+    std::cout << "  errors = " << errCount << std::endl;
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static int checkEdge( MCGIDI::DomainHash const &domainHash, int bin, double edge ) {
+
+    int errCount = 0;
+
+    if( domainHash.index( edge ) != bin + 1 ) ++errCount;
+    if( domainHash.index( nextafter( edge, 0.0 ) ) != bin ) ++errCount;
+    if( errCount > 0 ) std::cout << "  bad bin edge " << edge << " for bin " << bin << std::endl;
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static int checkSerialize( MCGIDI::DomainHash const &domainHash ) {
+
+    int errCount = 0;
+    MCGIDI::DomainHash domainHash1( domainHash );
+    MCGIDI::DomainHash domainHash2;
+    MCGIDI::DataBuffer dataBuffer;
+
+    domainHash1.serialize( dataBuffer, MCGIDI::DataBuffer::Mode::Count );
+    dataBuffer.allocateBuffers( );
+    dataBuffer.zeroIndexes( );
+    domainHash1.serialize( dataBuffer, MCGIDI::DataBuffer::Mode::Pack );
+    dataBuffer.zeroIndexes( );
+    domainHash2.serialize( dataBuffer, MCGIDI::DataBuffer::Mode::Unpack );
+
+    if( domainHash2.mode( ) != domainHash.mode( ) ) ++errCount;
+    if( domainHash2.bins( ) != domainHash.bins( ) ) ++errCount;
+    if( domainHash2.domainMin( ) != domainHash.domainMin( ) ) ++errCount;
+    if( domainHash2.domainMax( ) != domainHash.domainMax( ) ) ++errCount;
+    if( domainHash2.inverse_du( ) != domainHash.inverse_du( ) ) ++errCount;
+    if( domainHash2.mantissaBits( ) != domainHash.mantissaBits( ) ) ++errCount;
+    if( domainHash2.bitsOffset( ) != domainHash.bitsOffset( ) ) ++errCount;
+    if( domainHash2.boundaries( ).size( ) != domainHash.boundaries( ).size( ) ) {
+        ++errCount; }
+    else {
+        for( MCGIDI_VectorSizeType i1 = 0; i1 < domainHash.boundaries( ).size( ); ++i1 ) {
+            if( domainHash2.boundaries( )[i1] != domainHash.boundaries( )[i1] ) ++errCount;
+        }
+    }
+
+    for( double value = 0.5 * domainHash.domainMin( ); value < 2.0 * domainHash.domainMax( ); value *= 1.1 ) {
+        if( domainHash2.index( value ) != domainHash.index( value ) ) ++errCount;
+    }
+
+    std::cout << "  serialize round trip errors = " << errCount << std::endl;
+
+    return( errCount );
+}
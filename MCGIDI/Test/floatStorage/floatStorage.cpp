@@ -0,0 +1,233 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "At various projectile energies, writes the total and reaction cross sections and a fixed seed tally of sampled\n"
+    "reactions to a file, or compares them to those in a file written by another build (e.g., one with MCGIDI_FloatStorage defined).\n"
+    "Cross sections must agree to a relative tolerance and each tally must pass a two-sample chi-square test. Also checks that the\n"
+    "cumulative reaction cross section table is stored as double and sums the reaction cross sections without loss.";
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+#include <set>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+#define crossSectionRelativeTolerance 1e-5
+
+static_assert( std::is_same<decltype( std::declval<MCGIDI::HeatedCrossSectionContinuousEnergy>( ).cumulativeReactionCrossSectionsAt( 0 ) ),
+        double const *>::value, "The cumulative reaction cross section table must be stored as double." );
+
+static int checkCumulativeTables( MCGIDI::Protare const *a_protare );
+static bool crossSectionsDiffer( double a_crossSection1, double a_crossSection2 );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    void *rngState = nullptr;
+    unsigned long long seed = 1;
+    std::set<int> reactionsToExclude;
+    int errCount = 0;
+    FILE *fOut = nullptr, *fIn = nullptr;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "floatStorage", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of reaction samples per energy." ) );
+    argv_options.add( argvOption2( "-o", true, "The file to write the cross sections and tallies to." ) );
+    argv_options.add( argvOption2( "--compare", true, "The file, written with *-o*, to compare the cross sections and tallies to." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 100 * 1000 );
+    std::string outputFilename = argv_options.find( "-o" )->zeroOrOneOption( argv, "" );
+    std::string compareFilename = argv_options.find( "--compare" )->zeroOrOneOption( argv, "" );
+
+    if( outputFilename != "" ) {
+        if( ( fOut = fopen( outputFilename.c_str( ), "w" ) ) == nullptr ) {
+            std::cout << "Could not open file " << outputFilename << std::endl;
+            exit( EXIT_FAILURE );
+        }
+    }
+    if( compareFilename != "" ) {
+        if( ( fIn = fopen( compareFilename.c_str( ), "r" ) ) == nullptr ) {
+            std::cout << "Could not open file " << compareFilename << std::endl;
+            exit( EXIT_FAILURE );
+        }
+    }
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    MCGIDI_test_rngSetup( seed );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = (GIDI::Protare *) map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.wantCumulativeReactionCrossSections( true );
+
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare;
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    std::cout << "sizeof( MCGIDI_StorageType ) = " << sizeof( MCGIDI_StorageType ) << std::endl;
+    errCount += checkCumulativeTables( MCProtare );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = MCProtare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    int numberOfReactions = (int) MCProtare->numberOfReactions( );
+    double temperature = temperatures[0].temperature( ).value( );
+
+    std::vector<double> reactionCrossSections( numberOfReactions );
+    std::vector<double> counts( numberOfReactions ), countsCompare( numberOfReactions );
+    for( double energy = 1e-11; energy < 20.0; energy *= 4.3 ) {
+        int hashIndex = domainHash.index( energy );
+        double crossSection = MCProtare->crossSection( URR_protare_infos, hashIndex, temperature, energy, true );
+
+        std::fill( counts.begin( ), counts.end( ), 0.0 );
+        for( int i1 = 0; i1 < numberOfReactions; ++i1 ) {
+            reactionCrossSections[i1] = MCProtare->reactionCrossSection( i1, URR_protare_infos, hashIndex, temperature, energy, true );
+        }
+        for( long i1 = 0; i1 < numberOfSamples; ++i1 ) {
+            int reactionIndex = MCProtare->sampleReaction( URR_protare_infos, hashIndex, temperature, energy, crossSection, float64RNG64, rngState );
+            if( ( reactionIndex >= 0 ) && ( reactionIndex < numberOfReactions ) ) ++counts[reactionIndex];
+        }
+
+        std::cout << "energy = " << doubleToString2( "%13.6e", energy ) << "  cross section = " << doubleToString2( "%17.9e", crossSection );
+        if( fOut != nullptr ) {
+            fprintf( fOut, "%23.15e %23.15e %d\n", energy, crossSection, numberOfReactions );
+            for( int i1 = 0; i1 < numberOfReactions; ++i1 ) fprintf( fOut, "    %23.15e %12.0f\n", reactionCrossSections[i1], counts[i1] );
+        }
+
+        if( fIn != nullptr ) {
+            double energyCompare, crossSectionCompare, reactionCrossSectionCompare;
+            int numberOfReactionsCompare, dof;
+            bool flagged = false;
+
+            if( ( fscanf( fIn, "%lf %lf %d", &energyCompare, &crossSectionCompare, &numberOfReactionsCompare ) != 3 ) ||
+                    ( numberOfReactionsCompare != numberOfReactions ) || ( fabs( energyCompare - energy ) > 1e-12 * energy ) ) {
+                std::cout << std::endl << "ERROR: compare file does not match this protare or energy list." << std::endl;
+                exit( EXIT_FAILURE );
+            }
+            if( crossSectionsDiffer( crossSection, crossSectionCompare ) ) {
+                std::cout << "  ERROR: compare cross section = " << doubleToString2( "%17.9e", crossSectionCompare );
+                ++errCount;
+            }
+            for( int i1 = 0; i1 < numberOfReactions; ++i1 ) {
+                if( fscanf( fIn, "%lf %lf", &reactionCrossSectionCompare, &countsCompare[i1] ) != 2 ) {
+                    std::cout << std::endl << "ERROR: compare file is truncated." << std::endl;
+                    exit( EXIT_FAILURE );
+                }
+                if( crossSectionsDiffer( reactionCrossSections[i1], reactionCrossSectionCompare ) ) {
+                    std::cout << std::endl << "    ERROR: reaction " << i1 << " cross section = " << doubleToString2( "%17.9e", reactionCrossSections[i1] )
+                            << "  compare = " << doubleToString2( "%17.9e", reactionCrossSectionCompare );
+                    ++errCount;
+                }
+            }
+
+            double chiSquare = MCGIDI_test_chiSquarePerDOF( counts, countsCompare, dof );
+            flagged = MCGIDI_test_chiSquareFlagged( chiSquare, dof );
+            std::cout << "  tally chi^2/dof = " << doubleToString2( "%8.3f", chiSquare ) << " (" << dof << ")" << ( flagged ? "  **" : "" );
+            if( flagged ) ++errCount;
+        }
+        std::cout << std::endl;
+    }
+
+    if( fOut != nullptr ) fclose( fOut );
+    if( fIn != nullptr ) fclose( fIn );
+
+    delete protare;
+
+    delete MCProtare;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int checkCumulativeTables( MCGIDI::Protare const *a_protare ) {
+
+    int errCount = 0;
+
+    for( MCGIDI_VectorSizeType protareIndex = 0; protareIndex < a_protare->numberOfProtares( ); ++protareIndex ) {
+        MCGIDI::ProtareSingle const *protareSingle = a_protare->protare( protareIndex );
+        MCGIDI::Vector<MCGIDI::HeatedCrossSectionContinuousEnergy *> const &heatedCrossSections = protareSingle->heatedCrossSections( ).heatedCrossSections( );
+
+        for( MCGIDI_VectorSizeType temperatureIndex = 0; temperatureIndex < heatedCrossSections.size( ); ++temperatureIndex ) {
+            MCGIDI::HeatedCrossSectionContinuousEnergy const *heatedCrossSection = heatedCrossSections[temperatureIndex];
+            int numberOfReactions = heatedCrossSection->numberOfReactions( );
+            int numberOfEnergies = (int) heatedCrossSection->energies( ).size( );
+
+            if( !heatedCrossSection->hasCumulativeReactionCrossSections( ) ) {
+                std::cout << "ERROR: no cumulative reaction cross section table for temperature index " << temperatureIndex << std::endl;
+                ++errCount;
+                continue;
+            }
+
+            for( int energyIndex = 0; energyIndex < numberOfEnergies; ++energyIndex ) {
+                double const *cumulative = heatedCrossSection->cumulativeReactionCrossSectionsAt( energyIndex );
+                double sum = 0.0;
+
+                for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+                    sum += heatedCrossSection->crossSectionAtIndex( reactionIndex, energyIndex );
+                    if( fabs( cumulative[reactionIndex] - sum ) > 1e-14 * sum ) {
+                        std::cout << "ERROR: temperature index " << temperatureIndex << " energy index " << energyIndex << " reaction index "
+                                << reactionIndex << " cumulative = " << doubleToString2( "%23.15e", cumulative[reactionIndex] )
+                                << "  sum = " << doubleToString2( "%23.15e", sum ) << std::endl;
+                        ++errCount;
+                    }
+                }
+            }
+        }
+    }
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static bool crossSectionsDiffer( double a_crossSection1, double a_crossSection2 ) {
+
+    double scale = std::max( fabs( a_crossSection1 ), fabs( a_crossSection2 ) );
+
+    return( fabs( a_crossSection1 - a_crossSection2 ) > crossSectionRelativeTolerance * scale );
+}
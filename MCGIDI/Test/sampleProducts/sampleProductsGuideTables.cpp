@@ -0,0 +1,173 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "For several guide table factors, compares products sampled from a protare with guide tables to those sampled\n"
+    "from one without, for each reaction and several projectile energies. A guide table only bounds the binary search of the cdf, so the\n"
+    "products sampled with the same random numbers must be identical, except for round-off at cdf bin boundaries. The protare with guide\n"
+    "tables must also be larger. Exits with a failure status if any check fails.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+#define maximumMismatchFraction 1e-5
+
+static int compareProducts( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareGuide, long a_numberOfSamples, unsigned long long a_seed );
+static bool sameProducts( MCGIDI::Sampling::StdVectorProductHandler &a_products, MCGIDI::Sampling::StdVectorProductHandler &a_productsGuide );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    std::set<int> reactionsToExclude;
+    double guideTableFactors[] = { 0.5, 1.0, 4.0 };
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "sampleProductsGuideTables", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of samples per reaction and energy." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 10 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+    long memorySize = MCProtare->memorySize( );
+
+    for( std::size_t i1 = 0; i1 < sizeof( guideTableFactors ) / sizeof( guideTableFactors[0] ); ++i1 ) {
+        MCGIDI::Protare *MCProtareGuide;
+
+        MC.guideTableFactor( guideTableFactors[i1] );
+        try {
+            MCProtareGuide = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+        catch (char const *str) {
+            std::cout << str << std::endl;
+            exit( EXIT_FAILURE );
+        }
+
+        long memorySizeGuide = MCProtareGuide->memorySize( );
+        std::cout << "guide table factor = " << doubleToString2( "%4.1f", guideTableFactors[i1] ) << "  memory = " << memorySize
+                << "  with guide tables = " << memorySizeGuide << std::endl;
+        if( memorySizeGuide <= memorySize ) {
+            std::cout << "    no guide tables were built  **" << std::endl;
+            ++errCount;
+        }
+
+        errCount += compareProducts( MCProtare, MCProtareGuide, numberOfSamples, seed );
+
+        delete MCProtareGuide;
+    }
+
+    delete protare;
+
+    delete MCProtare;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int compareProducts( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareGuide, long a_numberOfSamples, unsigned long long a_seed ) {
+
+    int errCount = 0;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products, productsGuide;
+    void *rngState = nullptr;
+
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = a_protare->reaction( reactionIndex );
+        MCGIDI::Reaction const *reactionGuide = a_protareGuide->reaction( reactionIndex );
+        double threshold = a_protare->threshold( reactionIndex );
+        long numberOfSamples = 0, mismatches = 0;
+
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+                products.clear( );
+                MCGIDI_test_rngSetup( a_seed + i1 );
+                reaction->sampleProducts( a_protare, energy, input, float64RNG64, rngState, products );
+
+                productsGuide.clear( );
+                MCGIDI_test_rngSetup( a_seed + i1 );
+                reactionGuide->sampleProducts( a_protareGuide, energy, input, float64RNG64, rngState, productsGuide );
+
+                if( !sameProducts( products, productsGuide ) ) ++mismatches;
+            }
+            numberOfSamples += a_numberOfSamples;
+        }
+        if( mismatches > maximumMismatchFraction * numberOfSamples ) {
+            std::cout << "    reaction " << reaction->label( ).c_str( ) << ": product sampling mismatches = " << mismatches
+                    << " of " << numberOfSamples << "  **" << std::endl;
+            ++errCount;
+        }
+    }
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static bool sameProducts( MCGIDI::Sampling::StdVectorProductHandler &a_products, MCGIDI::Sampling::StdVectorProductHandler &a_productsGuide ) {
+
+    if( a_products.size( ) != a_productsGuide.size( ) ) return( false );
+
+    for( std::size_t i1 = 0; i1 < a_products.size( ); ++i1 ) {
+        MCGIDI::Sampling::Product const &product = a_products[i1];
+        MCGIDI::Sampling::Product const &productGuide = a_productsGuide[i1];
+
+        if( product.m_productIndex != productGuide.m_productIndex ) return( false );
+        if( product.m_kineticEnergy != productGuide.m_kineticEnergy ) return( false );
+        if( product.m_px_vx != productGuide.m_px_vx ) return( false );
+        if( product.m_py_vy != productGuide.m_py_vy ) return( false );
+        if( product.m_pz_vz != productGuide.m_pz_vz ) return( false );
+        if( product.m_birthTimeSec != productGuide.m_birthTimeSec ) return( false );
+    }
+
+    return( true );
+}
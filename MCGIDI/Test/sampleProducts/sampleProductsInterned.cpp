@@ -0,0 +1,251 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "For each target listed (O16 and Th227 by default), interns two copies of its protare with one Interner, so\n"
+    "that all data of the second copy are shared, and compares both copies to a protare that is not interned. At each point of the\n"
+    "lowest temperature's energy grid, at the lowest temperature and midway between the first two, the total and reaction cross sections\n"
+    "must be identical and reactions sampled with the same random numbers must be the same. For each reaction and several energies, the\n"
+    "products sampled with the same random numbers must be identical. Exits with a failure status if any check fails.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+static MCGIDI::Protare *getMCProtare( GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Transporting::Particles const &a_particles, MCGIDI::DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfos const &a_temperatures );
+static int compareCrossSections( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareInterned, MCGIDI::DomainHash const &a_domainHash,
+                double a_temperature, unsigned long long a_seed );
+static int compareProducts( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareInterned, long a_numberOfSamples, unsigned long long a_seed );
+static bool sameProducts( MCGIDI::Sampling::StdVectorProductHandler &a_products, MCGIDI::Sampling::StdVectorProductHandler &a_productsInterned );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "sampleProductsInterned", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of product samples per reaction and energy." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 1000 );
+
+    std::vector<std::string> targetIDs;
+    for( std::size_t i1 = 0; i1 < argv_options.m_arguments.size( ); ++i1 ) targetIDs.push_back( argv[argv_options.m_arguments[i1]] );
+    if( targetIDs.size( ) == 0 ) {
+        targetIDs.push_back( "O16" );
+        targetIDs.push_back( "Th227" );
+    }
+
+    GIDI::Map::Map map( mapFilename, pops );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Interner interner;
+    std::vector<GIDI::Protare *> protares;
+    std::vector<MCGIDI::Protare *> MCProtares, MCProtaresInterned;
+
+    for( std::size_t i1 = 0; i1 < targetIDs.size( ); ++i1 ) {
+        GIDI::Protare *protare;
+
+        try {
+            GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+            protare = map.protare( construction, pops, PoPI::IDs::neutron, targetIDs[i1] ); }
+        catch (char const *str) {
+            std::cout << str << std::endl;
+            exit( EXIT_FAILURE );
+        }
+        protares.push_back( protare );
+
+        GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+        std::string label( temperatures[0].heatedCrossSection( ) );
+        MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+
+        MCProtares.push_back( getMCProtare( *protare, pops, MC, particles, domainHash, temperatures ) );
+        for( int i2 = 0; i2 < 2; ++i2 ) {
+            MCGIDI::Protare *MCProtareInterned = getMCProtare( *protare, pops, MC, particles, domainHash, temperatures );
+
+            interner.intern( MCProtareInterned );
+            MCProtaresInterned.push_back( MCProtareInterned );
+        }
+    }
+
+    std::cout << "number of protares = " << interner.numberOfProtares( ) << "  vectors = " << interner.numberOfVectors( )
+            << "  distinct = " << interner.numberOfDistinctVectors( ) << "  shared = " << interner.numberOfSharedVectors( ) << std::endl;
+    if( interner.numberOfSharedVectors( ) == 0 ) {
+        std::cout << "    no vectors were shared  **" << std::endl;
+        ++errCount;
+    }
+
+    for( std::size_t i1 = 0; i1 < targetIDs.size( ); ++i1 ) {
+        GIDI::Styles::TemperatureInfos temperatures = protares[i1]->temperatures( );
+        std::vector<double> sampleTemperatures( 1, temperatures[0].temperature( ).value( ) );
+        if( temperatures.size( ) > 1 ) sampleTemperatures.push_back( 0.5 * ( sampleTemperatures[0] + temperatures[1].temperature( ).value( ) ) );
+
+        std::cout << "target = " << targetIDs[i1] << std::endl;
+        for( std::size_t i2 = 0; i2 < 2; ++i2 ) {
+            MCGIDI::Protare *MCProtareInterned = MCProtaresInterned[2 * i1 + i2];
+
+            for( std::size_t i3 = 0; i3 < sampleTemperatures.size( ); ++i3 ) {
+                errCount += compareCrossSections( MCProtares[i1], MCProtareInterned, domainHash, sampleTemperatures[i3], seed );
+            }
+            errCount += compareProducts( MCProtares[i1], MCProtareInterned, numberOfSamples, seed );
+        }
+    }
+
+    for( std::size_t i1 = 0; i1 < protares.size( ); ++i1 ) delete protares[i1];
+    for( std::size_t i1 = 0; i1 < MCProtares.size( ); ++i1 ) delete MCProtares[i1];
+    for( std::size_t i1 = 0; i1 < MCProtaresInterned.size( ); ++i1 ) delete MCProtaresInterned[i1];      // Must be deleted before interner.
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static MCGIDI::Protare *getMCProtare( GIDI::Protare const &a_protare, PoPI::Database const &a_pops, MCGIDI::Transporting::MC &a_MC,
+                GIDI::Transporting::Particles const &a_particles, MCGIDI::DomainHash const &a_domainHash, GIDI::Styles::TemperatureInfos const &a_temperatures ) {
+
+    std::set<int> reactionsToExclude;
+    MCGIDI::Protare *MCProtare = nullptr;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( a_protare, a_pops, a_MC, a_particles, a_domainHash, a_temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    return( MCProtare );
+}
+/*
+=========================================================
+*/
+static int compareCrossSections( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareInterned, MCGIDI::DomainHash const &a_domainHash,
+                double a_temperature, unsigned long long a_seed ) {
+
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    void *rngState = nullptr;
+    long numberOfCrossSectionDifferences = 0, mismatches = 0;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+    protares[0] = a_protareInterned;
+    MCGIDI::URR_protareInfos URR_protare_infosInterned( protares );
+
+    MCGIDI::Vector<double> const &energies = a_protare->protare( 0 )->heatedCrossSections( ).heatedCrossSections( )[0]->energies( );
+
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < energies.size( ); ++i1 ) {
+        double energy = energies[i1];
+        int hashIndex = a_domainHash.index( energy );
+
+        if( a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy ) !=
+                a_protareInterned->crossSection( URR_protare_infosInterned, hashIndex, a_temperature, energy ) ) ++numberOfCrossSectionDifferences;
+        for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+            if( a_protare->reactionCrossSection( reactionIndex, URR_protare_infos, hashIndex, a_temperature, energy ) !=
+                    a_protareInterned->reactionCrossSection( reactionIndex, URR_protare_infosInterned, hashIndex, a_temperature, energy ) )
+                ++numberOfCrossSectionDifferences;
+        }
+
+        double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, energy, true );
+        if( crossSection == 0.0 ) continue;
+
+        MCGIDI_test_rngSetup( a_seed + i1 );
+        int reactionIndex = a_protare->sampleReaction( URR_protare_infos, hashIndex, a_temperature, energy, crossSection, float64RNG64, rngState );
+        MCGIDI_test_rngSetup( a_seed + i1 );
+        int reactionIndexInterned = a_protareInterned->sampleReaction( URR_protare_infosInterned, hashIndex, a_temperature, energy, crossSection,
+                float64RNG64, rngState );
+        if( reactionIndex != reactionIndexInterned ) ++mismatches;
+    }
+
+    std::cout << "    temperature = " << doubleToString2( "%13.6e", a_temperature ) << "  cross section differences = " << numberOfCrossSectionDifferences
+            << "  sampling mismatches = " << mismatches;
+    if( ( numberOfCrossSectionDifferences > 0 ) || ( mismatches > 0 ) ) {
+        std::cout << "  **" << std::endl;
+        return( 1 );
+    }
+    std::cout << std::endl;
+
+    return( 0 );
+}
+/*
+=========================================================
+*/
+static int compareProducts( MCGIDI::Protare *a_protare, MCGIDI::Protare *a_protareInterned, long a_numberOfSamples, unsigned long long a_seed ) {
+
+    int errCount = 0;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products, productsInterned;
+    void *rngState = nullptr;
+
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = a_protare->reaction( reactionIndex );
+        MCGIDI::Reaction const *reactionInterned = a_protareInterned->reaction( reactionIndex );
+        double threshold = a_protare->threshold( reactionIndex );
+        long mismatches = 0;
+
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+                products.clear( );
+                MCGIDI_test_rngSetup( a_seed + i1 );
+                reaction->sampleProducts( a_protare, energy, input, float64RNG64, rngState, products );
+
+                productsInterned.clear( );
+                MCGIDI_test_rngSetup( a_seed + i1 );
+                reactionInterned->sampleProducts( a_protareInterned, energy, input, float64RNG64, rngState, productsInterned );
+
+                if( !sameProducts( products, productsInterned ) ) ++mismatches;
+            }
+        }
+        if( mismatches > 0 ) {
+            std::cout << "    reaction " << reaction->label( ).c_str( ) << ": product sampling mismatches = " << mismatches << "  **" << std::endl;
+            ++errCount;
+        }
+    }
+
+    return( errCount );
+}
+/*
+=========================================================
+*/
+static bool sameProducts( MCGIDI::Sampling::StdVectorProductHandler &a_products, MCGIDI::Sampling::StdVectorProductHandler &a_productsInterned ) {
+
+    if( a_products.size( ) != a_productsInterned.size( ) ) return( false );
+
+    for( std::size_t i1 = 0; i1 < a_products.size( ); ++i1 ) {
+        MCGIDI::Sampling::Product const &product = a_products[i1];
+        MCGIDI::Sampling::Product const &productInterned = a_productsInterned[i1];
+
+        if( product.m_productIndex != productInterned.m_productIndex ) return( false );
+        if( product.m_kineticEnergy != productInterned.m_kineticEnergy ) return( false );
+        if( product.m_px_vx != productInterned.m_px_vx ) return( false );
+        if( product.m_py_vy != productInterned.m_py_vy ) return( false );
+        if( product.m_pz_vz != productInterned.m_pz_vz ) return( false );
+        if( product.m_birthTimeSec != productInterned.m_birthTimeSec ) return( false );
+    }
+
+    return( true );
+}
@@ -0,0 +1,178 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "For each reaction and several projectile energies, samples the outgoing neutron energies from a protare whose\n"
+    "Watt, simple Maxwellian fission and evaporation spectra are sampled analytically and from one using inverse cdf tables. Their energy\n"
+    "spectra must pass a two-sample chi-square test and their mean energies must agree within the table tolerance plus 5 standard\n"
+    "errors. The protare with spectrum tables must also be larger. Exits with a failure status if any check fails.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+#include <set>
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+#define numberOfEnergyBins 100
+#define logEnergyMin -11.0
+#define logEnergyMax 2.0
+
+static long sampleNeutronEnergies( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                std::vector<double> &a_energyCounts, double &a_mean, double &a_variance );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    std::set<int> reactionsToExclude;
+    int neutronIndex = pops[PoPI::IDs::neutron], errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "sampleProductsSpectrumTables", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "--tolerance", true, "The spectrum table tolerance." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of samples per reaction and energy." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "U233" );
+    double tolerance = argv_options.find( "--tolerance" )->asDouble( argv, 1e-3 );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 100 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    MCGIDI_test_rngSetup( seed );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare, *MCProtareTable;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        MC.spectrumTableTolerance( tolerance );
+        MCProtareTable = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    long memorySize = MCProtare->memorySize( ), memorySizeTable = MCProtareTable->memorySize( );
+    std::cout << "tolerance = " << doubleToString2( "%9.2e", tolerance ) << "  memory = " << memorySize << "  with spectrum tables = "
+            << memorySizeTable << std::endl;
+    if( memorySizeTable <= memorySize ) {
+        std::cout << "    no spectrum tables were built  **" << std::endl;
+        ++errCount;
+    }
+
+    int numberOfReactions = (int) MCProtare->numberOfReactions( );
+    std::vector<double> energyCounts( numberOfEnergyBins ), energyCountsTable( numberOfEnergyBins );
+
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = MCProtare->reaction( reactionIndex );
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        std::cout << "reaction (" << std::setw( 3 ) << reactionIndex << ") = " << reaction->label( ).c_str( ) << std::endl;
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            double mean, variance, meanTable, varianceTable;
+            int dof;
+
+            long numberOfNeutrons = sampleNeutronEnergies( MCProtare, reactionIndex, energy, numberOfSamples, neutronIndex, energyCounts,
+                    mean, variance );
+            long numberOfNeutronsTable = sampleNeutronEnergies( MCProtareTable, reactionIndex, energy, numberOfSamples, neutronIndex,
+                    energyCountsTable, meanTable, varianceTable );
+            if( ( numberOfNeutrons == 0 ) || ( numberOfNeutronsTable == 0 ) ) continue;
+
+            double chiSquare = MCGIDI_test_chiSquarePerDOF( energyCounts, energyCountsTable, dof );
+            double standardError = sqrt( variance / numberOfNeutrons + varianceTable / numberOfNeutronsTable );
+            bool flagged = MCGIDI_test_chiSquareFlagged( chiSquare, dof ) || ( fabs( meanTable - mean ) > tolerance * mean + 5.0 * standardError );
+
+            if( flagged ) ++errCount;
+            std::cout << "    energy = " << std::setw( 12 ) << std::setprecision( 5 ) << energy
+                    << "  mean energy = " << std::setw( 12 ) << mean << std::setw( 12 ) << meanTable
+                    << "  chi^2/dof = " << std::setw( 8 ) << std::setprecision( 3 ) << chiSquare << " (" << std::setw( 3 ) << dof << ")"
+                    << ( flagged ? "  **" : "" ) << std::endl;
+        }
+    }
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareTable;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static long sampleNeutronEnergies( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                std::vector<double> &a_energyCounts, double &a_mean, double &a_variance ) {
+
+    MCGIDI::Reaction const *reaction = a_protare->reaction( a_reactionIndex );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products;
+    void *rngState = nullptr;
+    long numberOfNeutrons = 0;
+    double sum = 0.0, sum2 = 0.0;
+
+    std::fill( a_energyCounts.begin( ), a_energyCounts.end( ), 0.0 );
+    for( long sampleIndex = 0; sampleIndex < a_numberOfSamples; ++sampleIndex ) {
+        products.clear( );
+        reaction->sampleProducts( a_protare, a_energy, input, float64RNG64, rngState, products );
+        for( std::size_t i1 = 0; i1 < products.size( ); ++i1 ) {
+            MCGIDI::Sampling::Product const &neutron = products[i1];
+
+            if( neutron.m_productIndex != a_neutronIndex ) continue;
+
+            ++numberOfNeutrons;
+            sum += neutron.m_kineticEnergy;
+            sum2 += neutron.m_kineticEnergy * neutron.m_kineticEnergy;
+            if( neutron.m_kineticEnergy > 0.0 ) {
+                int energyIndex = (int) ( numberOfEnergyBins * ( log10( neutron.m_kineticEnergy ) - logEnergyMin ) / ( logEnergyMax - logEnergyMin ) );
+                if( energyIndex < 0 ) energyIndex = 0;
+                if( energyIndex >= numberOfEnergyBins ) energyIndex = numberOfEnergyBins - 1;
+                ++a_energyCounts[energyIndex];
+            }
+        }
+    }
+
+    a_mean = 0.0;
+    a_variance = 0.0;
+    if( numberOfNeutrons > 0 ) {
+        a_mean = sum / numberOfNeutrons;
+        a_variance = std::max( 0.0, sum2 / numberOfNeutrons - a_mean * a_mean );
+    }
+
+    return( numberOfNeutrons );
+}
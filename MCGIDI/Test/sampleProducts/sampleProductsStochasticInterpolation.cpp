@@ -0,0 +1,175 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "For each reaction and several projectile energies, samples the outgoing neutrons with the default interpolation\n"
+    "of tabulated distributions and with stochastic interpolation, and compares their mu, energy and joint (energy, mu) spectra\n"
+    "with a two-sample chi-square test. The joint spectrum checks that correlated distributions keep their energy-mu correlation.\n"
+    "Exits with a failure status if any reaction/energy pair is flagged.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+#include <set>
+#include <algorithm>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+#define numberOfMuBins 40
+#define numberOfEnergyBins 100
+#define numberOfJointMuBins 10
+#define numberOfJointEnergyBins 20
+#define logEnergyMin -11.0
+#define logEnergyMax 2.0
+
+static void sampleNeutronSpectra( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                std::vector<double> &a_muCounts, std::vector<double> &a_energyCounts, std::vector<double> &a_jointCounts );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    std::set<int> reactionsToExclude;
+    int neutronIndex = pops[PoPI::IDs::neutron], numberOfFlagged = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "sampleProductsStochasticInterpolation", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of samples per reaction and energy." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 100 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    MCGIDI_test_rngSetup( seed );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = (GIDI::Protare *) map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare, *MCProtareStochastic;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        MC.wantStochasticInterpolation( true );
+        MCProtareStochastic = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    int numberOfReactions = (int) MCProtare->numberOfReactions( );
+    std::vector<double> muCountsDefault( numberOfMuBins ), energyCountsDefault( numberOfEnergyBins );
+    std::vector<double> muCountsStochastic( numberOfMuBins ), energyCountsStochastic( numberOfEnergyBins );
+    std::vector<double> jointCountsDefault( numberOfJointMuBins * numberOfJointEnergyBins );
+    std::vector<double> jointCountsStochastic( numberOfJointMuBins * numberOfJointEnergyBins );
+
+    for( int reactionIndex = 0; reactionIndex < numberOfReactions; ++reactionIndex ) {
+        MCGIDI::Reaction const *reaction = MCProtare->reaction( reactionIndex );
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        std::cout << "reaction (" << std::setw( 3 ) << reactionIndex << ") = " << reaction->label( ).c_str( ) << std::endl;
+        if( threshold < 1e-12 ) threshold = 1e-12;
+        for( double energy = 1.07 * threshold; energy < 20.0; energy *= 3.3 ) {
+            int muDOF, energyDOF, jointDOF;
+
+            sampleNeutronSpectra( MCProtare, reactionIndex, energy, numberOfSamples, neutronIndex, muCountsDefault, energyCountsDefault,
+                    jointCountsDefault );
+            sampleNeutronSpectra( MCProtareStochastic, reactionIndex, energy, numberOfSamples, neutronIndex, muCountsStochastic,
+                    energyCountsStochastic, jointCountsStochastic );
+
+            double muChiSquare = MCGIDI_test_chiSquarePerDOF( muCountsDefault, muCountsStochastic, muDOF );
+            double energyChiSquare = MCGIDI_test_chiSquarePerDOF( energyCountsDefault, energyCountsStochastic, energyDOF );
+            double jointChiSquare = MCGIDI_test_chiSquarePerDOF( jointCountsDefault, jointCountsStochastic, jointDOF );
+            bool flagged = MCGIDI_test_chiSquareFlagged( muChiSquare, muDOF ) || MCGIDI_test_chiSquareFlagged( energyChiSquare, energyDOF )
+                    || MCGIDI_test_chiSquareFlagged( jointChiSquare, jointDOF );
+
+            if( flagged ) ++numberOfFlagged;
+            std::cout << "    energy = " << std::setw( 12 ) << std::setprecision( 5 ) << energy
+                    << "  mu chi^2/dof = " << std::setw( 8 ) << std::setprecision( 3 ) << muChiSquare << " (" << std::setw( 3 ) << muDOF << ")"
+                    << "  energy chi^2/dof = " << std::setw( 8 ) << energyChiSquare << " (" << std::setw( 3 ) << energyDOF << ")"
+                    << "  joint chi^2/dof = " << std::setw( 8 ) << jointChiSquare << " (" << std::setw( 3 ) << jointDOF << ")"
+                    << ( flagged ? "  **" : "" ) << std::endl;
+        }
+    }
+    std::cout << "number flagged = " << numberOfFlagged << std::endl;
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareStochastic;
+
+    exit( numberOfFlagged > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static void sampleNeutronSpectra( MCGIDI::Protare *a_protare, int a_reactionIndex, double a_energy, long a_numberOfSamples, int a_neutronIndex,
+                std::vector<double> &a_muCounts, std::vector<double> &a_energyCounts, std::vector<double> &a_jointCounts ) {
+
+    MCGIDI::Reaction const *reaction = a_protare->reaction( a_reactionIndex );
+    MCGIDI::Sampling::Input input( true, MCGIDI::Sampling::Upscatter::Model::none );
+    MCGIDI::Sampling::StdVectorProductHandler products;
+    void *rngState = nullptr;
+
+    std::fill( a_muCounts.begin( ), a_muCounts.end( ), 0.0 );
+    std::fill( a_energyCounts.begin( ), a_energyCounts.end( ), 0.0 );
+    std::fill( a_jointCounts.begin( ), a_jointCounts.end( ), 0.0 );
+    for( long sampleIndex = 0; sampleIndex < a_numberOfSamples; ++sampleIndex ) {
+        products.clear( );
+        reaction->sampleProducts( a_protare, a_energy, input, float64RNG64, rngState, products );
+        for( std::size_t i1 = 0; i1 < products.size( ); ++i1 ) {
+            MCGIDI::Sampling::Product const &neutron = products[i1];
+
+            if( neutron.m_productIndex != a_neutronIndex ) continue;
+
+            double speed = sqrt( neutron.m_px_vx * neutron.m_px_vx + neutron.m_py_vy * neutron.m_py_vy + neutron.m_pz_vz * neutron.m_pz_vz );
+            int jointMuIndex = -1;
+
+            if( speed > 0.0 ) {
+                int muIndex = (int) ( 0.5 * numberOfMuBins * ( neutron.m_pz_vz / speed + 1.0 ) );
+                if( muIndex < 0 ) muIndex = 0;
+                if( muIndex >= numberOfMuBins ) muIndex = numberOfMuBins - 1;
+                ++a_muCounts[muIndex];
+                jointMuIndex = muIndex * numberOfJointMuBins / numberOfMuBins;
+            }
+
+            if( neutron.m_kineticEnergy > 0.0 ) {
+                int energyIndex = (int) ( numberOfEnergyBins * ( log10( neutron.m_kineticEnergy ) - logEnergyMin ) / ( logEnergyMax - logEnergyMin ) );
+                if( energyIndex < 0 ) energyIndex = 0;
+                if( energyIndex >= numberOfEnergyBins ) energyIndex = numberOfEnergyBins - 1;
+                ++a_energyCounts[energyIndex];
+                if( jointMuIndex >= 0 ) ++a_jointCounts[( energyIndex * numberOfJointEnergyBins / numberOfEnergyBins ) * numberOfJointMuBins + jointMuIndex];
+            }
+        }
+    }
+}
@@ -0,0 +1,178 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "Compares reaction sampling by a protare built with the default settings (linear search of the reaction\n"
+    "cross sections) to one built with the requested reaction cross section tables. Their total and reaction cross sections must agree.\n"
+    "Sampling is done at each stored temperature and midway between the first two, at energies just above each reaction's threshold and\n"
+    "on a log grid. Both protares are given the same random number sequence, so they must sample the same reactions except for round-off\n"
+    "at reaction boundaries. The tallies must also pass a two-sample chi-square test. Exits with a failure status if any check fails.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+#define maximumMismatchFraction 1e-5
+
+static int compare( MCGIDI::Protare *a_protare1, MCGIDI::Protare *a_protare2, MCGIDI::DomainHash const &a_domainHash, double a_temperature, 
+                double a_energy, long a_numberOfSamples, unsigned long long a_seed );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    std::set<int> reactionsToExclude;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "sampleReactionsTables", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of samples per temperature and energy." ) );
+    argv_options.add( argvOption2( "--cumulative", false, "If present, the second protare samples reactions from cumulative reaction cross section tables." ) );
+    argv_options.add( argvOption2( "--packed", false, "If present, the second protare stores its reaction cross sections in the packed energy-major table." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 10 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = (GIDI::Protare *) map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedCrossSection( ) );
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare, *MCProtareTables;
+
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude );
+        if( argv_options.find( "--cumulative" )->present( ) ) MC.wantCumulativeReactionCrossSections( true );
+        if( argv_options.find( "--packed" )->present( ) ) MC.wantPackedReactionCrossSections( true );
+        MCProtareTables = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    std::vector<double> sampleTemperatures;
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) sampleTemperatures.push_back( temperatures[i1].temperature( ).value( ) );
+    if( temperatures.size( ) > 1 ) sampleTemperatures.push_back( 0.5 * ( sampleTemperatures[0] + sampleTemperatures[1] ) );
+
+    std::vector<double> energies;
+    for( double energy = 1e-11; energy < 20.0; energy *= 4.3 ) energies.push_back( energy );
+    for( std::size_t reactionIndex = 0; reactionIndex < MCProtare->numberOfReactions( ); ++reactionIndex ) {
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        if( ( threshold <= 0.0 ) || ( threshold >= 20.0 ) ) continue;
+        energies.push_back( threshold * ( 1.0 + 1e-6 ) );
+        energies.push_back( threshold * ( 1.0 + 1e-3 ) );
+        energies.push_back( threshold * 1.05 );
+    }
+
+    for( std::size_t i1 = 0; i1 < sampleTemperatures.size( ); ++i1 ) {
+        std::cout << "temperature = " << doubleToString2( "%13.6e", sampleTemperatures[i1] ) << std::endl;
+        for( std::size_t i2 = 0; i2 < energies.size( ); ++i2 ) {
+            errCount += compare( MCProtare, MCProtareTables, domainHash, sampleTemperatures[i1], energies[i2], numberOfSamples, seed );
+        }
+    }
+
+    delete protare;
+
+    delete MCProtare;
+    delete MCProtareTables;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int compare( MCGIDI::Protare *a_protare1, MCGIDI::Protare *a_protare2, MCGIDI::DomainHash const &a_domainHash, double a_temperature, 
+                double a_energy, long a_numberOfSamples, unsigned long long a_seed ) {
+
+    int errCount = 0, dof;
+    int numberOfReactions = (int) a_protare1->numberOfReactions( );
+    int hashIndex = a_domainHash.index( a_energy );
+    void *rngState = nullptr;
+    long mismatches = 0;
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares1( 1 ), protares2( 1 );
+    protares1[0] = a_protare1;
+    protares2[0] = a_protare2;
+    MCGIDI::URR_protareInfos URR_protare_infos1( protares1 ), URR_protare_infos2( protares2 );
+
+    double crossSection1 = a_protare1->crossSection( URR_protare_infos1, hashIndex, a_temperature, a_energy, true );
+    double crossSection2 = a_protare2->crossSection( URR_protare_infos2, hashIndex, a_temperature, a_energy, true );
+    if( fabs( crossSection1 - crossSection2 ) > 1e-12 * crossSection1 ) {
+        std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", a_energy ) << "  cross sections differ: " 
+                << doubleToString2( "%23.15e", crossSection1 ) << "  " << doubleToString2( "%23.15e", crossSection2 ) << std::endl;
+        ++errCount;
+    }
+    for( int i1 = 0; i1 < numberOfReactions; ++i1 ) {
+        double reactionCrossSection1 = a_protare1->reactionCrossSection( i1, URR_protare_infos1, hashIndex, a_temperature, a_energy, true );
+        double reactionCrossSection2 = a_protare2->reactionCrossSection( i1, URR_protare_infos2, hashIndex, a_temperature, a_energy, true );
+
+        if( fabs( reactionCrossSection1 - reactionCrossSection2 ) > 1e-12 * fabs( reactionCrossSection1 ) ) {
+            std::cout << "    ERROR: energy = " << doubleToString2( "%13.6e", a_energy ) << "  reaction " << i1 << " cross sections differ: " 
+                    << doubleToString2( "%23.15e", reactionCrossSection1 ) << "  " << doubleToString2( "%23.15e", reactionCrossSection2 ) << std::endl;
+            ++errCount;
+        }
+    }
+    if( crossSection1 == 0.0 ) return( errCount );
+
+    std::vector<int> sampled( a_numberOfSamples );
+    std::vector<double> counts1( numberOfReactions + 1, 0.0 ), counts2( numberOfReactions + 1, 0.0 );
+
+    MCGIDI_test_rngSetup( a_seed );
+    for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+        sampled[i1] = a_protare1->sampleReaction( URR_protare_infos1, hashIndex, a_temperature, a_energy, crossSection1, float64RNG64, rngState );
+        if( ( sampled[i1] < 0 ) || ( sampled[i1] > numberOfReactions ) ) sampled[i1] = numberOfReactions;
+        ++counts1[sampled[i1]];
+    }
+
+    MCGIDI_test_rngSetup( a_seed );
+    for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+        int reactionIndex = a_protare2->sampleReaction( URR_protare_infos2, hashIndex, a_temperature, a_energy, crossSection1, float64RNG64, rngState );
+
+        if( ( reactionIndex < 0 ) || ( reactionIndex > numberOfReactions ) ) reactionIndex = numberOfReactions;
+        ++counts2[reactionIndex];
+        if( reactionIndex != sampled[i1] ) ++mismatches;
+    }
+
+    double chiSquare = MCGIDI_test_chiSquarePerDOF( counts1, counts2, dof );
+    bool flagged = MCGIDI_test_chiSquareFlagged( chiSquare, dof ) || ( mismatches > maximumMismatchFraction * a_numberOfSamples );
+
+    std::cout << "    energy = " << doubleToString2( "%13.6e", a_energy ) << "  mismatches = " << mismatches
+            << "  chi^2/dof = " << doubleToString2( "%8.3f", chiSquare ) << " (" << dof << ")" << ( flagged ? "  **" : "" ) << std::endl;
+    if( flagged ) ++errCount;
+
+    return( errCount );
+}
@@ -0,0 +1,214 @@
+/*
+# <<BEGIN-copyright>>
+# Copyright 2019, Lawrence Livermore National Security, LLC.
+# See the top-level COPYRIGHT file for details.
+# 
+# SPDX-License-Identifier: MIT
+# <<END-copyright>>
+*/
+
+static char const *description = "Compares multi-group reaction sampling, which binary searches the per-group cumulative cross section tables,\n"
+    "to a linear search of the reaction cross sections with the same threshold group rejection. Sampling is done at each stored temperature\n"
+    "and midway between the first two, in every group and just above each reaction's threshold. At a stored temperature both must sample the\n"
+    "same reactions from the same random number sequence, except for round-off at reaction boundaries. Between temperatures the linear\n"
+    "search skips reactions below threshold, so the random number streams differ and only the tallies are compared. The tallies must pass\n"
+    "a two-sample chi-square test. Exits with a failure status if any check fails.";
+
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <set>
+
+#include "MCGIDI.hpp"
+
+#include "MCGIDI_testUtilities.hpp"
+
+#define maximumMismatchFraction 1e-5
+
+static int linearSampleReaction( MCGIDI::HeatedCrossSectionsMultiGroup const &a_heatedCrossSections, int a_hashIndex, double a_temperature, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState );
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::MultiGroupHash const &a_multiGroupHash, double a_temperature, double a_energy, 
+                long a_numberOfSamples, unsigned long long a_seed );
+/*
+=========================================================
+*/
+int main( int argc, char **argv ) {
+
+    PoPI::Database pops( "../../../GIDI/Test/pops.xml" );
+    GIDI::Protare *protare;
+    GIDI::Transporting::Particles particles;
+    unsigned long long seed = 1;
+    std::set<int> reactionsToExclude;
+    int errCount = 0;
+
+    std::cerr << "    " << __FILE__;
+    for( int i1 = 1; i1 < argc; i1++ ) std::cerr << " " << argv[i1];
+    std::cerr << std::endl;
+
+    argvOptions2 argv_options( "sampleReactionsCumulative_multiGroup", description );
+
+    argv_options.add( argvOption2( "--map", true, "The map file to use." ) );
+    argv_options.add( argvOption2( "--tid", true, "The PoPs id of the target." ) );
+    argv_options.add( argvOption2( "-n", true, "The number of samples per temperature and energy." ) );
+
+    argv_options.parseArgv( argc, argv );
+
+    std::string mapFilename = argv_options.find( "--map" )->zeroOrOneOption( argv, "../../../GIDI/Test/all3T.map" );
+    std::string targetID = argv_options.find( "--tid" )->zeroOrOneOption( argv, "O16" );
+    long numberOfSamples = argv_options.find( "-n" )->asLong( argv, 10 * 1000 );
+
+    GIDI::Map::Map map( mapFilename, pops );
+
+    try {
+        GIDI::Construction::Settings construction( GIDI::Construction::ParseMode::all, GIDI::Construction::PhotoMode::nuclearOnly );
+        protare = map.protare( construction, pops, PoPI::IDs::neutron, targetID ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    GIDI::Styles::TemperatureInfos temperatures = protare->temperatures( );
+    std::string label( temperatures[0].heatedMultiGroup( ) );
+
+    GIDI::Transporting::Groups_from_bdfls groups_from_bdfls( "../../../GIDI/Test/bdfls" );
+    GIDI::Transporting::Fluxes_from_bdfls fluxes_from_bdfls( "../../../GIDI/Test/bdfls", 0.0 );
+
+    GIDI::Transporting::MultiGroup multi_group = groups_from_bdfls.viaLabel( "LLNL_gid_4" );
+    GIDI::Transporting::Particle projectile( PoPI::IDs::neutron, multi_group );
+    projectile.appendFlux( fluxes_from_bdfls.getViaFID( 1 ) );
+    particles.add( projectile );
+    particles.process( *protare, label );
+
+    MCGIDI::Transporting::MC MC( pops, PoPI::IDs::neutron, &protare->styles( ), label, GIDI::Transporting::DelayedNeutrons::on, 20.0 );
+    MC.crossSectionLookupMode( MCGIDI::Transporting::LookupMode::Data1d::multiGroup );
+    MCGIDI::DomainHash domainHash( 4000, 1e-8, 10 );
+    MCGIDI::Protare *MCProtare;
+    try {
+        MCProtare = MCGIDI::protareFromGIDIProtare( *protare, pops, MC, particles, domainHash, temperatures, reactionsToExclude ); }
+    catch (char const *str) {
+        std::cout << str << std::endl;
+        exit( EXIT_FAILURE );
+    }
+
+    MCGIDI::MultiGroupHash multiGroupHash( *protare, temperatures[0] );
+    MCGIDI::Vector<double> const &boundaries = multiGroupHash.boundaries( );
+
+    std::vector<double> sampleTemperatures;
+    for( std::size_t i1 = 0; i1 < temperatures.size( ); ++i1 ) sampleTemperatures.push_back( temperatures[i1].temperature( ).value( ) );
+    if( temperatures.size( ) > 1 ) sampleTemperatures.push_back( 0.5 * ( sampleTemperatures[0] + sampleTemperatures[1] ) );
+
+    std::vector<double> energies;
+    for( MCGIDI_VectorSizeType i1 = 0; i1 < boundaries.size( ) - 1; ++i1 ) {
+        if( boundaries[i1] >= 20.0 ) break;
+        energies.push_back( sqrt( boundaries[i1] * boundaries[i1+1] ) );
+    }
+    for( std::size_t reactionIndex = 0; reactionIndex < MCProtare->numberOfReactions( ); ++reactionIndex ) {
+        double threshold = MCProtare->threshold( reactionIndex );
+
+        if( ( threshold <= 0.0 ) || ( threshold >= 20.0 ) ) continue;
+        energies.push_back( threshold * ( 1.0 + 1e-6 ) );
+        energies.push_back( threshold * ( 1.0 + 1e-2 ) );
+    }
+
+    for( std::size_t i1 = 0; i1 < sampleTemperatures.size( ); ++i1 ) {
+        std::cout << "temperature = " << doubleToString2( "%13.6e", sampleTemperatures[i1] ) << std::endl;
+        for( std::size_t i2 = 0; i2 < energies.size( ); ++i2 ) {
+            errCount += compare( MCProtare, multiGroupHash, sampleTemperatures[i1], energies[i2], numberOfSamples, seed );
+        }
+    }
+
+    delete protare;
+
+    delete MCProtare;
+
+    std::cout << "errCount = " << errCount << std::endl;
+    exit( errCount > 0 ? EXIT_FAILURE : EXIT_SUCCESS );
+}
+/*
+=========================================================
+*/
+static int linearSampleReaction( MCGIDI::HeatedCrossSectionsMultiGroup const &a_heatedCrossSections, int a_hashIndex, double a_temperature, 
+                double a_energy, double a_crossSection, double (*a_userrng)( void * ), void *a_rngState ) {
+
+    MCGIDI::TemperatureContext temperatureContext = a_heatedCrossSections.temperatureContext( a_temperature );
+    MCGIDI::HeatedCrossSectionMultiGroup const &heatedCrossSection1 = *a_heatedCrossSections.heatedCrossSections( )[temperatureContext.index1( )];
+    MCGIDI::HeatedCrossSectionMultiGroup const &heatedCrossSection2 = *a_heatedCrossSections.heatedCrossSections( )[temperatureContext.index2( )];
+    double sampleCrossSection = a_crossSection * a_userrng( a_rngState );
+    double temperatureFraction2 = temperatureContext.fraction( ), temperatureFraction1 = 1.0 - temperatureFraction2;
+    double crossSectionSum = 0.0;
+    int numberOfReactions = heatedCrossSection1.numberOfReactions( );
+    int sampled_reaction_index;
+
+    for( sampled_reaction_index = 0; sampled_reaction_index < numberOfReactions; ++sampled_reaction_index ) {
+        if( temperatureContext.index1( ) == temperatureContext.index2( ) ) {
+            crossSectionSum += heatedCrossSection1.reactionCrossSection( sampled_reaction_index, a_hashIndex, true ); }
+        else {
+            if( a_heatedCrossSections.threshold( sampled_reaction_index ) >= a_energy ) continue;
+            crossSectionSum += temperatureFraction1 * heatedCrossSection1.reactionCrossSection( sampled_reaction_index, a_hashIndex, true );
+            crossSectionSum += temperatureFraction2 * heatedCrossSection2.reactionCrossSection( sampled_reaction_index, a_hashIndex, true );
+        }
+        if( crossSectionSum >= sampleCrossSection ) break;
+    }
+
+    if( sampled_reaction_index == numberOfReactions ) return( MCGIDI_nullReaction );
+
+    if( a_heatedCrossSections.multiGroupThresholdIndex( sampled_reaction_index ) == a_hashIndex ) {
+        double energyAboveThreshold = a_energy - a_heatedCrossSections.threshold( sampled_reaction_index );
+        double groupWidthAboveThreshold = a_heatedCrossSections.projectileMultiGroupBoundariesCollapsed( )[a_hashIndex+1] 
+                - a_heatedCrossSections.threshold( sampled_reaction_index );
+
+        if( energyAboveThreshold <= ( a_userrng( a_rngState ) * groupWidthAboveThreshold ) ) return( MCGIDI_nullReaction );
+    }
+
+    return( sampled_reaction_index );
+}
+/*
+=========================================================
+*/
+static int compare( MCGIDI::Protare *a_protare, MCGIDI::MultiGroupHash const &a_multiGroupHash, double a_temperature, double a_energy, 
+                long a_numberOfSamples, unsigned long long a_seed ) {
+
+    int errCount = 0, dof;
+    int numberOfReactions = (int) a_protare->numberOfReactions( );
+    int hashIndex = a_multiGroupHash.index( a_energy );
+    void *rngState = nullptr;
+    long mismatches = 0;
+    MCGIDI::HeatedCrossSectionsMultiGroup const &heatedCrossSections = a_protare->protare( 0 )->heatedMultigroupCrossSections( );
+    MCGIDI::TemperatureContext temperatureContext = heatedCrossSections.temperatureContext( a_temperature );
+    bool sameStream = temperatureContext.index1( ) == temperatureContext.index2( );
+
+    MCGIDI::Vector<MCGIDI::Protare *> protares( 1 );
+    protares[0] = a_protare;
+    MCGIDI::URR_protareInfos URR_protare_infos( protares );
+
+    double crossSection = a_protare->crossSection( URR_protare_infos, hashIndex, a_temperature, a_energy, true );
+    if( crossSection == 0.0 ) return( errCount );
+
+    std::vector<int> sampled( a_numberOfSamples );
+    std::vector<double> counts1( numberOfReactions + 1, 0.0 ), counts2( numberOfReactions + 1, 0.0 );       // Last for the null reaction.
+
+    MCGIDI_test_rngSetup( a_seed );
+    for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+        sampled[i1] = linearSampleReaction( heatedCrossSections, hashIndex, a_temperature, a_energy, crossSection, float64RNG64, rngState );
+        if( ( sampled[i1] < 0 ) || ( sampled[i1] > numberOfReactions ) ) sampled[i1] = numberOfReactions;
+        ++counts1[sampled[i1]];
+    }
+
+    MCGIDI_test_rngSetup( a_seed );
+    for( long i1 = 0; i1 < a_numberOfSamples; ++i1 ) {
+        int reactionIndex = a_protare->sampleReaction( URR_protare_infos, hashIndex, a_temperature, a_energy, crossSection, float64RNG64, rngState );
+
+        if( ( reactionIndex < 0 ) || ( reactionIndex > numberOfReactions ) ) reactionIndex = numberOfReactions;
+        ++counts2[reactionIndex];
+        if( reactionIndex != sampled[i1] ) ++mismatches;
+    }
+
+    double chiSquare = MCGIDI_test_chiSquarePerDOF( counts1, counts2, dof );
+    bool flagged = MCGIDI_test_chiSquareFlagged( chiSquare, dof ) || ( sameStream && ( mismatches > maximumMismatchFraction * a_numberOfSamples ) );
+
+    std::cout << "    energy = " << doubleToString2( "%13.6e", a_energy ) << "  group = " << hashIndex << "  mismatches = " << mismatches
+            << "  chi^2/dof = " << doubleToString2( "%8.3f", chiSquare ) << " (" << dof << ")" << ( flagged ? "  **" : "" ) << std::endl;
+    if( flagged ) ++errCount;
+
+    return( errCount );
+}
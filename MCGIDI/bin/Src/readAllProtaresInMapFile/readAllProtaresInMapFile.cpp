@@ -22,6 +22,9 @@ static bool useSystem_strtod = true;
 static GIDI::Construction::Settings *constructionPtr = nullptr;
 static bool doParticlesProcessing = true;
 static bool doMultiGroup = false;
+static MCGIDI::Interner *internerPtr = nullptr;
+static std::vector<MCGIDI::Protare *> MCProtares;
+static long memorySizeBeforeInterning = 0;
 
 static char const *description = "Reads in all protares in the specified map file. Besides options, there must be one map file followed by one or more pops files.";
 
@@ -62,6 +65,7 @@ void subMain( int argc, char **argv ) {
 
     argv_options.add( argvOption2( "-f", false, "Use nf_strtod instead of the system stdtod." ) );
     argv_options.add( argvOption2( "--mg", false, "Use multi-group instead continuous energy label for MCGIDI data." ) );
+    argv_options.add( argvOption2( "--intern", false, "Keep all MCGIDI protares, share their identical data and report the memory saved." ) );
 
     argv_options.parseArgv( argc, argv );
 
@@ -89,6 +93,9 @@ void subMain( int argc, char **argv ) {
     construction.setUseSystem_strtod( useSystem_strtod );
     constructionPtr = &construction;
 
+    MCGIDI::Interner interner;
+    if( argv_options.find( "--intern" )->present( ) ) internerPtr = &interner;
+
     std::string const &mapFilename( argv[argv_options.m_arguments[0]] );
     try {
         walk( particles, mapFilename, pops ); }
@@ -97,6 +104,21 @@ void subMain( int argc, char **argv ) {
     catch (std::string str) {
         std::cout << str << std::endl;
     }
+
+    if( internerPtr != nullptr ) {
+        long memorySize = interner.memorySize( ), savedMemorySize = interner.savedMemorySize( );
+
+        std::cout << std::endl;
+        std::cout << "    number of protares = " << interner.numberOfProtares( ) << std::endl;
+        std::cout << "    memory before interning = " << memorySizeBeforeInterning << std::endl;
+        std::cout << "    number of vectors = " << interner.numberOfVectors( ) << "  distinct = " << interner.numberOfDistinctVectors( )
+                << "  shared = " << interner.numberOfSharedVectors( ) << std::endl;
+        std::cout << "    interned memory = " << memorySize << "  saved memory = " << savedMemorySize;
+        if( memorySizeBeforeInterning > 0 ) std::cout << " (" << 100.0 * savedMemorySize / memorySizeBeforeInterning << "%)";
+        std::cout << std::endl;
+
+        for( std::size_t i1 = 0; i1 < MCProtares.size( ); ++i1 ) delete MCProtares[i1];
+    }
 }
 /*
 =========================================================
@@ -155,6 +177,12 @@ void readProtare( GIDI::Transporting::Particles &particles, std::string const &p
         exit( EXIT_FAILURE );
     }
 
-    delete MCProtare;
+    if( internerPtr != nullptr ) {
+        memorySizeBeforeInterning += MCProtare->memorySize( );
+        internerPtr->intern( MCProtare );
+        MCProtares.push_back( MCProtare ); }
+    else {
+        delete MCProtare;
+    }
     delete protare;
 }